@@ -0,0 +1,91 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+#include <dml/dml.hpp>
+#include <numeric>
+#include <vector>
+#include <iostream>
+
+constexpr auto size  = 1024u;  // 1 KB
+constexpr auto count = 256u;
+
+using execution_path = dml::software;
+
+using handler_t = decltype(dml::submit<execution_path>(dml::mem_move,
+                                                       dml::make_view(static_cast<const std::uint8_t *>(nullptr), 0u),
+                                                       dml::make_view(static_cast<std::uint8_t *>(nullptr), 0u)));
+
+int main()
+{
+    std::cout << "Starting dml::completion_queue example...\n";
+    std::cout << "Copy 1KB of data into 256 destinations and collect completions from one thread...\n";
+
+    // Prepare data
+    auto src = std::vector<std::uint8_t>(size);
+    std::iota(src.begin(), src.end(), 0u);
+    auto dst      = std::vector<std::vector<std::uint8_t>>(count, std::vector<std::uint8_t>(size, 0u));
+    auto handlers = std::vector<handler_t>(count);
+
+    // Submit operations and register them with their indices as contexts
+    auto queue = dml::completion_queue();
+
+    for (auto i = 0u; i < count; ++i)
+    {
+        handlers[i] = dml::submit<execution_path>(dml::mem_move, dml::make_view(src), dml::make_view(dst[i]));
+        queue.add(handlers[i], &handlers[i]);
+    }
+
+    // Collect completions in batches
+    dml::completion_queue::completion completions[32];
+    auto failures = 0u;
+
+    while (!queue.empty())
+    {
+        const auto finished = queue.wait(completions, 32u, std::chrono::milliseconds(10));
+
+        for (auto i = 0u; i < finished; ++i)
+        {
+            const auto &handler = *static_cast<handler_t *>(completions[i].context_ptr);
+
+            if (handler.get().status != dml::status_code::ok)
+            {
+                ++failures;
+            }
+        }
+    }
+
+    // Check result
+    if (failures == 0u)
+    {
+        std::cout << "Finished successfully!\n";
+    }
+    else
+    {
+        std::cout << "Failure occurred!\n";
+        return -1;
+    }
+
+    for (const auto &destination : dst)
+    {
+        if (src != destination)
+        {
+            std::cout << "But operation was done wrongly.\n";
+            return -1;
+        }
+    }
+
+    return 0;
+}
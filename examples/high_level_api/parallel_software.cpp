@@ -0,0 +1,83 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+#include <dml/dml.hpp>
+#include <numeric>
+#include <vector>
+#include <iostream>
+
+constexpr auto size       = 16u * 1024u * 1024u;  // 16 MB
+constexpr auto chunk_size = 1024u * 1024u;        // 1 MB
+constexpr auto page_size  = 4096u;
+constexpr auto count      = 64u;
+
+using execution_path = dml::parallel_software;
+
+int main()
+{
+    std::cout << "Starting dml::parallel_software example...\n";
+    std::cout << "Copy 16MB of data by 1MB chunks, compute its CRC and run a batch of page copies...\n";
+
+    // Prepare data
+    auto src = std::vector<std::uint8_t>(size);
+    std::iota(src.begin(), src.end(), 0u);
+    auto dst  = std::vector<std::uint8_t>(size, 0u);
+    auto copy = std::vector<std::uint8_t>(count * page_size, 0u);
+
+    execution_path::set_chunk_size(chunk_size);
+
+    // Run operations
+    auto move_result = dml::execute<execution_path>(dml::mem_move, dml::make_view(src), dml::make_view(dst));
+    auto crc_result  = dml::execute<execution_path>(dml::crc, dml::make_view(dst), 0u);
+
+    // Pages are copied in parallel, the copy back of the first one waits for all of them
+    auto sequence = dml::sequence(count + 1u);
+
+    for (auto i = 0u; i < count; ++i)
+    {
+        sequence.add(dml::mem_move,
+                     dml::make_view(src.data() + i * page_size, page_size),
+                     dml::make_view(copy.data() + i * page_size, page_size));
+    }
+
+    sequence.add_fence();
+    sequence.add(dml::mem_move, dml::make_view(copy.data(), page_size), dml::make_view(dst.data(), page_size));
+
+    auto batch_result = dml::execute<execution_path>(dml::batch, sequence);
+
+    // Check result
+    if (move_result.status == dml::status_code::ok && crc_result.status == dml::status_code::ok &&
+        batch_result.status == dml::status_code::ok && batch_result.operations_completed == count + 1u)
+    {
+        std::cout << "Finished successfully!\n";
+    }
+    else
+    {
+        std::cout << "Failure occurred!\n";
+        return -1;
+    }
+
+    auto reference = dml::execute<dml::software>(dml::crc, dml::make_view(src), 0u);
+
+    if (src != dst || crc_result.crc_value != reference.crc_value ||
+        !std::equal(copy.begin(), copy.end(), src.begin()))
+    {
+        std::cout << "But operation was done wrongly.\n";
+        return -1;
+    }
+
+    return 0;
+}
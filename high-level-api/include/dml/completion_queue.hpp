@@ -0,0 +1,143 @@
+/*
+ * Copyright 2020-2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @date 10/18/2026
+ * @brief Contains @ref completion_queue definition
+ */
+
+#ifndef DML_COMPLETION_QUEUE_HPP
+#define DML_COMPLETION_QUEUE_HPP
+
+#include <chrono>
+#include <cstddef>
+
+#include <dml/detail/handler.hpp>
+#include <dml/handler.hpp>
+#include <dml_ml/completion_queue.hpp>
+
+namespace dml
+{
+    /**
+     * @ingroup dmlhl_submit
+     * @brief Collects completions of many submitted operations, so one thread drives all of them
+     *
+     * Instead of waiting on every @ref handler, a reactor thread registers handlers with a context
+     * and harvests the finished ones in batches with @ref poll or @ref wait, then reads them with @ref handler::get.
+     * An operation stopped by a page fault is resumed by the queue and reported once it's finished,
+     * so @ref handler::get returns at once for a reported handler.
+     *
+     * @note The queue isn't thread-safe. Registered handlers must stay alive and not be moved until they are reported.
+     *
+     * Example:
+     * @code
+     * auto queue = dml::completion_queue();
+     *
+     * for (auto &request : requests)
+     * {
+     *     request.handler = dml::submit<dml::hardware>(dml::mem_move, request.src, request.dst);
+     *     queue.add(request.handler, &request);
+     * }
+     *
+     * dml::completion_queue::completion completions[64];
+     *
+     * while (!queue.empty())
+     * {
+     *     auto count = queue.wait(completions, 64, std::chrono::milliseconds(1));
+     *     // completions[i].context_ptr points to a finished request
+     * }
+     * @endcode
+     */
+    class completion_queue
+    {
+    public:
+        /**
+         * @brief Type of callback called for a finished operation with its context
+         */
+        using callback_t = ml::completion_queue::callback_t;
+
+        /**
+         * @brief Finished operation, context_ptr is the value passed to @ref add
+         */
+        using completion = ml::completion_queue::completion;
+
+        /**
+         * @brief Registers a handler of a submitted operation
+         *
+         * Invalid handler is reported by the next poll.
+         *
+         * @tparam operation_t Type of operation
+         * @tparam allocator_t Type of allocator
+         * @param h            Instance of @ref handler
+         * @param context_ptr  Value reported with the completion
+         * @param callback     Function called with the context when the operation is finished, may be nullptr
+         */
+        template <typename operation_t, typename allocator_t>
+        void add(handler<operation_t, allocator_t> &h, void *context_ptr = nullptr, callback_t callback = nullptr)
+        {
+            if (h.valid())
+            {
+                queue_.add(detail::get_ml_operation(h), detail::get_ml_result(h), context_ptr, callback);
+            }
+            else
+            {
+                queue_.add(nullptr, context_ptr, callback);
+            }
+        }
+
+        /**
+         * @brief Reports up to max finished operations and unregisters them
+         *
+         * @param completions_ptr Array for at least max completions
+         * @param max             Maximal number of completions to report
+         *
+         * @return Number of reported completions
+         */
+        std::size_t poll(completion *completions_ptr, std::size_t max) noexcept
+        {
+            return queue_.poll(completions_ptr, max);
+        }
+
+        /**
+         * @brief Polls until at least one operation is finished, the queue is empty or timeout expires
+         *
+         * @param completions_ptr Array for at least max completions
+         * @param max             Maximal number of completions to report
+         * @param timeout         Maximal time to wait
+         *
+         * @return Number of reported completions
+         */
+        std::size_t wait(completion *completions_ptr, std::size_t max, std::chrono::nanoseconds timeout) noexcept
+        {
+            return queue_.wait(completions_ptr, max, timeout);
+        }
+
+        /**
+         * @brief Returns number of registered not reported operations
+         */
+        [[nodiscard]] std::size_t size() const noexcept { return queue_.size(); }
+
+        /**
+         * @brief Checks if there are no registered operations
+         */
+        [[nodiscard]] bool empty() const noexcept { return queue_.empty(); }
+
+    private:
+        ml::completion_queue queue_; /**< Registered operations */
+    };
+}  // namespace dml
+
+#endif  //DML_COMPLETION_QUEUE_HPP
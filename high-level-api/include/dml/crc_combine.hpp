@@ -0,0 +1,76 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @date 10/18/2026
+ * @brief Contains @ref crc_combine definition
+ */
+
+#ifndef DML_CRC_COMBINE_HPP
+#define DML_CRC_COMBINE_HPP
+
+#include <dml/operations.hpp>
+#include <dml_ml/crc.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dml
+{
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Returns CRC of two adjacent memory regions computed from CRC values of the regions
+     *
+     * Lets a buffer be checksummed by chunks, on different paths or threads, and the results be merged:
+     * @code
+     * auto first  = dml::execute<dml::hardware>(dml::crc, dml::make_view(src, half), 0u);
+     * auto second = dml::execute<dml::software>(dml::crc, dml::make_view(src + half, size - half), 0u);
+     *
+     * auto crc = dml::crc_combine(dml::crc, first.crc_value, second.crc_value, size - half);
+     * @endcode
+     *
+     * @param op          Operation both values are computed with, its options must be the same for both
+     * @param first_crc   CRC of the first region, computed with any seed
+     * @param second_crc  CRC of the second region, computed with zero seed
+     * @param second_size Number of bytes in the second region
+     *
+     * @return CRC of the first region followed by the second one, with the seed of the first region
+     */
+    inline auto crc_combine(crc_operation op, uint32_t first_crc, uint32_t second_crc, size_t second_size) noexcept
+        -> uint32_t
+    {
+        return ml::crc::combine(first_crc, second_crc, second_size, op.get_params());
+    }
+
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Returns CRC of two adjacent memory regions computed by Copy with CRC operations
+     *
+     * @param op          Operation both values are computed with, its options must be the same for both
+     * @param first_crc   CRC of the first region, computed with any seed
+     * @param second_crc  CRC of the second region, computed with zero seed
+     * @param second_size Number of bytes in the second region
+     *
+     * @return CRC of the first region followed by the second one, with the seed of the first region
+     */
+    inline auto crc_combine(copy_crc_operation op, uint32_t first_crc, uint32_t second_crc, size_t second_size) noexcept
+        -> uint32_t
+    {
+        return ml::crc::combine(first_crc, second_crc, second_size, op.get_params());
+    }
+}  // namespace dml
+
+#endif  //DML_CRC_COMBINE_HPP
@@ -95,7 +95,7 @@ namespace dml
 
     private:
         byte_t *const  data_ptr_; /**< Pointer to the viewed data */
-        const uint32_t size_;     /**< Size of the viewed data */
+        const size_t   size_;     /**< Size of the viewed data */
     };
 
     /**
@@ -164,7 +164,7 @@ namespace dml
 
     private:
         const byte_t *const data_ptr_; /**< Pointer to the viewed immutable data */
-        const uint32_t      size_;     /**< Size of the viewed data */
+        const size_t        size_;     /**< Size of the viewed data */
     };
 
     /**
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+
+/**
+ * @date 10/18/2026
+ * @brief Contains @ref dedicated_submitter definition
+ */
+
+#ifndef DML_DEDICATED_SUBMITTER_HPP
+#define DML_DEDICATED_SUBMITTER_HPP
+
+#ifdef DML_HW
+
+#include <dml_ml/hardware_path.hpp>
+
+namespace dml
+{
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Gives a dedicated work queue to the calling thread for its lifetime
+     *
+     * Hardware operations of the thread are submitted into the dedicated queue with MOVDIR64B,
+     * which has lower latency than ENQCMD into a shared queue. Other threads don't use the queue.
+     * When no dedicated queue is free, or the owned one is full, shared queues are used as usual.
+     *
+     * @note The object must be destroyed on the thread that created it, the destructor waits until
+     *       the operations submitted into the queue are finished. A thread needs only one such object.
+     *       Handlers of the operations may be waited for on any thread.
+     *
+     * Example:
+     * @code
+     * auto submitter = dml::dedicated_submitter();
+     *
+     * auto result = dml::execute<dml::hardware>(dml::mem_copy, src, dst);
+     * @endcode
+     */
+    class dedicated_submitter
+    {
+    public:
+        /**
+         * @brief Registers the calling thread, see @ref is_registered
+         */
+        dedicated_submitter() noexcept: is_registered_(ml::hardware_path::register_dedicated_submitter())
+        {
+        }
+
+        dedicated_submitter(const dedicated_submitter &) = delete;
+
+        auto operator=(const dedicated_submitter &) -> dedicated_submitter & = delete;
+
+        /**
+         * @brief Checks whether the thread got a dedicated work queue
+         */
+        [[nodiscard]] auto is_registered() const noexcept
+        {
+            return is_registered_;
+        }
+
+        /**
+         * @brief Returns the dedicated work queue
+         */
+        ~dedicated_submitter() noexcept
+        {
+            if (is_registered_)
+            {
+                ml::hardware_path::unregister_dedicated_submitter();
+            }
+        }
+
+    private:
+        bool is_registered_; /**< The thread owns a dedicated work queue */
+    };
+}  // namespace dml
+
+#endif
+
+#endif  //DML_DEDICATED_SUBMITTER_HPP
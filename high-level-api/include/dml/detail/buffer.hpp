@@ -25,6 +25,7 @@
 #include <dml_common/types.hpp>
 
 #include <memory>
+#include <utility>
 
 namespace dml::detail
 {
@@ -37,16 +38,6 @@ namespace dml::detail
     template <typename elem_t, typename allocator_t>
     class buffer
     {
-        /**
-         * @brief Memory size required for the element
-         */
-        static constexpr auto memory_size = sizeof(elem_t);
-
-        /**
-         * @brief Alignment requirement of the element
-         */
-        static constexpr auto alignment = alignof(elem_t);
-
         /**
          * @brief Own allocator type
          */
@@ -64,22 +55,14 @@ namespace dml::detail
          * @param allocator Instance of allocator
          * @param allocate  Specifies whether the element should be allocated
          */
-        buffer(allocator_t allocator, bool allocate): data_(nullptr), aligned_data_(nullptr), allocator_(allocator)
+        buffer(allocator_t allocator, bool allocate): data_(nullptr), allocator_(allocator)
         {
             if (allocate)
             {
-                // Assume allocation is a success
-                data_ = own_traits_t::allocate(allocator_, memory_size + alignment);
-
-                // Align
-                auto align_offset = static_cast<std::size_t>(reinterpret_cast<uintptr_t>(data_) & (alignment - 1));
-                if (align_offset != 0)
-                {
-                    align_offset = alignment - align_offset;
-                }
-                aligned_data_ = reinterpret_cast<elem_t *>(reinterpret_cast<byte_t *>(data_) + align_offset);
+                // Assume allocation is a success, the allocator aligns memory for the element type
+                data_ = own_traits_t::allocate(allocator_, 1u);
 
-                own_traits_t::construct(allocator_, aligned_data_);
+                own_traits_t::construct(allocator_, data_);
             }
         }
 
@@ -90,8 +73,8 @@ namespace dml::detail
         {
             if (data_)
             {
-                own_traits_t::destroy(allocator_, aligned_data_);
-                own_traits_t::deallocate(allocator_, data_, memory_size + alignment);
+                own_traits_t::destroy(allocator_, data_);
+                own_traits_t::deallocate(allocator_, data_, 1u);
             }
         }
 
@@ -100,7 +83,6 @@ namespace dml::detail
          */
         buffer(buffer &&other) noexcept:
             data_(std::exchange(other.data_, nullptr)),
-            aligned_data_(std::exchange(other.aligned_data_, nullptr)),
             allocator_(std::move(other.allocator_))
         {
         }
@@ -124,7 +106,6 @@ namespace dml::detail
             {
                 std::swap(allocator_, other.allocator_);
                 std::swap(data_, other.data_);
-                std::swap(aligned_data_, other.aligned_data_);
             }
 
             return *this;
@@ -137,7 +118,7 @@ namespace dml::detail
          *
          * @return Reference to the element
          */
-        [[nodiscard]] auto &get() noexcept { return *aligned_data_; }
+        [[nodiscard]] auto &get() noexcept { return *data_; }
 
         /**
          * @brief Returns reference to the element (const version)
@@ -146,12 +127,11 @@ namespace dml::detail
          *
          * @return Const reference to the element
          */
-        [[nodiscard]] const auto &get() const noexcept { return *aligned_data_; }
+        [[nodiscard]] const auto &get() const noexcept { return *data_; }
 
     private:
-        elem_t *    data_{};         /**< Pointer to allocated memory */
-        elem_t *    aligned_data_{}; /**< Pointer to the element */
-        own_alloc_t allocator_{};    /**< Allocator instance */
+        elem_t *    data_{};      /**< Pointer to the element */
+        own_alloc_t allocator_{}; /**< Allocator instance */
     };
 
     /**
@@ -52,11 +52,12 @@ namespace dml::detail
         }
 
         auto result = ml::result();
+        auto op     = make_operation();
 
         // If execution_path::run returns status code
         if constexpr (std::is_same_v<status_code, std::invoke_result_t<execution_path, ml::operation, ml::result&>>)
         {
-            status = execution_path{}(make_operation(), result);
+            status = execution_path{}(op, result);
             if (status != status_code::ok)
             {
                 return typename operation::result_type{status};
@@ -64,13 +65,13 @@ namespace dml::detail
         }
         else
         {
-            execution_path{}(make_operation(), result);
+            execution_path{}(op, result);
         }
 
 #ifdef DML_HW
         if constexpr (std::is_same_v<execution_path, hardware>)
         {
-            result.wait();
+            ml::hardware_path::wait(op, result);
         }
 #endif
 
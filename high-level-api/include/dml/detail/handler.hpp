@@ -22,6 +22,7 @@
 #ifndef DML_DETAIL_HANDLER_HPP
 #define DML_DETAIL_HANDLER_HPP
 
+#include <dml_ml/operation.hpp>
 #include <dml_ml/result.hpp>
 
 namespace dml
@@ -45,6 +46,21 @@ namespace dml
         {
             return h.record_.get();
         }
+
+        /**
+         * @brief Helper to retrieve Middle Layer operation a handler waits for
+         *
+         * @tparam operation   Type of operation
+         * @tparam allocator_t Type of allocator
+         * @param h            Instance of @ref handler
+         *
+         * @return Middle Layer operation object, used to resume the operation after a page fault
+         */
+        template <typename operation, typename allocator_t>
+        ml::operation &get_ml_operation(handler<operation, allocator_t> &h) noexcept
+        {
+            return h.operation_;
+        }
     }  // namespace detail
 }  // namespace dml
 
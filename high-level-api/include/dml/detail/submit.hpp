@@ -61,9 +61,13 @@ namespace dml::detail
         // If execution_path{} returns status code (hw path)
         if constexpr (std::is_same_v<status_code, std::invoke_result_t<execution_path, ml::operation, ml::result&>>)
         {
-            auto& result = detail::get_ml_result(op_handler);
+            auto& result    = detail::get_ml_result(op_handler);
+            auto& operation = detail::get_ml_operation(op_handler);
+
+            // Handler keeps the operation to resume it after a page fault
+            operation = make_operation();
             status_code status = executor.execute(
-                [operation = make_operation(), &result]
+                [operation, &result]
                 {
                   return execution_path{}(operation, result);
                 });
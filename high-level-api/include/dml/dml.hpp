@@ -55,7 +55,10 @@ namespace dml
 {
 }
 
+#include <dml/completion_queue.hpp>
+#include <dml/crc_combine.hpp>
 #include <dml/data_view.hpp>
+#include <dml/dedicated_submitter.hpp>
 #include <dml/execute.hpp>
 #include <dml/execution_interface.hpp>
 #include <dml/execution_path.hpp>
@@ -348,19 +348,25 @@ namespace dml
                  const_data_view        src2_view,
                  data_view              delta_view)
     {
-        static_cast<void>(operation);
-
         return detail::execute<execution_path, create_delta_operation>(
             [&]
             {
                 DML_VALIDATE_SIZE_CONSISTENCY(src1_view.size(), src2_view.size());
-                return range_check::create_delta(
-                    src1_view.data(), src2_view.data(), src1_view.size(), delta_view.data(), delta_view.size());
+                return range_check::create_delta(src1_view.data(),
+                                                 src2_view.data(),
+                                                 src1_view.size(),
+                                                 delta_view.data(),
+                                                 delta_view.size(),
+                                                 operation.get_format());
             },
             [&]()
             {
-                return ml::create_delta(
-                    src1_view.data(), src2_view.data(), src1_view.size(), delta_view.data(), delta_view.size());
+                return ml::create_delta(src1_view.data(),
+                                        src2_view.data(),
+                                        src1_view.size(),
+                                        delta_view.data(),
+                                        delta_view.size(),
+                                        operation.get_format());
             });
     }
 
@@ -392,8 +398,6 @@ namespace dml
                  data_view             dst_view,
                  create_delta_result   delta_result)
     {
-        static_cast<void>(operation);
-
         return detail::execute<execution_path, apply_delta_operation>(
             [&]
             {
@@ -405,12 +409,16 @@ namespace dml
                 return range_check::apply_delta(delta_view.data(),
                                                 delta_result.delta_record_size,
                                                 dst_view.data(),
-                                                dst_view.size());
+                                                dst_view.size(),
+                                                operation.get_format());
             },
             [&]()
             {
-                return ml::apply_delta(
-                    delta_view.data(), delta_result.delta_record_size, dst_view.data(), dst_view.size());
+                return ml::apply_delta(delta_view.data(),
+                                       delta_result.delta_record_size,
+                                       dst_view.data(),
+                                       dst_view.size(),
+                                       operation.get_format());
             });
     }
 
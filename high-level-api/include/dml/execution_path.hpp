@@ -22,15 +22,16 @@
 #ifndef DML_EXECUTION_PATH_HPP
 #define DML_EXECUTION_PATH_HPP
 
+#include <dml/slab_allocator.hpp>
 #include <dml_ml/operation.hpp>
 
+#include <dml_ml/parallel_software_path.hpp>
 #include <dml_ml/software_path.hpp>
+#include <dml_ml/thread_pool.hpp>
 #ifdef DML_HW
     #include <dml_ml/hardware_path.hpp>
 #endif
 
-#include <thread>
-
 namespace dml
 {
     /**
@@ -53,22 +54,24 @@ namespace dml
         struct default_thread_spawner
         {
             /**
-             * @brief Starts a task in a detached standard thread
+             * @brief Pushes a task into the process-wide @ref ml::thread_pool
              *
-             * @tparam task_t Type of callable task
+             * Workers are persistent, so a submit costs a queue push instead of a thread creation.
+             *
+             * @tparam task_t Type of callable task (must be copy constructible)
              * @param task    Instance of a callable task
              */
             template <typename task_t>
             void operator()(task_t &&task) const
             {
-                std::thread(std::forward<task_t>(task)).detach();
+                ml::thread_pool::get_instance().submit(std::forward<task_t>(task));
             }
         };
 
         /**
          * @brief Default allocator type for software execution path
          */
-        using default_allocator = std::allocator<byte_t>;
+        using default_allocator = slab_allocator<byte_t>;
 
         /**
          * @brief Executes Middle Layer operation on a software execution path
@@ -84,6 +87,63 @@ namespace dml
         }
     };
 
+    /**
+     * @brief Represent parallel software execution path
+     *
+     * Specifies that an operation is split into cache-line-aligned chunks executed on several CPU cores,
+     * results of the chunks are merged into one (see @ref ml::parallel_software_path):
+     * @code
+     * dml::parallel_software::set_chunk_size(4u * 1024u * 1024u);
+     *
+     * auto result = dml::execute<dml::parallel_software>(dml::mem_move, dml::make_view(src), dml::make_view(dst));
+     * @endcode
+     */
+    struct parallel_software
+    {
+        /**
+         * @brief Default thread spawner for the parallel software execution path
+         *
+         * The submitted task takes a worker of @ref ml::thread_pool, the rest of the workers execute chunks.
+         */
+        using default_thread_spawner = software::default_thread_spawner;
+
+        /**
+         * @brief Default allocator type for parallel software execution path
+         */
+        using default_allocator = slab_allocator<byte_t>;
+
+        /**
+         * @brief Executes Middle Layer operation on a parallel software execution path
+         *
+         * @param op  Instance of Middle Layer operation
+         * @param res Instance of Middle Layer result
+         */
+        void operator()(ml::operation op, ml::result &res) const noexcept
+        {
+            ml::parallel_software_path::submit(op, res);
+        }
+
+        /**
+         * @brief Sets number of bytes in a chunk for all operations, it's rounded up to a multiple of 4 KB
+         *
+         * @param chunk_size Number of bytes, 0 restores the default (1 MB or DML_PARALLEL_CHUNK_SIZE)
+         */
+        static void set_chunk_size(size_t chunk_size) noexcept
+        {
+            ml::parallel_software_path::set_chunk_size(chunk_size);
+        }
+
+        /**
+         * @brief Sets maximal number of threads executing chunks of an operation, including the caller
+         *
+         * @param parallelism Number of threads, 0 restores the default (all workers or DML_PARALLEL_THREADS)
+         */
+        static void set_parallelism(size_t parallelism) noexcept
+        {
+            ml::parallel_software_path::set_parallelism(parallelism);
+        }
+    };
+
 #ifdef DML_HW
     /**
      * @brief Represent hardware execution path
@@ -115,7 +175,7 @@ namespace dml
         /**
          * @brief Default allocator type for hardware execution path
          */
-        using default_allocator = std::allocator<byte_t>;
+        using default_allocator = slab_allocator<byte_t>;
 
         /**
          * @brief Executes Middle Layer operation on a hardware execution path
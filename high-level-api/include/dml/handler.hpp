@@ -24,10 +24,35 @@
 
 #include <dml/detail/buffer.hpp>
 #include <dml/detail/handler.hpp>
+#include <dml_ml/operation.hpp>
 #include <dml_ml/result.hpp>
+#ifdef DML_HW
+    #include <dml_ml/hardware_path.hpp>
+#endif
 
 namespace dml
 {
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Describes how @ref handler::get waits for an operation: spin, umwait and park stages
+     */
+    using wait_policy = ml::wait_policy;
+
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Counters of finished waits and their durations histogram
+     */
+    using wait_statistics = ml::wait_statistics;
+
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Returns counters of waits finished in this process
+     */
+    inline wait_statistics get_wait_statistics() noexcept
+    {
+        return ml::awaiter::get_statistics();
+    }
+
     /**
      * @ingroup dmlhl_aux
      * @brief Handler to a (possibly) asynchronously running operation
@@ -87,7 +112,11 @@ namespace dml
         {
             if (status_ == status_code::ok)
             {
-                record_.get().wait();
+#ifdef DML_HW
+                ml::hardware_path::wait(operation_, record_.get(), wait_policy_);
+#else
+                record_.get().wait(wait_policy_, 0u);
+#endif
 
                 return static_cast<result_type>(record_.get());
             }
@@ -115,6 +144,19 @@ namespace dml
             }
         }
 
+        /**
+         * @brief Sets how @ref get waits for the operation
+         *
+         * Short operations are better waited for by spinning, long ones by parking the thread.
+         * By default, the policy is @ref wait_policy::get_default.
+         *
+         * @param policy Wait policy
+         */
+        void set_wait_policy(const wait_policy &policy) noexcept
+        {
+            wait_policy_ = policy;
+        }
+
     private:
         /**
          * @brief Constructs a handler with initial status and allocator
@@ -131,9 +173,13 @@ namespace dml
 
         friend ml::result &detail::get_ml_result<>(handler<operation_t, allocator_t> &h) noexcept;
 
+        friend ml::operation &detail::get_ml_operation<>(handler<operation_t, allocator_t> &h) noexcept;
+
     private:
-        buffer_type record_; /**< Memory buffer for a result */
-        status_code status_; /**< This handler status */
+        buffer_type   record_;                                   /**< Memory buffer for a result */
+        status_code   status_;                                   /**< This handler status */
+        ml::operation operation_{};                              /**< Operation submitted to hardware, empty for software path */
+        wait_policy   wait_policy_ = wait_policy::get_default(); /**< How @ref get waits */
     };
 }  // namespace dml
 
@@ -326,6 +326,9 @@ namespace dml
      *
      * Paired with @ref apply_delta_operation
      *
+     * The record consists of 10-byte notes which address regions up to 0x7FFF8 bytes.
+     * Use @ref create_delta_operation::wide for the record of 16-byte notes, which has no such limit.
+     *
      * See also @ref dml::create_delta
      */
     class create_delta_operation
@@ -342,6 +345,34 @@ namespace dml
          * See @ref create_delta_result
          */
         using result_type = create_delta_result;
+
+        /**
+         * @brief Returns a new instance of the operation with @ref delta_format::wide record format.
+         *
+         * Wide record isn't limited by the region size, it's created on CPU by parts in parallel.
+         *
+         * @return New instance of the operation
+         */
+        [[nodiscard]] constexpr auto wide() const noexcept
+        {
+            return create_delta_operation(delta_format::wide);
+        }
+
+        /**
+         * @brief Returns format of the delta record
+         *
+         * @return Format of the delta record
+         */
+        [[nodiscard]] constexpr delta_format get_format() const noexcept { return format; }
+
+    private:
+        /**
+         * @brief Constructs the operation with specified delta record format
+         */
+        constexpr explicit create_delta_operation(delta_format format) noexcept: format(format) { }
+
+    private:
+        delta_format format{delta_format::standard}; /**< Delta record format */
     };
 
     /**
@@ -360,6 +391,8 @@ namespace dml
      * This operation is used in pair with @ref create_delta_operation to update first memory region to match the second
      * using written delta record.
      *
+     * The record format must be the one it's created with, see @ref apply_delta_operation::wide.
+     *
      * See also @ref dml::apply_delta
      */
     class apply_delta_operation
@@ -376,6 +409,34 @@ namespace dml
          * See @ref apply_delta_result
          */
         using result_type = apply_delta_result;
+
+        /**
+         * @brief Returns a new instance of the operation with @ref delta_format::wide record format.
+         *
+         * Wide record isn't limited by the region size, it's applied on CPU by parts in parallel.
+         *
+         * @return New instance of the operation
+         */
+        [[nodiscard]] constexpr auto wide() const noexcept
+        {
+            return apply_delta_operation(delta_format::wide);
+        }
+
+        /**
+         * @brief Returns format of the delta record
+         *
+         * @return Format of the delta record
+         */
+        [[nodiscard]] constexpr delta_format get_format() const noexcept { return format; }
+
+    private:
+        /**
+         * @brief Constructs the operation with specified delta record format
+         */
+        constexpr explicit apply_delta_operation(delta_format format) noexcept: format(format) { }
+
+    private:
+        delta_format format{delta_format::standard}; /**< Delta record format */
     };
 
     /**
@@ -342,10 +342,42 @@ namespace dml
          */
         inline status_code add(cache_flush_operation operation, data_view dst_view);
 
+        /**
+         * @brief Makes the next added operation wait for completion of all operations added before it
+         *
+         * Operations between fences are independent, so they are executed in parallel.
+         * If any of them fails, the fenced operation and the following ones aren't executed.
+         *
+         * Usage:
+         * @code
+         * sequence.add(dml::mem_move, dml::make_view(src), dml::make_view(tmp));
+         * sequence.add_fence();
+         * sequence.add(dml::crc, dml::make_view(tmp), 0u);
+         * @endcode
+         */
+        void add_fence() noexcept { is_fence_pending_ = true; }
+
     private:
-        op_buffer_t  operations_;     /**< Buffer for operations array */
-        res_buffer_t records_;        /**< Buffer for results array */
-        size_t       current_length_; /**< Current number of operation stored in the sequence */
+        /**
+         * @brief Associates the operation written last with its record and counts it, applies a requested fence
+         */
+        void push_operation() noexcept
+        {
+            operations_.get(current_length_).associate(records_.get(current_length_));
+
+            if (is_fence_pending_)
+            {
+                operations_.get(current_length_).set_fence();
+                is_fence_pending_ = false;
+            }
+
+            current_length_++;
+        }
+
+        op_buffer_t  operations_;               /**< Buffer for operations array */
+        res_buffer_t records_;                  /**< Buffer for results array */
+        size_t       current_length_;           /**< Current number of operation stored in the sequence */
+        bool         is_fence_pending_ = false; /**< The next added operation is fenced */
     };
 
     template <typename allocator_t>
@@ -369,9 +401,8 @@ namespace dml
 
         operations_.get(current_length_) =
             ml::mem_move(src_view.data(), dst_view.data(), src_view.size());
-        operations_.get(current_length_).associate(records_.get(current_length_));
+        push_operation();
 
-        current_length_++;
         return status_code::ok;
     }
 
@@ -395,9 +426,8 @@ namespace dml
         }
 
         operations_.get(current_length_) = ml::mem_copy(src_view.data(), dst_view.data(), src_view.size());
-        operations_.get(current_length_).associate(records_.get(current_length_));
+        push_operation();
 
-        current_length_++;
         return status_code::ok;
     }
 
@@ -422,9 +452,8 @@ namespace dml
 
         operations_.get(current_length_) =
             ml::fill(pattern, dst_view.data(), dst_view.size());
-        operations_.get(current_length_).associate(records_.get(current_length_));
+        push_operation();
 
-        current_length_++;
         return status_code::ok;
     }
 
@@ -452,9 +481,8 @@ namespace dml
 
         operations_.get(current_length_) = ml::dualcast(
             src_view.data(), dst1_view.data(), dst2_view.data(), src_view.size());
-        operations_.get(current_length_).associate(records_.get(current_length_));
+        push_operation();
 
-        current_length_++;
         return status_code::ok;
     }
 
@@ -480,9 +508,8 @@ namespace dml
                                                        src2_view.data(),
                                                        src1_view.size(),
                                                        operation.get_expected_result());
-        operations_.get(current_length_).associate(records_.get(current_length_));
+        push_operation();
 
-        current_length_++;
         return status_code::ok;
     }
 
@@ -508,9 +535,8 @@ namespace dml
                                 src_view.data(),
                                 src_view.size(),
                                 operation.get_expected_result());
-        operations_.get(current_length_).associate(records_.get(current_length_));
+        push_operation();
 
-        current_length_++;
         return status_code::ok;
     }
 
@@ -525,11 +551,13 @@ namespace dml
             return status_code::batch_overflow;
         }
 
-        static_cast<void>(operation);
-
         DML_VALIDATE_SIZE_CONSISTENCY(src1_view.size(), src2_view.size());
-        auto status = range_check::create_delta(
-            src1_view.data(), src2_view.data(), src1_view.size(), delta_view.data(), delta_view.size());
+        auto status = range_check::create_delta(src1_view.data(),
+                                                src2_view.data(),
+                                                src1_view.size(),
+                                                delta_view.data(),
+                                                delta_view.size(),
+                                                operation.get_format());
 
         if (status != status_code::ok)
         {
@@ -540,10 +568,10 @@ namespace dml
                                                             src2_view.data(),
                                                             src1_view.size(),
                                                             delta_view.data(),
-                                                            delta_view.size());
-        operations_.get(current_length_).associate(records_.get(current_length_));
+                                                            delta_view.size(),
+                                                            operation.get_format());
+        push_operation();
 
-        current_length_++;
         return status_code::ok;
     }
 
@@ -558,8 +586,6 @@ namespace dml
             return status_code::batch_overflow;
         }
 
-        static_cast<void>(operation);
-
         if (delta_result.result != 1)
         {
             return status_code::delta_delta_empty;
@@ -568,7 +594,8 @@ namespace dml
         auto status = range_check::apply_delta(delta_view.data(),
                                                delta_result.delta_record_size,
                                                dst_view.data(),
-                                               dst_view.size());
+                                               dst_view.size(),
+                                               operation.get_format());
 
         if (status != status_code::ok)
         {
@@ -578,10 +605,10 @@ namespace dml
         operations_.get(current_length_) = ml::apply_delta(delta_view.data(),
                                                            delta_result.delta_record_size,
                                                            dst_view.data(),
-                                                           dst_view.size());
-        operations_.get(current_length_).associate(records_.get(current_length_));
+                                                           dst_view.size(),
+                                                           operation.get_format());
+        push_operation();
 
-        current_length_++;
         return status_code::ok;
     }
 
@@ -604,9 +631,8 @@ namespace dml
 
         operations_.get(current_length_) =
             ml::crc(src_view.data(), src_view.size(), crc_seed, operation.get_params());
-        operations_.get(current_length_).associate(records_.get(current_length_));
+        push_operation();
 
-        current_length_++;
         return status_code::ok;
     }
 
@@ -634,9 +660,8 @@ namespace dml
                                                         src_view.size(),
                                                         crc_seed,
                                                         operation.get_params());
-        operations_.get(current_length_).associate(records_.get(current_length_));
+        push_operation();
 
-        current_length_++;
         return status_code::ok;
     }
 
@@ -657,9 +682,8 @@ namespace dml
 
         operations_.get(current_length_) =
             ml::cache_flush(dst_view.data(), dst_view.size(), operation.get_params());
-        operations_.get(current_length_).associate(records_.get(current_length_));
+        push_operation();
 
-        current_length_++;
         return status_code::ok;
     }
 }  // namespace dml
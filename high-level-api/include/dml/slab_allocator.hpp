@@ -0,0 +1,174 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @date 10/18/2026
+ * @brief Contains @ref slab_allocator definition
+ */
+
+#ifndef DML_SLAB_ALLOCATOR_HPP
+#define DML_SLAB_ALLOCATOR_HPP
+
+#include <dml_ml/slab_pool.hpp>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace dml
+{
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Allocator of completion records, default one for @ref software and @ref hardware paths
+     *
+     * Objects up to 64 bytes are taken from per-thread caches of @ref ml::slab_pool without locks,
+     * they may be freed by any thread. Bigger objects are allocated with operator new.
+     *
+     * Records of neighbouring handlers share cache lines by default. The device writes them concurrently,
+     * to avoid false sharing pad them to a cache line:
+     * @code
+     * auto padded = dml::execution_interface<dml::hardware::default_thread_spawner,
+     *                                        dml::slab_allocator<dml::byte_t, true>>();
+     *
+     * auto handler = dml::submit<dml::hardware>(dml::mem_move, dml::make_view(src), dml::make_view(dst), padded);
+     * @endcode
+     *
+     * @tparam elem_t            Type of allocated objects
+     * @tparam pad_to_cache_line Allocate a full cache line for each object
+     */
+    template <typename elem_t, bool pad_to_cache_line = false>
+    class slab_allocator
+    {
+    public:
+        /**
+         * @brief Type of allocated objects
+         */
+        using value_type = elem_t;
+
+        /**
+         * @brief Instances are stateless
+         */
+        using is_always_equal = std::true_type;
+
+        /**
+         * @brief Same allocator for another type
+         */
+        template <typename other_t>
+        struct rebind
+        {
+            using other = slab_allocator<other_t, pad_to_cache_line>;
+        };
+
+        /**
+         * @brief Default constructor
+         */
+        slab_allocator() noexcept = default;
+
+        /**
+         * @brief Converting constructor
+         */
+        template <typename other_t>
+        slab_allocator(const slab_allocator<other_t, pad_to_cache_line> &) noexcept
+        {
+        }
+
+        /**
+         * @brief Allocates memory for count objects
+         *
+         * @param count Number of objects
+         *
+         * @return Pointer to allocated memory
+         */
+        [[nodiscard]] elem_t *allocate(std::size_t count)
+        {
+            const auto bytes      = count * sizeof(elem_t);
+            const auto block_size = get_block_size(bytes);
+
+            void *memory_ptr = (block_size != 0u) ? ml::slab_pool::allocate(block_size)
+                                                  : ::operator new(bytes, std::align_val_t(alignof(elem_t)), std::nothrow);
+
+            if (memory_ptr == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            return static_cast<elem_t *>(memory_ptr);
+        }
+
+        /**
+         * @brief Frees memory allocated with @ref allocate
+         *
+         * @param memory_ptr Pointer to allocated memory
+         * @param count      Number of objects passed to @ref allocate
+         */
+        void deallocate(elem_t *memory_ptr, std::size_t count) noexcept
+        {
+            const auto bytes      = count * sizeof(elem_t);
+            const auto block_size = get_block_size(bytes);
+
+            if (block_size != 0u)
+            {
+                ml::slab_pool::deallocate(memory_ptr, block_size);
+            }
+            else
+            {
+                ::operator delete(memory_ptr, std::align_val_t(alignof(elem_t)));
+            }
+        }
+
+    private:
+        /**
+         * @brief Returns size of a slab block for the allocation, 0 if it doesn't fit a block
+         */
+        static constexpr std::size_t get_block_size(std::size_t bytes) noexcept
+        {
+            if (bytes > ml::slab_pool::large_block_size || alignof(elem_t) > ml::slab_pool::large_block_size)
+            {
+                return 0u;
+            }
+
+            if (pad_to_cache_line || bytes > ml::slab_pool::small_block_size ||
+                alignof(elem_t) > ml::slab_pool::small_block_size)
+            {
+                return ml::slab_pool::large_block_size;
+            }
+
+            return ml::slab_pool::small_block_size;
+        }
+    };
+
+    /**
+     * @brief Instances of the allocator are interchangeable
+     */
+    template <typename first_t, typename second_t, bool pad_to_cache_line>
+    constexpr bool operator==(const slab_allocator<first_t, pad_to_cache_line> &,
+                              const slab_allocator<second_t, pad_to_cache_line> &) noexcept
+    {
+        return true;
+    }
+
+    /**
+     * @brief Instances of the allocator are interchangeable
+     */
+    template <typename first_t, typename second_t, bool pad_to_cache_line>
+    constexpr bool operator!=(const slab_allocator<first_t, pad_to_cache_line> &,
+                              const slab_allocator<second_t, pad_to_cache_line> &) noexcept
+    {
+        return false;
+    }
+}  // namespace dml
+
+#endif  //DML_SLAB_ALLOCATOR_HPP
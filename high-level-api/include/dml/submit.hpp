@@ -472,20 +472,26 @@ namespace dml
                        const execution_interface_t &executor = execution_interface_t())
         -> handler<create_delta_operation, typename execution_interface_t::allocator_type>
     {
-        static_cast<void>(operation);
-
         return detail::submit<execution_path, create_delta_operation>(
             executor,
             [&]
             {
                 DML_VALIDATE_SIZE_CONSISTENCY(src1_view.size(), src2_view.size());
-                return range_check::create_delta(
-                    src1_view.data(), src2_view.data(), src1_view.size(), delta_view.data(), delta_view.size());
+                return range_check::create_delta(src1_view.data(),
+                                                 src2_view.data(),
+                                                 src1_view.size(),
+                                                 delta_view.data(),
+                                                 delta_view.size(),
+                                                 operation.get_format());
             },
             [&]()
             {
-                return ml::create_delta(
-                    src1_view.data(), src2_view.data(), src1_view.size(), delta_view.data(), delta_view.size());
+                return ml::create_delta(src1_view.data(),
+                                        src2_view.data(),
+                                        src1_view.size(),
+                                        delta_view.data(),
+                                        delta_view.size(),
+                                        operation.get_format());
             });
     }
 
@@ -530,8 +536,6 @@ namespace dml
                        const execution_interface_t &executor = execution_interface_t())
         -> handler<apply_delta_operation, typename execution_interface_t::allocator_type>
     {
-        static_cast<void>(operation);
-
         return detail::submit<execution_path, apply_delta_operation>(
             executor,
             [&]
@@ -544,12 +548,16 @@ namespace dml
                 return range_check::apply_delta(delta_view.data(),
                                                 delta_result.delta_record_size,
                                                 dst_view.data(),
-                                                dst_view.size());
+                                                dst_view.size(),
+                                                operation.get_format());
             },
             [&]()
             {
-                return ml::apply_delta(
-                    delta_view.data(), delta_result.delta_record_size, dst_view.data(), dst_view.size());
+                return ml::apply_delta(delta_view.data(),
+                                       delta_result.delta_record_size,
+                                       dst_view.data(),
+                                       dst_view.size(),
+                                       operation.get_format());
             });
     }
 
@@ -147,11 +147,19 @@ DML_API(dml_status_t, dml_execute_job, (dml_job_t *const dml_job_ptr))
  *
  * @remark Usage example: @ref JOB_API_SUBMIT_DML_JOB_EXAMPLE
  *
+ * @note On @ref DML_PATH_HW, Memory Move, Fill, Compare, Compare Pattern, Dualcast, CRC, Copy with CRC and
+ *       Cache Flush jobs longer than the device maximal transfer size are executed by parts: the next part is
+ *       submitted by @ref dml_check_job (@ref dml_wait_job, a completion queue) after the previous one is completed.
+ *       Other jobs, members of a batch and Memory Move with the destination overlapping the source end aren't split,
+ *       they fail with @ref DML_STATUS_JOB_LENGTH_ERROR if longer than 4 GB - 1 byte.
+ *       Submit such jobs with @ref DML_PATH_AUTO, which executes them by the software path.
+ *
  * @return @ref DML_STATUS_OK in case of success execution, or non-zero value otherwise in accordance with specified operation
  * Return values:
  * - @ref DML_STATUS_OK;
  * - @ref DML_STATUS_NULL_POINTER_ERROR;
  * - @ref DML_STATUS_JOB_CORRUPTED;
+ * - @ref DML_STATUS_JOB_LENGTH_ERROR if a hardware job is too long for a descriptor and can't be split;
  * - or other status depending on the DML operation in the @ref dml_job_t.operation field.
  *
  */
@@ -178,6 +186,9 @@ DML_API(dml_status_t, dml_wait_job, (dml_job_t *const dml_job_ptr))
  * @brief Checks the status of @ref dml_job_t processing.
  * (Can be queried periodically to check the status of dml_submit_job)
  *
+ * Hardware jobs partially completed due to a page fault, or split into parts by @ref dml_submit_job,
+ * are resubmitted from here: the job stays @ref DML_STATUS_BEING_PROCESSED until the whole job is completed.
+ *
  * @param[in,out] dml_job_ptr    Pointer to the initialized @ref dml_job_t structure
  *
  * @return @ref DML_STATUS_OK in case of success execution, or non-zero value otherwise
@@ -267,7 +278,7 @@ DML_API(dml_status_t, dml_batch_set_mem_move_by_index, (dml_job_t * dml_job_ptr,
                                                         uint32_t task_index,
                                                         uint8_t *source_ptr,
                                                         uint8_t *destination_ptr,
-                                                        uint32_t byte_length,
+                                                        uint64_t byte_length,
                                                         dml_operation_flags_t flags))
 
 
@@ -294,7 +305,7 @@ DML_API(dml_status_t, dml_batch_set_dualcast_by_index, (dml_job_t * dml_job_ptr,
                                                         uint8_t *source_ptr,
                                                         uint8_t *destination_first_ptr,
                                                         uint8_t *destination_second_ptr,
-                                                        uint32_t byte_length,
+                                                        uint64_t byte_length,
                                                         dml_operation_flags_t flags))
 
 
@@ -320,7 +331,7 @@ DML_API(dml_status_t, dml_batch_set_compare_by_index, (dml_job_t * dml_job_ptr,
                                                        uint32_t task_index,
                                                        uint8_t *source_first_ptr,
                                                        uint8_t *source_second_ptr,
-                                                       uint32_t byte_length,
+                                                       uint64_t byte_length,
                                                        dml_meta_result_t expected_result,
                                                        dml_operation_flags_t flags))
 
@@ -347,7 +358,7 @@ DML_API(dml_status_t, dml_batch_set_compare_pattern_by_index, (dml_job_t * dml_j
                                                                uint32_t task_index,
                                                                uint8_t *source_ptr,
                                                                uint8_t *pattern_ptr,
-                                                               uint32_t byte_length,
+                                                               uint64_t byte_length,
                                                                dml_meta_result_t expected_result,
                                                                dml_operation_flags_t flags))
 
@@ -372,7 +383,7 @@ DML_API(dml_status_t, dml_batch_set_compare_pattern_by_index, (dml_job_t * dml_j
 DML_API(dml_status_t, dml_batch_set_crc_by_index, (dml_job_t * dml_job_ptr,
                                                    uint32_t task_index,
                                                    uint8_t *source_ptr,
-                                                   uint32_t byte_length,
+                                                   uint64_t byte_length,
                                                    uint32_t *crc_seed_ptr,
                                                    dml_operation_flags_t flags))
 
@@ -398,7 +409,7 @@ DML_API(dml_status_t, dml_batch_set_crc_by_index, (dml_job_t * dml_job_ptr,
 DML_API(dml_status_t, dml_batch_set_copy_crc_by_index, (dml_job_t * dml_job_ptr,
                                                         uint32_t task_index,
                                                         uint8_t *source_ptr,
-                                                        uint32_t byte_length,
+                                                        uint64_t byte_length,
                                                         uint32_t *crc_seed_ptr,
                                                         uint8_t *destination_ptr,
                                                         dml_operation_flags_t flags))
@@ -425,7 +436,7 @@ DML_API(dml_status_t, dml_batch_set_fill_by_index, (dml_job_t * dml_job_ptr,
                                                     uint32_t task_index,
                                                     const uint8_t *pattern_ptr,
                                                     uint8_t *destination_ptr,
-                                                    uint32_t byte_length,
+                                                    uint64_t byte_length,
                                                     dml_operation_flags_t flags))
 
 
@@ -448,7 +459,7 @@ DML_API(dml_status_t, dml_batch_set_fill_by_index, (dml_job_t * dml_job_ptr,
 DML_API(dml_status_t, dml_batch_set_cache_flush_by_index, (dml_job_t * dml_job_ptr,
                                                            uint32_t task_index,
                                                            uint8_t *destination_ptr,
-                                                           uint32_t byte_length,
+                                                           uint64_t byte_length,
                                                            dml_operation_flags_t flags))
 
 
@@ -476,9 +487,9 @@ DML_API(dml_status_t, dml_batch_set_delta_create_by_index, (dml_job_t * dml_job_
                                                             uint32_t task_index,
                                                             uint8_t *source_ptr,
                                                             uint8_t *reference_ptr,
-                                                            uint32_t compare_length,
+                                                            uint64_t compare_length,
                                                             uint8_t *delta_record_ptr,
-                                                            uint32_t delta_record_length,
+                                                            uint64_t delta_record_length,
                                                             dml_meta_result_t expected_result,
                                                             dml_operation_flags_t flags))
 
@@ -504,9 +515,9 @@ DML_API(dml_status_t, dml_batch_set_delta_create_by_index, (dml_job_t * dml_job_
 DML_API(dml_status_t, dml_batch_set_delta_apply_by_index, (dml_job_t * dml_job_ptr,
                                                            uint32_t task_index,
                                                            uint8_t *delta_record_ptr,
-                                                           uint32_t delta_record_length,
+                                                           uint64_t delta_record_length,
                                                            uint8_t *destination_ptr,
-                                                           uint32_t destination_length,
+                                                           uint64_t destination_length,
                                                            dml_operation_flags_t flags))
 
 
@@ -530,7 +541,7 @@ DML_API(dml_status_t, dml_batch_set_delta_apply_by_index, (dml_job_t * dml_job_p
 DML_API(dml_status_t, dml_batch_set_dif_check_by_index, (dml_job_t * dml_job_ptr,
                                                          uint32_t task_index,
                                                          uint8_t *source_ptr,
-                                                         uint32_t source_length,
+                                                         uint64_t source_length,
                                                          const dml_dif_config_t *dif_config_ptr,
                                                          dml_operation_flags_t flags))
 
@@ -557,10 +568,10 @@ DML_API(dml_status_t, dml_batch_set_dif_check_by_index, (dml_job_t * dml_job_ptr
 DML_API(dml_status_t, dml_batch_set_dif_update_by_index, (dml_job_t * dml_job_ptr,
                                                           uint32_t task_index,
                                                           uint8_t *source_ptr,
-                                                          uint32_t source_length,
+                                                          uint64_t source_length,
                                                           const dml_dif_config_t *dif_config_ptr,
                                                           uint8_t *destination_ptr,
-                                                          uint32_t destination_length,
+                                                          uint64_t destination_length,
                                                           dml_operation_flags_t flags))
 
 
@@ -586,10 +597,10 @@ DML_API(dml_status_t, dml_batch_set_dif_update_by_index, (dml_job_t * dml_job_pt
 DML_API(dml_status_t, dml_batch_set_dif_insert_by_index, (dml_job_t * dml_job_ptr,
                                                           uint32_t task_index,
                                                           uint8_t *source_ptr,
-                                                          uint32_t source_length,
+                                                          uint64_t source_length,
                                                           const dml_dif_config_t *dif_config_ptr,
                                                           uint8_t *destination_ptr,
-                                                          uint32_t destination_length,
+                                                          uint64_t destination_length,
                                                           dml_operation_flags_t flags))
 
 
@@ -615,10 +626,10 @@ DML_API(dml_status_t, dml_batch_set_dif_insert_by_index, (dml_job_t * dml_job_pt
 DML_API(dml_status_t, dml_batch_set_dif_strip_by_index, (dml_job_t * dml_job_ptr,
                                                          uint32_t task_index,
                                                          uint8_t *source_ptr,
-                                                         uint32_t source_length,
+                                                         uint64_t source_length,
                                                          const dml_dif_config_t *dif_config_ptr,
                                                          uint8_t *destination_ptr,
-                                                         uint32_t destination_length,
+                                                         uint64_t destination_length,
                                                          dml_operation_flags_t flags))
 
 
@@ -660,6 +671,158 @@ DML_API(dml_status_t, dml_batch_get_status, (const dml_job_t *dml_job_ptr,
                                              dml_status_t *status_ptr))
 
 
+/**
+ * @brief Sets the size, starting from which @ref DML_PATH_AUTO jobs of the operation are submitted to hardware
+ *
+ * @param[in] operation    operation to set the threshold for
+ * @param[in] threshold    transfer size in bytes, smaller jobs are executed on CPU
+ *
+ * @note By default the thresholds are picked so that hardware submission overhead is paid back,
+ *       e.g. 256 bytes move stays on CPU and 1 MB move goes to hardware.
+ *
+ * @return
+ *      - @ref DML_STATUS_OK
+ *      - @ref DML_STATUS_JOB_OPERATION_ERROR
+ *
+ */
+DML_API(dml_status_t, dml_set_auto_path_threshold, (const dml_operation_t operation,
+                                                    const uint32_t threshold))
+
+
+/**
+ * @brief Returns counters of execution path decisions made for @ref DML_PATH_AUTO jobs since the library load
+ *
+ * @param[out] statistics_ptr    pointer to @ref dml_auto_path_statistics_t to fill
+ *
+ * @return
+ *      - @ref DML_STATUS_OK
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR
+ *
+ */
+DML_API(dml_status_t, dml_get_auto_path_statistics, (dml_auto_path_statistics_t *const statistics_ptr))
+
+
+/**
+ * @brief Returns counters of hardware jobs resumed after page faults since the library load
+ *
+ * @details Hardware jobs are submitted without Block On Fault, so a page fault doesn't stall the device:
+ *          @ref dml_wait_job and @ref dml_check_job resume the job transparently. The counters show how often it happens.
+ *
+ * @param[out] statistics_ptr    pointer to @ref dml_page_fault_statistics_t to fill
+ *
+ * @return
+ *      - @ref DML_STATUS_OK
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR
+ *
+ */
+DML_API(dml_status_t, dml_get_page_fault_statistics, (dml_page_fault_statistics_t *const statistics_ptr))
+
+
+/**
+ * @brief Calculates the amount of memory, in bytes, required for the @ref dml_completion_queue_t structure
+ *
+ * @param[in]  capacity      maximal number of jobs registered at the same time
+ * @param[out] size_ptr      a pointer to uint32_t where to store the @ref dml_completion_queue_t size (in bytes)
+ *
+ * @return
+ *      - @ref DML_STATUS_OK
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR
+ *
+ */
+DML_API(dml_status_t, dml_get_completion_queue_size, (const uint32_t capacity,
+                                                      uint32_t *const size_ptr))
+
+
+/**
+ * @brief Performs dml_completion_queue_t structure initialization
+ *
+ * A completion queue lets one thread drive many jobs: submitted jobs are registered in the queue,
+ * @ref dml_poll_completion_queue and @ref dml_wait_completion_queue report the finished ones in batches
+ * instead of a @ref dml_wait_job per job. Memory for the queue is allocated at the application side,
+ * its size is obtained with @ref dml_get_completion_queue_size().
+ *
+ * @note The queue isn't thread-safe, it's intended to be driven by a single thread.
+ *
+ * @param[in]     capacity      maximal number of jobs registered at the same time
+ * @param[in,out] queue_ptr     a pointer to @ref dml_completion_queue_t structure
+ *
+ * @return
+ *      - @ref DML_STATUS_OK
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR
+ *
+ */
+DML_API(dml_status_t, dml_init_completion_queue, (const uint32_t capacity,
+                                                  dml_completion_queue_t *const queue_ptr))
+
+
+/**
+ * @brief Registers a submitted job in a completion queue
+ *
+ * The job must be submitted with @ref dml_submit_job before, it stays registered until it is reported.
+ *
+ * @param[in,out] queue_ptr      a pointer to @ref dml_completion_queue_t structure
+ * @param[in]     dml_job_ptr    a pointer to the submitted @ref dml_job_t structure
+ * @param[in]     callback       function called when the job is finished, may be NULL
+ * @param[in]     user_data_ptr  pointer reported with the job
+ *
+ * @return
+ *      - @ref DML_STATUS_OK
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR
+ *      - @ref DML_STATUS_COMPLETION_QUEUE_FULL
+ *
+ */
+DML_API(dml_status_t, dml_register_job, (dml_completion_queue_t *const queue_ptr,
+                                         dml_job_t *const dml_job_ptr,
+                                         dml_completion_callback_t callback,
+                                         void *user_data_ptr))
+
+
+/**
+ * @brief Reports finished jobs registered in a completion queue and unregisters them
+ *
+ * Completion records of the registered jobs are scanned once, @ref dml_check_job is called only for the finished ones.
+ * The reported jobs are unregistered first, then their callbacks are called in the order of reported completions.
+ * So a callback may register a new job in the place of a reported one, even if the queue was full.
+ * Callbacks must not poll the same queue.
+ *
+ * @param[in,out] queue_ptr        a pointer to @ref dml_completion_queue_t structure
+ * @param[out]    completions_ptr  array for at least max_count completions
+ * @param[in]     max_count        maximal number of jobs to report
+ * @param[out]    count_ptr        number of reported jobs
+ *
+ * @return
+ *      - @ref DML_STATUS_OK
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR
+ *
+ */
+DML_API(dml_status_t, dml_poll_completion_queue, (dml_completion_queue_t *const queue_ptr,
+                                                  dml_completion_t *const completions_ptr,
+                                                  const uint32_t max_count,
+                                                  uint32_t *const count_ptr))
+
+
+/**
+ * @brief Polls a completion queue until at least one job is finished, the queue is empty or timeout expires
+ *
+ * @param[in,out] queue_ptr        a pointer to @ref dml_completion_queue_t structure
+ * @param[out]    completions_ptr  array for at least max_count completions
+ * @param[in]     max_count        maximal number of jobs to report
+ * @param[out]    count_ptr        number of reported jobs
+ * @param[in]     timeout_ns       maximal time to wait in nanoseconds
+ *
+ * @return
+ *      - @ref DML_STATUS_OK if a job is reported or the queue is empty
+ *      - @ref DML_STATUS_BEING_PROCESSED if timeout expired
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR
+ *
+ */
+DML_API(dml_status_t, dml_wait_completion_queue, (dml_completion_queue_t *const queue_ptr,
+                                                  dml_completion_t *const completions_ptr,
+                                                  const uint32_t max_count,
+                                                  uint32_t *const count_ptr,
+                                                  const uint64_t timeout_ns))
+
+
 #ifdef __cplusplus
 }
 #endif
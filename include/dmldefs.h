@@ -162,6 +162,9 @@ typedef uint8_t dml_internal_data_t;              /**< Hidden internal structure
 
 // DML_OP_DUALCAST operation specific flags
 #define DML_FLAG_DUALCAST_DST2_DURABLE      0x10000u /**< Writes to the second destination are identified as writes to durable memory */
+
+// DML_OP_DELTA_CREATE and DML_OP_DELTA_APPLY operation specific flags
+#define DML_FLAG_DELTA_WIDE_RECORD          0x10000u /**< 16-byte notes with 64-bit offsets, no input size limit. Executed on CPU only */
 /** @} */
 
 /**
@@ -319,6 +322,7 @@ typedef enum
     DML_STATUS_BATCH_SIZE_ERROR             = 29u,  /**< The desired batch size is bigger than the possible one */
     DML_STATUS_DRAIN_PAGE_FAULT_ERROR       = 30u,  /**< A page fault occured while translating a Readback Addres in a Drain descriptor */
     DML_STATUS_UNKNOWN_CACHE_SIZE_ERROR     = 31u,  /**< Max cache size can't be calculated */
+    DML_STATUS_COMPLETION_QUEUE_FULL        = 32u,  /**< Completion queue has no room for one more job */
 
     // Initialisation Errors
     DML_STATUS_DRIVER_NOT_FOUND             = (DML_BASE_DRIVER_ERROR + 0u),  /**< Unable to initialize job because hardware driver was not found */
@@ -356,6 +360,35 @@ typedef struct
 } dml_library_version_t;
 
 
+/**
+ * @brief Counters of decisions made for jobs initialized with @ref DML_PATH_AUTO
+ *
+ * @note Every submitted job increments exactly one of the first five counters, fallbacks are counted on top.
+ */
+typedef struct
+{
+    uint64_t hardware;              /**< Jobs submitted to hardware                                              */
+    uint64_t software_by_threshold; /**< Jobs kept on CPU as smaller than the operation crossover threshold      */
+    uint64_t software_by_operation; /**< Jobs kept on CPU as the operation or its parameters don't suit hardware */
+    uint64_t software_no_device;    /**< Jobs executed on CPU as no device is available                          */
+    uint64_t software_busy_device;  /**< Jobs kept on CPU as work queues recently rejected submissions           */
+    uint64_t fallback_on_submit;    /**< Jobs re-executed on CPU as hardware didn't accept them                  */
+    uint64_t fallback_on_error;     /**< Jobs re-executed on CPU after hardware reported an error                */
+} dml_auto_path_statistics_t;
+
+
+/**
+ * @brief Counters of hardware jobs partially completed due to a page fault
+ *
+ * @note Hardware stops a job on a not present page and reports processed bytes, the library completes the rest.
+ */
+typedef struct
+{
+    uint64_t resumed_on_hardware; /**< Times the rest of a job was resubmitted to hardware after touching the page */
+    uint64_t completed_on_cpu;    /**< Times the rest of a job was completed with software path                   */
+} dml_page_fault_statistics_t;
+
+
 
 /**
  * @brief Describe basic Dml Limitations.
@@ -394,9 +427,9 @@ typedef struct
     uint8_t               *destination_first_ptr;  /**< Pointer to destination data 1                               */
     uint8_t               *destination_second_ptr; /**< Pointer to destination data 2                               */
     uint32_t              *crc_checksum_ptr;       /**< CRC - Input and Output                                      */
-    uint32_t               source_length;          /**< Number of bytes in source 1 to proceed                      */
-    uint32_t               destination_length;     /**< Available bytes count in destination buffer                 */
-    uint32_t               offset;                 /**< Count of successfully processed bytes                       */
+    uint64_t               source_length;          /**< Number of bytes in source 1 to proceed                      */
+    uint64_t               destination_length;     /**< Available bytes count in destination buffer                 */
+    uint64_t               offset;                 /**< Count of successfully processed bytes                       */
     uint8_t                pattern[8];             /**< Pattern for "Compare Pattern" operation                     */
     dml_operation_t        operation;              /**< DML operation                                               */
     dml_meta_result_t      result;                 /**< Result field for some operations                            */
@@ -407,6 +440,34 @@ typedef struct
 } dml_job_t;
 
 
+/**
+ * @brief Finished job reported by a completion queue
+ */
+typedef struct
+{
+    dml_job_t    *job_ptr;       /**< Finished job                                 */
+    void         *user_data_ptr; /**< Pointer passed to @ref dml_register_job       */
+    dml_status_t status;         /**< Status returned by @ref dml_check_job for it */
+} dml_completion_t;
+
+
+/**
+ * @brief Callback called by a completion queue for a finished job
+ */
+typedef void (*dml_completion_callback_t)(const dml_completion_t *completion_ptr);
+
+
+/**
+ * @brief Set of submitted jobs one thread collects completions of, see @ref dml_init_completion_queue
+ */
+typedef struct
+{
+    uint32_t             capacity;          /**< Maximal number of registered jobs    */
+    uint32_t             count;             /**< Number of registered unreported jobs */
+    dml_internal_data_t  *internal_data_ptr; /**< Registered jobs                      */
+} dml_completion_queue_t;
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -245,6 +245,7 @@ namespace dml
          * @param size            Byte size of the memory region
          * @param delta_record    Pointer to the memory region for delta record
          * @param max_delta_size  Byte size of the delta record memory region
+         * @param format          Format of the delta record
          *
          * @return
          *      - @ref status_code::ok
@@ -257,14 +258,17 @@ namespace dml
                                         const byte_t *      src2,
                                         const size_t        size,
                                         const byte_t *      delta_record,
-                                        const size_t        max_delta_size) noexcept
+                                        const size_t        max_delta_size,
+                                        const delta_format  format = delta_format::standard) noexcept
         {
+            const auto note_size = (format == delta_format::wide) ? 16u : 10u;
+
             // TODO: Add more checks
             if (src1 == nullptr || src2 == nullptr || delta_record == nullptr)
             {
                 return status_code::nullptr_error;
             }
-            else if (size == 0u || size % 8 != 0)
+            else if (size == 0u || size % 8 != 0 || (format == delta_format::standard && size > UINT32_MAX))
             {
                 return status_code::bad_size;
             }
@@ -273,7 +277,8 @@ namespace dml
             {
                 return status_code::bad_alignment;
             }
-            else if (max_delta_size % 10 != 0 || max_delta_size < 80)
+            else if (max_delta_size % note_size != 0 || max_delta_size < 8 * note_size ||
+                     (format == delta_format::standard && max_delta_size > UINT32_MAX))
             {
                 return status_code::delta_bad_size;
             }
@@ -290,6 +295,7 @@ namespace dml
          * @param delta_size    Byte size of the delta record memory region
          * @param dst           Pointer to the destination memory region
          * @param size          Byte size of the memory region
+         * @param format        Format of the delta record
          *
          * @return
          *      - @ref status_code::ok
@@ -301,14 +307,17 @@ namespace dml
         static status_code apply_delta(const byte_t *const delta_record,
                                        const size_t        delta_size,
                                        const byte_t *      dst,
-                                       const size_t        size) noexcept
+                                       const size_t        size,
+                                       const delta_format  format = delta_format::standard) noexcept
         {
+            const auto note_size = (format == delta_format::wide) ? 16u : 10u;
+
             // TODO: Add checks
             if (delta_record == nullptr || dst == nullptr)
             {
                 return status_code::nullptr_error;
             }
-            else if (size == 0u || size % 8 != 0)
+            else if (size == 0u || size % 8 != 0 || (format == delta_format::standard && size > UINT32_MAX))
             {
                 return status_code::bad_size;
             }
@@ -317,7 +326,8 @@ namespace dml
             {
                 return status_code::bad_alignment;
             }
-            else if (delta_size % 10 != 0 || delta_size == 0u)
+            else if (delta_size % note_size != 0 || delta_size == 0u ||
+                     (format == delta_format::standard && delta_size > UINT32_MAX))
             {
                 return status_code::delta_bad_size;
             }
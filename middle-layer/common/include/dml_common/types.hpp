@@ -41,7 +41,7 @@ namespace dml
     /**
      * @brief Alias type used to represent sizes
      */
-    using size_t = std::uint32_t;
+    using size_t = std::uint64_t;
 
     /**
      * @brief Alias type used to represent bytes
@@ -72,6 +72,15 @@ namespace dml
         not_equal      /**< Expected inequality */
     };
 
+    /**
+     * @brief Specifies format of a delta record.
+     */
+    enum class delta_format
+    {
+        standard, /**< 10-byte notes with 16-bit offsets, regions up to 0x7FFF8 bytes, the format devices execute */
+        wide      /**< 16-byte notes with 64-bit offsets, regions of any size, executed on CPU */
+    };
+
     /**
      * @}
      */
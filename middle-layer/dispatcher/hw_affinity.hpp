@@ -0,0 +1,113 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+#ifndef DML_MIDDLE_LAYER_DISPATCHER_HW_AFFINITY_HPP_
+#define DML_MIDDLE_LAYER_DISPATCHER_HW_AFFINITY_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Helpers for per-thread selection of devices and work queues
+ *
+ * A thread keeps submitting into the same work queue (device) while it accepts descriptors.
+ * After a retry the thread moves away using power of two random choices: of two random candidates
+ * the one that rejected a descriptor longer ago wins. No state is shared between submitting threads,
+ * only the rejection timestamps, which are written on retries.
+ */
+namespace dml::ml::dispatcher::affinity {
+
+/**
+ * @brief Thread-local xorshift32 generator, seeded with the address of thread's state
+ */
+inline auto random() noexcept -> uint32_t {
+    static thread_local uint32_t state = 0u;
+
+    if (state == 0u) {
+        state = static_cast<uint32_t>((reinterpret_cast<uintptr_t>(&state) >> 4u) * 0x9e3779b9u) | 1u;
+    }
+
+    state ^= state << 13u;
+    state ^= state >> 17u;
+    state ^= state << 5u;
+
+    return state;
+}
+
+/**
+ * @brief Time stamp of a rejection, never 0 so that 0 means "never rejected"
+ */
+inline auto rejection_stamp() noexcept -> uint64_t {
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) | 1u;
+}
+
+/**
+ * @brief Time of the last rejection, kept by a work queue or a device
+ *
+ * @note Relaxed accesses only: the value is a hint, and it's written on retries only,
+ *       so the line isn't bounced while the queue accepts descriptors.
+ */
+class rejection_tracker {
+public:
+    rejection_tracker() noexcept = default;
+
+    rejection_tracker(const rejection_tracker &other) noexcept
+            : last_rejection_(other.last_rejection_.load(std::memory_order_relaxed)) {
+    }
+
+    auto operator=(const rejection_tracker &other) noexcept -> rejection_tracker & {
+        last_rejection_.store(other.last_rejection_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        return *this;
+    }
+
+    void note_rejection() const noexcept {
+        last_rejection_.store(rejection_stamp(), std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto last_rejection() const noexcept -> uint64_t {
+        return last_rejection_.load(std::memory_order_relaxed);
+    }
+
+private:
+    mutable std::atomic<uint64_t> last_rejection_ = 0u;
+};
+
+/**
+ * @brief Picks the next candidate after a rejection by `current` one
+ *
+ * @param count           number of candidates
+ * @param current         candidate that rejected a descriptor
+ * @param last_rejection  functor returning the last rejection stamp of a candidate by its index
+ *
+ * @return index of the candidate that rejected longer ago among two random ones other than `current`
+ */
+template <class last_rejection_t>
+inline auto choose_of_two(uint32_t count, uint32_t current, last_rejection_t &&last_rejection) noexcept -> uint32_t {
+    if (count < 2u) {
+        return 0u;
+    }
+
+    const auto first  = (current + 1u + random() % (count - 1u)) % count;
+    const auto second = (current + 1u + random() % (count - 1u)) % count;
+
+    return (last_rejection(first) <= last_rejection(second)) ? first : second;
+}
+
+}
+
+#endif //DML_MIDDLE_LAYER_DISPATCHER_HW_AFFINITY_HPP_
@@ -57,36 +57,55 @@ void hw_device::fill_hw_context(dsahw_context_t *const hw_context_ptr) const noe
     hw_context_ptr->gen_cap.max_descriptors              = hw_device::max_descriptors();
 }
 
-auto hw_device::enqueue_descriptor(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t {
-    const auto n_queues = std::distance(this->begin(), this->end());
+auto hw_device::enqueue_descriptor(const dsahw_descriptor_t *desc_ptr, uint32_t queue_hint) const noexcept -> dsahw_status_t {
+    // Working queue the thread submits into, per device: index + 1, 0 until the first submission
+    static thread_local std::array<uint32_t, MAX_DEVICE_COUNT> preferred_queues = {};
 
-    // Initially set to "end" index
-    static auto last_wq_idx = std::atomic(n_queues);
+    const auto n_queues  = queue_count_;
+    auto      &preferred = preferred_queues[id_];
 
-    // Loop FROM the queue after the one used for last submit
-    for (auto idx = last_wq_idx.load() + 1; idx < n_queues; ++idx)
-    {
-        auto &queue = *(this->begin() + idx);
-        auto status = queue.enqueue_descriptor(desc_ptr);
+    if (n_queues == 0u) {
+        return DML_STATUS_INSTANCE_NOT_FOUND;
+    }
 
-        if (DML_STATUS_OK == status) {
-            last_wq_idx = idx;
-            return DML_STATUS_OK;
-        }
+    if (preferred == 0u) {
+        preferred = affinity::random() % n_queues + 1u;
+    }
+
+    const auto last_rejection = [this](uint32_t idx) -> uint64_t {
+        return working_queues_[idx].rejections().last_rejection();
+    };
+
+    // Stay on the preferred queue until it asks for a retry, a hinted submission doesn't change the preference
+    auto idx = (queue_hint != no_queue_hint) ? queue_hint % n_queues : preferred - 1u;
+
+    if (DML_STATUS_OK == working_queues_[idx].enqueue_descriptor(desc_ptr)) {
+        return DML_STATUS_OK;
     }
 
-    // If the loop before didn't submit descriptor, then loop UNTIL the queue that was used for last submit
-    for (auto idx = 0; idx <= last_wq_idx; ++idx)
-    {
-        auto &queue = *(this->begin() + idx);
-        auto status = queue.enqueue_descriptor(desc_ptr);
+    working_queues_[idx].rejections().note_rejection();
+
+    // Move away using two random choices, then walk over the rest so that no free queue is missed
+    const auto rejected_idx = idx;
+    idx = affinity::choose_of_two(n_queues, idx, last_rejection);
+
+    for (uint32_t i = 0u; i < n_queues; ++i, idx = (idx + 1u) % n_queues) {
+        if (idx == rejected_idx) {
+            continue;
+        }
+
+        const auto &queue = working_queues_[idx];
 
-        if (DML_STATUS_OK == status) {
-            last_wq_idx = idx;
+        if (DML_STATUS_OK == queue.enqueue_descriptor(desc_ptr)) {
+            preferred = idx + 1u;
             return DML_STATUS_OK;
         }
+
+        queue.rejections().note_rejection();
     }
 
+    rejections_.note_rejection();
+
     return DML_STATUS_INSTANCE_NOT_FOUND;
 }
 
@@ -138,7 +157,9 @@ auto hw_device::max_descriptors() const noexcept -> uint8_t {
     return GC_MAX_DESCRIPTORS(gen_cap_register_);
 }
 
-auto hw_device::initialize_new_device(descriptor_t *device_descriptor_ptr) noexcept -> dsahw_status_t {
+auto hw_device::initialize_new_device(descriptor_t *device_descriptor_ptr, uint32_t device_id) noexcept -> dsahw_status_t {
+    id_ = device_id;
+
 #if defined(linux)
     // Device initialization stage
     auto       *device_ptr   = reinterpret_cast<accfg_device *>(device_descriptor_ptr);
@@ -161,6 +182,14 @@ auto hw_device::initialize_new_device(descriptor_t *device_descriptor_ptr) noexc
 
     while (nullptr != wq_ptr) {
         if (DML_STATUS_OK == wq_it->initialize_new_queue(wq_ptr, version_)) {
+            if (wq_it->is_dedicated()) {
+                // The slot is reused for the next queue
+                dedicated_queues_[dedicated_count_++] = std::move(*wq_it);
+                wq_ptr = dsa_work_queue_get_next(wq_ptr);
+
+                continue;
+            }
+
             wq_it++;
 
             std::push_heap(working_queues_.begin(), wq_it,
@@ -184,7 +213,7 @@ auto hw_device::initialize_new_device(descriptor_t *device_descriptor_ptr) noexc
         });
     }
 
-    if (queue_count_ == 0) {
+    if (queue_count_ == 0 && dedicated_count_ == 0) {
         return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
     }
 
@@ -198,10 +227,24 @@ auto hw_device::size() const noexcept -> size_t {
     return queue_count_;
 }
 
+auto hw_device::acquire_dedicated_queue() const noexcept -> const hw_queue * {
+    for (uint32_t i = 0u; i < dedicated_count_; ++i) {
+        if (dedicated_queues_[i].acquire()) {
+            return &dedicated_queues_[i];
+        }
+    }
+
+    return nullptr;
+}
+
 auto hw_device::numa_id() const noexcept -> uint64_t {
     return numa_node_id_;
 }
 
+auto hw_device::rejections() const noexcept -> const affinity::rejection_tracker & {
+    return rejections_;
+}
+
 auto hw_device::begin() const noexcept -> queues_container_t::const_iterator {
     return working_queues_.cbegin();
 }
@@ -41,14 +41,34 @@ public:
 
     void fill_hw_context(dsahw_context_t *hw_context_ptr) const noexcept;
 
-    [[nodiscard]] auto enqueue_descriptor(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t;
+    /**
+     * @brief Submits a descriptor into the thread's preferred queue, or into the given one first if queue_hint is set
+     */
+    [[nodiscard]] auto enqueue_descriptor(const dsahw_descriptor_t *desc_ptr,
+                                          uint32_t queue_hint = no_queue_hint) const noexcept -> dsahw_status_t;
 
-    [[nodiscard]] auto initialize_new_device(descriptor_t *device_descriptor_ptr) noexcept -> dsahw_status_t;
+    static constexpr uint32_t no_queue_hint = UINT32_MAX;
 
+    [[nodiscard]] auto initialize_new_device(descriptor_t *device_descriptor_ptr, uint32_t device_id) noexcept -> dsahw_status_t;
+
+    /**
+     * @brief Returns number of shared working queues, dedicated ones are given out by @ref acquire_dedicated_queue
+     */
     [[nodiscard]] auto size() const noexcept -> size_t;
 
+    /**
+     * @brief Gives a dedicated working queue to the calling thread
+     *
+     * @return nullptr if all dedicated queues are owned, the queue is returned with @ref hw_queue::release
+     */
+    [[nodiscard]] auto acquire_dedicated_queue() const noexcept -> const hw_queue *;
+
     [[nodiscard]] auto numa_id() const noexcept -> uint64_t;
 
+    [[nodiscard]] auto rejections() const noexcept -> const affinity::rejection_tracker &;
+
+    [[nodiscard]] auto max_transfer_size() const noexcept -> uint32_t;
+
     [[nodiscard]] auto begin() const noexcept -> queues_container_t::const_iterator;
 
     [[nodiscard]] auto end() const noexcept -> queues_container_t::const_iterator;
@@ -68,8 +88,6 @@ protected:
 
     auto descriptor_readback_support() const noexcept -> uint8_t;
 
-    auto max_transfer_size() const noexcept -> uint32_t;
-
     auto max_batch_size() const noexcept -> uint32_t;
 
     auto message_size() const noexcept -> uint16_t;
@@ -81,9 +99,13 @@ protected:
 private:
     queues_container_t working_queues_   = {};    /**< Set of available HW working queues */
     uint32_t           queue_count_      = 0u;    /**< Number of working queues that are available */
+    queues_container_t dedicated_queues_ = {};    /**< Working queues given to a thread each */
+    uint32_t           dedicated_count_  = 0u;    /**< Number of dedicated working queues */
     uint64_t           gen_cap_register_ = 0u;    /**< GENCAP register content */
     uint64_t           numa_node_id_     = 0u;    /**< NUMA node id of the device */
     uint32_t           version_          = 0u;    /**< Version of discovered device */
+    uint32_t           id_               = 0u;    /**< Index of the device in the dispatcher */
+    affinity::rejection_tracker rejections_;      /**< Submissions rejected by all working queues */
 };
 
 }
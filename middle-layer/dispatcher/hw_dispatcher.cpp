@@ -37,8 +37,9 @@ hw_dispatcher::hw_dispatcher() noexcept {
 #ifdef DML_HW
     hw_init_status_ = hw_dispatcher::initialize_hw();
     hw_support_     = hw_init_status_ == DML_STATUS_OK;
-#endif
+#else
     hw_support_ = false;
+#endif
 }
 
 #ifdef DML_HW
@@ -58,7 +59,9 @@ auto hw_dispatcher::initialize_hw() noexcept -> dsahw_status_t {
     auto device_it    = devices_.begin();
 
     while (nullptr != dev_tmp_ptr) {
-        if (DML_STATUS_OK == device_it->initialize_new_device(dev_tmp_ptr)) {
+        const auto device_id = static_cast<uint32_t>(std::distance(devices_.begin(), device_it));
+
+        if (DML_STATUS_OK == device_it->initialize_new_device(dev_tmp_ptr, device_id)) {
             device_it++;
         }
 
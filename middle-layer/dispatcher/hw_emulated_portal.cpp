@@ -0,0 +1,291 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+#if defined(DML_HW) && defined(DML_HW_EMULATOR)
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+#include <dml_ml/batch.hpp>
+#include <dml_ml/result.hpp>
+
+#include <hardware_api.h>
+
+#include "own/types.hpp"
+#include "hw_emulated_portal.hpp"
+
+namespace dml::ml::dispatcher {
+
+// Offsets of fields that are common for all descriptors
+static constexpr auto general_flags_offset     = 4u;
+static constexpr auto operation_type_offset    = 7u;
+static constexpr auto completion_record_offset = 8u;
+static constexpr auto source_offset            = 16u;
+static constexpr auto destination_offset       = 24u;
+static constexpr auto transfer_size_offset     = 32u;
+
+// Completion record fields written on partial completion
+static constexpr auto record_result_offset          = 1u;
+static constexpr auto record_bytes_completed_offset = 4u;
+static constexpr auto record_fault_address_offset   = 8u;
+static constexpr auto record_write_fault            = 0x80u;
+
+// Batch descriptor keeps the descriptors list address in place of the source address
+static constexpr auto descriptor_list_offset = 16u;
+
+static constexpr auto max_engines_count = 64u;
+
+static inline auto own_get_environment_value(const char *name, uint64_t default_value, uint64_t max_value) noexcept -> uint64_t {
+    const char *value_ptr = std::getenv(name);
+
+    if (value_ptr == nullptr) {
+        return default_value;
+    }
+
+    char *end_ptr = nullptr;
+    auto value    = std::strtoull(value_ptr, &end_ptr, 0);
+
+    if (end_ptr == value_ptr || value == 0u) {
+        return default_value;
+    }
+
+    return (value > max_value) ? max_value : value;
+}
+
+template <class field_t>
+static inline auto own_read_field(const operation &descriptor, uint32_t offset) noexcept -> field_t {
+    field_t value{};
+    std::memcpy(&value, descriptor.data() + offset, sizeof(field_t));
+
+    return value;
+}
+
+static inline auto own_get_operation_type(const operation &descriptor) noexcept -> hw_operation {
+    return static_cast<hw_operation>(descriptor.data()[operation_type_offset]);
+}
+
+/**
+ * @brief Returns number of bytes the descriptor moves, used for the bandwidth model
+ */
+static inline auto own_get_transfer_size(const operation &descriptor) noexcept -> uint64_t {
+    if (own_get_operation_type(descriptor) != hw_operation::batch) {
+        return own_read_field<uint32_t>(descriptor, transfer_size_offset);
+    }
+
+    const auto *list_ptr = own_read_field<const operation *>(descriptor, descriptor_list_offset);
+    const auto count     = own_read_field<uint32_t>(descriptor, transfer_size_offset);
+    uint64_t   size      = 0u;
+
+    for (uint32_t i = 0u; i < count; ++i) {
+        size += own_read_field<uint32_t>(list_ptr[i], transfer_size_offset);
+    }
+
+    return size;
+}
+
+/**
+ * @brief Checks if a partial completion can be reported for the descriptor
+ *
+ * Backward overlapping copy is excluded: its completed part is the tail of the buffer.
+ */
+static inline auto own_is_page_fault_allowed(const operation &descriptor) noexcept -> bool {
+    const auto flags         = own_read_field<uint16_t>(descriptor, general_flags_offset);
+    const auto transfer_size = own_read_field<uint32_t>(descriptor, transfer_size_offset);
+
+    if ((flags & static_cast<uint16_t>(hw_option::block_on_fault)) != 0u || transfer_size < 2u ||
+        !dsa_is_resumable_descriptor(reinterpret_cast<const dsahw_descriptor_t *>(descriptor.data()))) {
+        return false;
+    }
+
+    if (own_get_operation_type(descriptor) == hw_operation::mem_move) {
+        const auto source      = own_read_field<uint64_t>(descriptor, source_offset);
+        const auto destination = own_read_field<uint64_t>(descriptor, destination_offset);
+
+        return destination <= source || destination >= source + transfer_size;
+    }
+
+    return true;
+}
+
+hw_emulated_portal::hw_emulated_portal(uint32_t ring_size) noexcept {
+    const auto engines_count = own_get_environment_value("DML_EMULATOR_ENGINES", 1u, max_engines_count);
+
+    latency_ns_     = own_get_environment_value("DML_EMULATOR_LATENCY_NS", 0u, UINT64_MAX);
+    bandwidth_mbps_ = own_get_environment_value("DML_EMULATOR_BANDWIDTH_MBPS", 0u, UINT64_MAX);
+    fault_period_   = own_get_environment_value("DML_EMULATOR_PAGE_FAULTS", 0u, UINT64_MAX);
+
+    ring_.resize(std::max(ring_size, 1u));
+    engines_.reserve(engines_count);
+
+    for (uint64_t i = 0u; i < engines_count; ++i) {
+        engines_.emplace_back([this]() { run_engine(); });
+    }
+}
+
+hw_emulated_portal::~hw_emulated_portal() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    not_empty_.notify_all();
+
+    for (auto &engine : engines_) {
+        engine.join();
+    }
+}
+
+auto hw_emulated_portal::enqueue(const void *descriptor_ptr) noexcept -> bool {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (count_ == ring_.size()) {
+            return false;
+        }
+
+        auto &slot = ring_[(head_ + count_) % ring_.size()];
+        std::memcpy(slot.data(), descriptor_ptr, sizeof(operation));
+        ++count_;
+    }
+    not_empty_.notify_one();
+
+    return true;
+}
+
+void hw_emulated_portal::run_engine() noexcept {
+    while (true) {
+        operation descriptor;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_empty_.wait(lock, [this]() { return stop_ || count_ != 0u; });
+
+            // Accepted descriptors are completed anyway, somebody may wait for them
+            if (count_ == 0u) {
+                return;
+            }
+
+            descriptor = ring_[head_];
+            head_      = (head_ + 1u) % ring_.size();
+            --count_;
+        }
+
+        execute(descriptor);
+    }
+}
+
+void hw_emulated_portal::report_page_fault(const operation &descriptor,
+                                           uint8_t *record_bytes,
+                                           uint32_t bytes_completed) noexcept {
+    const auto type     = own_get_operation_type(descriptor);
+    auto       is_write = false;
+
+    switch (type) {
+        case hw_operation::mem_move:
+        case hw_operation::fill:
+        case hw_operation::dualcast:
+        case hw_operation::copy_crc:
+            is_write = true;
+            break;
+        default:
+            break;
+    }
+
+    // Cache Flush and Fill have the only address in the destination field
+    const auto address_field = (is_write || type == hw_operation::cache_flush) ? destination_offset : source_offset;
+    const auto fault_address = own_read_field<uint64_t>(descriptor, address_field) + bytes_completed;
+
+    record_bytes[0] = static_cast<uint8_t>(hw_status::page_fault_during_processing) | (is_write ? record_write_fault : 0u);
+    std::memcpy(record_bytes + record_bytes_completed_offset, &bytes_completed, sizeof(bytes_completed));
+    std::memcpy(record_bytes + record_fault_address_offset, &fault_address, sizeof(fault_address));
+}
+
+void hw_emulated_portal::execute(operation &descriptor) const noexcept {
+    const auto start = std::chrono::steady_clock::now();
+
+    // Kernels write into a shadow record, it's published after the modeled execution time
+    auto  *record_ptr = own_read_field<result *>(descriptor, completion_record_offset);
+    result shadow{};
+    auto  *shadow_ptr = &shadow;
+
+    std::memcpy(descriptor.data() + completion_record_offset, &shadow_ptr, sizeof(shadow_ptr));
+
+    auto *shadow_bytes = reinterpret_cast<uint8_t *>(shadow_ptr);
+
+    // Every N-th descriptor allowed to fault stops in the middle of the buffer,
+    // pattern comparison is done by 8-byte blocks and stops on a block boundary
+    const auto transfer_size = own_read_field<uint32_t>(descriptor, transfer_size_offset);
+    const auto block_size    = (own_get_operation_type(descriptor) == hw_operation::compare_pattern) ? 8u : 1u;
+    const auto completed     = transfer_size / 2u / block_size * block_size;
+    const auto inject_fault  = fault_period_ != 0u && completed != 0u && own_is_page_fault_allowed(descriptor) &&
+                               (fault_counter_.fetch_add(1u, std::memory_order_relaxed) + 1u) % fault_period_ == 0u;
+
+    if (inject_fault) {
+        std::memcpy(descriptor.data() + transfer_size_offset, &completed, sizeof(completed));
+    }
+
+    switch (own_get_operation_type(descriptor)) {
+        case hw_operation::nop:
+        case hw_operation::drain:
+            shadow_bytes[0] = static_cast<uint8_t>(hw_status::success);
+            break;
+        case hw_operation::batch:
+            reinterpret_cast<const batch &>(descriptor).operator()();
+            break;
+        default:
+            descriptor.operator()();
+            break;
+    }
+
+    // Operations without software implementation (DIF) are unsupported by the emulated device
+    if (shadow_bytes[0] == 0u) {
+        shadow_bytes[0] = static_cast<uint8_t>(hw_status::operation_error);
+    }
+
+    // Mismatch found in the completed part is reported as is
+    if (inject_fault && shadow_bytes[0] == static_cast<uint8_t>(hw_status::success) &&
+        shadow_bytes[record_result_offset] == 0u) {
+        report_page_fault(descriptor, shadow_bytes, completed);
+    }
+
+    auto duration_ns = latency_ns_;
+
+    if (bandwidth_mbps_ != 0u) {
+        duration_ns += own_get_transfer_size(descriptor) * 1000u / bandwidth_mbps_;
+    }
+
+    if (duration_ns != 0u) {
+        std::this_thread::sleep_until(start + std::chrono::nanoseconds(duration_ns));
+    }
+
+    if (record_ptr != nullptr) {
+        // Status goes last, as the hardware does: a waiter polls the first byte only
+        auto *record_bytes = reinterpret_cast<volatile uint8_t *>(record_ptr);
+
+        for (auto i = 1u; i < sizeof(result); ++i) {
+            record_bytes[i] = shadow_bytes[i];
+        }
+
+        std::atomic_thread_fence(std::memory_order_release);
+        record_bytes[0] = shadow_bytes[0];
+    }
+}
+
+}
+
+#endif
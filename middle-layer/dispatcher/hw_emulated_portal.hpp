@@ -0,0 +1,89 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+#ifndef DML_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_PORTAL_HPP_
+#define DML_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_PORTAL_HPP_
+
+#if defined(DML_HW) && defined(DML_HW_EMULATOR)
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <dml_ml/operation.hpp>
+
+namespace dml::ml::dispatcher {
+
+/**
+ * @brief Portal of a software-emulated shared work queue
+ *
+ * Accepts the same 64-byte descriptors as the hardware portal and keeps them in a bounded ring,
+ * engine threads execute them with the software kernels and write completion records asynchronously.
+ *
+ * Ring capacity is the work queue size, submission is rejected (retry) when it's full.
+ *
+ * Environment variables:
+ *  - DML_EMULATOR_ENGINES        - number of engine threads;
+ *  - DML_EMULATOR_LATENCY_NS     - minimal time of a descriptor execution;
+ *  - DML_EMULATOR_BANDWIDTH_MBPS - bandwidth of an engine, completion isn't reported earlier than it allows;
+ *  - DML_EMULATOR_PAGE_FAULTS    - every N-th descriptor submitted without Block On Fault completes a half
+ *                                  of its buffer and reports a page fault.
+ */
+class hw_emulated_portal {
+public:
+    explicit hw_emulated_portal(uint32_t ring_size) noexcept;
+
+    hw_emulated_portal(const hw_emulated_portal &) = delete;
+
+    auto operator=(const hw_emulated_portal &) -> hw_emulated_portal & = delete;
+
+    /**
+     * @brief Copies a descriptor into the ring, analogue of ENQCMD
+     *
+     * @return false if the queue is full and submission should be retried
+     */
+    [[nodiscard]] auto enqueue(const void *descriptor_ptr) noexcept -> bool;
+
+    ~hw_emulated_portal() noexcept;
+
+private:
+    void run_engine() noexcept;
+
+    void execute(operation &descriptor) const noexcept;
+
+    static void report_page_fault(const operation &descriptor, uint8_t *record_bytes, uint32_t bytes_completed) noexcept;
+
+    std::vector<operation>   ring_;                  /**< Accepted descriptors */
+    std::size_t              head_           = 0u;   /**< Index of the oldest accepted descriptor */
+    std::size_t              count_          = 0u;   /**< Number of accepted descriptors */
+    bool                     stop_           = false;
+    std::mutex               mutex_;
+    std::condition_variable  not_empty_;
+    std::vector<std::thread> engines_;
+    uint64_t                 latency_ns_     = 0u;
+    uint64_t                 bandwidth_mbps_ = 0u;   /**< 0 means not limited */
+    uint64_t                 fault_period_   = 0u;   /**< 0 means no page faults */
+    mutable std::atomic<uint64_t> fault_counter_{0u};  /**< Descriptors allowed to fault since the start */
+};
+
+}
+
+#endif
+
+#endif //DML_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_PORTAL_HPP_
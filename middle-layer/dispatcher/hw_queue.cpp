@@ -84,21 +84,35 @@ static inline dsahw_status_t own_specify_path(char *path_ptr,
 hw_queue::hw_queue(hw_queue &&other) noexcept {
     version_       = other.version_;
     priority_      = other.priority_;
+    memory_type_   = other.memory_type_;
     portal_mask_   = other.portal_mask_;
     portal_ptr_    = other.portal_ptr_;
-    portal_offset_ = 0;
+    rejections_    = other.rejections_;
+    is_dedicated_  = other.is_dedicated_;
+    size_          = other.size_;
+    is_owned_.store(other.is_owned_.load(std::memory_order_relaxed), std::memory_order_relaxed);
 
     other.portal_ptr_ = nullptr;
+#ifdef DML_HW_EMULATOR
+    emulated_portal_ = std::move(other.emulated_portal_);
+#endif
 }
 
 auto hw_queue::operator=(hw_queue &&other) noexcept -> hw_queue & {
     version_       = other.version_;
     priority_      = other.priority_;
+    memory_type_   = other.memory_type_;
     portal_mask_   = other.portal_mask_;
     portal_ptr_    = other.portal_ptr_;
-    portal_offset_ = 0;
+    rejections_    = other.rejections_;
+    is_dedicated_  = other.is_dedicated_;
+    size_          = other.size_;
+    is_owned_.store(other.is_owned_.load(std::memory_order_relaxed), std::memory_order_relaxed);
 
     other.portal_ptr_ = nullptr;
+#ifdef DML_HW_EMULATOR
+    emulated_portal_ = std::move(other.emulated_portal_);
+#endif
 
     return *this;
 }
@@ -115,22 +129,37 @@ hw_queue::~hw_queue() {
 }
 
 void hw_queue::set_portal_ptr(void *value_ptr) noexcept {
-    portal_offset_ = reinterpret_cast<uintptr_t>(value_ptr) & OWN_PAGE_MASK;
     portal_mask_   = reinterpret_cast<uintptr_t>(value_ptr) & (~OWN_PAGE_MASK);
     portal_ptr_    = value_ptr;
 }
 
 auto hw_queue::get_portal_ptr() const noexcept -> void * {
-    uint64_t offset = portal_offset_++;
+    // Each thread walks over the portal page on its own, so no counter is shared between cores
+    static thread_local uint64_t portal_offset = 0u;
+
+    uint64_t offset = portal_offset++;
     offset = (offset << 6) & OWN_PAGE_MASK;
     return reinterpret_cast<void *>(offset | portal_mask_);
 }
 
 auto hw_queue::enqueue_descriptor(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t {
-#if defined( linux )
+#if defined(DML_HW_EMULATOR)
+    // Same as ENQCMD: non-zero means the queue didn't accept the descriptor
+    return static_cast<dsahw_status_t>(!emulated_portal_->enqueue(desc_ptr));
+#elif defined( linux )
     uint8_t retry = 0u;
 
     void *current_place_ptr = get_portal_ptr();
+
+    if (is_dedicated_) {
+        // MOVDIR64B is a posted write, there is no retry status to read back
+        asm volatile("sfence\t\n"
+                     ".byte 0x66, 0x0f, 0x38, 0xf8, 0x02\t\n"
+        : : "a" (current_place_ptr), "d" (desc_ptr) : "memory");
+
+        return DML_STATUS_OK;
+    }
+
     asm volatile("sfence\t\n"
                  ".byte 0xf2, 0x0f, 0x38, 0xf8, 0x02\t\n"
                  "setz %0\t\n"
@@ -147,8 +176,15 @@ auto hw_queue::initialize_new_queue(void *wq_descriptor_ptr, uint32_t major_vers
     auto *work_queue_ptr = reinterpret_cast<accfg_wq *>(wq_descriptor_ptr);
     char path[64]        = "/dev/char/";
 
-    if (ACCFG_WQ_ENABLED != dsa_work_queue_get_state(work_queue_ptr) ||
-        ACCFG_WQ_SHARED != dsa_work_queue_get_mode(work_queue_ptr)) {
+    if (ACCFG_WQ_ENABLED != dsa_work_queue_get_state(work_queue_ptr)) {
+        return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
+    }
+
+    is_dedicated_ = ACCFG_WQ_DEDICATED == dsa_work_queue_get_mode(work_queue_ptr);
+    size_         = dsa_work_queue_get_size(work_queue_ptr);
+
+    // Occupancy of a dedicated queue is tracked by its owner, it can't be done without the size
+    if (is_dedicated_ && size_ == 0u) {
         return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
     }
 
@@ -162,6 +198,13 @@ auto hw_queue::initialize_new_queue(void *wq_descriptor_ptr, uint32_t major_vers
     memory_type_ = dsa_group_get_traffic_class_b(group_ptr) ? supported_memory_type::durable
                                                             : supported_memory_type::non_durable;
 
+#if defined(DML_HW_EMULATOR)
+    (void) major_version;
+
+    emulated_portal_ = std::make_unique<hw_emulated_portal>(size_);
+
+    return DML_STATUS_OK;
+#else
     // Need the next format: "/dev/char/major:minor"
 #if defined(LIB_ACCEL_VERSION_3_2)
     auto status = dsa_work_queue_get_device_path(work_queue_ptr, path, 64 - 1);
@@ -182,6 +225,7 @@ auto hw_queue::initialize_new_queue(void *wq_descriptor_ptr, uint32_t major_vers
     hw_queue::set_portal_ptr(region_ptr);
 
     return DML_STATUS_OK;
+#endif
 #else
     return DML_STATUS_WORK_QUEUE_CONNECTION_ERROR;
 #endif
@@ -195,6 +239,28 @@ auto hw_queue::memory_type() const noexcept -> hw_queue::supported_memory_type {
     return memory_type_;
 }
 
+auto hw_queue::rejections() const noexcept -> const affinity::rejection_tracker & {
+    return rejections_;
+}
+
+auto hw_queue::is_dedicated() const noexcept -> bool {
+    return is_dedicated_;
+}
+
+auto hw_queue::size() const noexcept -> uint32_t {
+    return size_;
+}
+
+auto hw_queue::acquire() const noexcept -> bool {
+    auto expected = false;
+
+    return is_dedicated_ && is_owned_.compare_exchange_strong(expected, true, std::memory_order_acquire);
+}
+
+void hw_queue::release() const noexcept {
+    is_owned_.store(false, std::memory_order_release);
+}
+
 }
 
 #endif
@@ -24,6 +24,13 @@
 #ifdef DML_HW
 
 #include "hardware_definitions.h"
+#include "hw_affinity.hpp"
+
+#ifdef DML_HW_EMULATOR
+#include <memory>
+
+#include "hw_emulated_portal.hpp"
+#endif
 
 namespace dml::ml::dispatcher {
 
@@ -50,12 +57,33 @@ public:
 
     [[nodiscard]] auto get_portal_ptr() const noexcept -> void *;
 
+    /**
+     * @brief Submits a descriptor with ENQCMD, or with MOVDIR64B into a dedicated queue
+     *
+     * Posted MOVDIR64B write is always accepted: the owner of a dedicated queue doesn't submit more descriptors
+     * than @ref size.
+     */
     [[nodiscard]] auto enqueue_descriptor(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t;
 
+    [[nodiscard]] auto is_dedicated() const noexcept -> bool;
+
+    [[nodiscard]] auto size() const noexcept -> uint32_t;
+
+    /**
+     * @brief Makes the calling thread the only submitter of a dedicated queue
+     *
+     * @return false if the queue is owned by another thread
+     */
+    [[nodiscard]] auto acquire() const noexcept -> bool;
+
+    void release() const noexcept;
+
     [[nodiscard]] auto priority() const noexcept -> int32_t;
 
     [[nodiscard]] auto memory_type() const noexcept -> supported_memory_type;
 
+    [[nodiscard]] auto rejections() const noexcept -> const affinity::rejection_tracker &;
+
     void set_portal_ptr(void *portal_ptr) noexcept;
 
     virtual ~hw_queue() noexcept;
@@ -65,8 +93,14 @@ private:
     int32_t                        priority_      = 0u;
     supported_memory_type          memory_type_   = supported_memory_type::non_durable;
     uint64_t                       portal_mask_   = 0u;      /**< Mask for incrementing portals */
+    bool                           is_dedicated_  = false;
+    uint32_t                       size_          = 0u;      /**< Number of descriptors the queue keeps */
+    mutable std::atomic<bool>      is_owned_{false};         /**< Dedicated queue is given to a thread */
     mutable void                   *portal_ptr_   = nullptr;
-    mutable std::atomic<uintptr_t> portal_offset_ = 0u;      /**< Portal for enqcmd (mod page size)*/
+    affinity::rejection_tracker    rejections_;              /**< Retries seen by submitting threads */
+#ifdef DML_HW_EMULATOR
+    std::unique_ptr<hw_emulated_portal> emulated_portal_;   /**< Replaces the portal mapping */
+#endif
 };
 
 }
@@ -14,130 +14,240 @@
  *
  */
 
-#include <array>
+#include <algorithm>
+#include <cctype>
+#include <climits>
 #include <fstream>
-#include <unordered_map>
+#include <string>
+#include <vector>
 
 #if defined(linux)
-    #include <x86intrin.h>
+    #include <cpuid.h>
+    #include <dirent.h>
+    #include <sched.h>
 #endif
 
 #include "numa.hpp"
 
 namespace dml::ml::util {
 
-static constexpr auto get_nodes_configuration() -> std::array<std::pair<const char *, int32_t>, 10> {
-    return {
-            {
-                    {R"(/sys/bus/node/devices/node0/cpulist)", 0},
-                    {R"(/sys/bus/node/devices/node1/cpulist)", 1},
-                    {R"(/sys/bus/node/devices/node2/cpulist)", 2},
-                    {R"(/sys/bus/node/devices/node3/cpulist)", 3},
-                    {R"(/sys/bus/node/devices/node4/cpulist)", 4},
-                    {R"(/sys/bus/node/devices/node5/cpulist)", 5},
-                    {R"(/sys/bus/node/devices/node6/cpulist)", 6},
-                    {R"(/sys/bus/node/devices/node7/cpulist)", 7},
-                    {R"(/sys/bus/node/devices/node8/cpulist)", 8},
-                    {R"(/sys/bus/node/devices/node9/cpulist)", 9}
-            }
-    };
-}
+static constexpr auto nodes_directory = R"(/sys/bus/node/devices/)";
+static constexpr auto local_distance  = 10;
 
-static inline void get_region(std::ifstream &stream,
-                              uint32_t &begin,
-                              uint32_t &end,
-                              bool read_end_splitter = false) {
-    char splitter = '0';
+/**
+ * @brief Parses a kernel cpulist, e.g. "0-3,8-11,16", into the list of CPUs
+ */
+static inline auto parse_cpu_list(const std::string &list) -> std::vector<uint32_t> {
+    std::vector<uint32_t> cpus;
+    std::size_t           position = 0u;
 
-    stream >> begin;
-    stream >> splitter;
-    stream >> end;
+    while (position < list.size()) {
+        const auto range_end = std::min(list.find(',', position), list.size());
+        const auto range     = list.substr(position, range_end - position);
+        const auto splitter  = range.find('-');
 
-    if (read_end_splitter) {
-        stream >> splitter;
-    }
-}
+        position = range_end + 1u;
+
+        if (range.empty() || !std::isdigit(static_cast<unsigned char>(range.front()))) {
+            continue;
+        }
+
+        const auto begin = static_cast<uint32_t>(std::stoul(range));
+        const auto end   = (splitter == std::string::npos)
+                           ? begin
+                           : static_cast<uint32_t>(std::stoul(range.substr(splitter + 1u)));
 
-static inline void update_regions(std::unordered_map<uint32_t, int32_t> &regions,
-                                  uint32_t begin,
-                                  uint32_t end,
-                                  int32_t value) {
-    for (uint32_t i = begin; i <= end; i++) {
-        regions[i] = value;
+        for (auto cpu = begin; cpu <= end; ++cpu) {
+            cpus.push_back(cpu);
+        }
     }
+
+    return cpus;
 }
 
-class numa_configuration {
+/**
+ * @brief System NUMA topology: node of every CPU, CPUs of every node and distances between nodes, read once from sysfs
+ */
+class numa_topology {
 public:
-    numa_configuration(const numa_configuration &other) = delete;
+    numa_topology(const numa_topology &other) = delete;
 
-    auto operator=(const numa_configuration &other) -> numa_configuration & = delete;
+    auto operator=(const numa_topology &other) -> numa_topology & = delete;
 
-    numa_configuration(numa_configuration &&other) = delete;
+    numa_topology(numa_topology &&other) = delete;
 
-    auto operator=(numa_configuration &&other) -> numa_configuration & = delete;
+    auto operator=(numa_topology &&other) -> numa_topology & = delete;
 
-    static auto get_instance() noexcept -> numa_configuration & {
-        static numa_configuration inst{};
+    static auto get_instance() noexcept -> numa_topology & {
+        static numa_topology inst{};
 
         return inst;
     }
 
-    auto operator[](uint32_t cpu_id) noexcept -> int32_t {
-        if (mapping_.find(cpu_id) != mapping_.end()) {
-            return mapping_[cpu_id];
-        } else {
-            return 0;
+    [[nodiscard]] auto node_of(uint32_t cpu_id) const noexcept -> int32_t {
+        // Unknown CPUs go to node 0, as on systems without NUMA information
+        return (cpu_id < cpu_to_node_.size() && cpu_to_node_[cpu_id] >= 0) ? cpu_to_node_[cpu_id] : 0;
+    }
+
+    [[nodiscard]] auto node_count() const noexcept -> uint32_t {
+        return static_cast<uint32_t>(distances_.size());
+    }
+
+    [[nodiscard]] auto cpus_of(int32_t node) const noexcept -> const std::vector<uint32_t> & {
+        static const std::vector<uint32_t> no_cpus{};
+
+        return (node >= 0 && static_cast<uint32_t>(node) < node_to_cpus_.size()) ? node_to_cpus_[node] : no_cpus;
+    }
+
+    [[nodiscard]] auto distance(int32_t from_node, int32_t to_node) const noexcept -> int32_t {
+        if (from_node < 0 || to_node < 0 ||
+            static_cast<uint32_t>(from_node) >= node_count() || static_cast<uint32_t>(to_node) >= node_count()) {
+            return INT32_MAX;
         }
+
+        return distances_[from_node][to_node];
     }
 
 private:
-    numa_configuration() noexcept {
-        constexpr auto node_lists = get_nodes_configuration();
+    numa_topology() noexcept {
+        try {
+            read_topology();
+        } catch (...) {
+            cpu_to_node_.clear();
+            node_to_cpus_.clear();
+            distances_.clear();
+        }
+
+        // A system without NUMA information is a single node one
+        if (distances_.empty()) {
+            distances_.assign(1u, std::vector<int32_t>(1u, local_distance));
+        }
+    }
+
+    void read_topology() {
+#if defined(linux)
+        std::vector<int32_t> nodes;
+
+        if (auto *directory_ptr = opendir(nodes_directory); directory_ptr != nullptr) {
+            while (const auto *entry_ptr = readdir(directory_ptr)) {
+                const std::string name = entry_ptr->d_name;
+
+                if (name.size() > 4u && name.compare(0u, 4u, "node") == 0 &&
+                    std::all_of(name.begin() + 4, name.end(), [](char c) { return std::isdigit(c); })) {
+                    nodes.push_back(std::stoi(name.substr(4u)));
+                }
+            }
+
+            closedir(directory_ptr);
+        }
 
-        for (auto path : node_lists) {
-            std::ifstream file(path.first);
+        if (nodes.empty()) {
+            return;
+        }
+
+        // Distance rows list nodes in ascending order
+        std::sort(nodes.begin(), nodes.end());
+
+        const auto count = static_cast<std::size_t>(nodes.back()) + 1u;
+        distances_.assign(count, std::vector<int32_t>(count, INT32_MAX));
+        node_to_cpus_.resize(count);
+
+        for (auto node : nodes) {
+            const auto node_path = std::string(nodes_directory) + "node" + std::to_string(node) + "/";
 
-            if (!file.is_open()) {
-                continue;
+            std::string   cpu_list;
+            std::ifstream cpu_list_file(node_path + "cpulist");
+            std::getline(cpu_list_file, cpu_list);
+
+            node_to_cpus_[node] = parse_cpu_list(cpu_list);
+
+            for (auto cpu : node_to_cpus_[node]) {
+                if (cpu >= cpu_to_node_.size()) {
+                    cpu_to_node_.resize(cpu + 1u, -1);
+                }
+
+                cpu_to_node_[cpu] = node;
             }
 
-            uint32_t begin = 0;
-            uint32_t end   = 0;
+            std::ifstream distance_file(node_path + "distance");
+            int32_t       value = 0;
 
-            get_region(file, begin, end, true);
-            update_regions(mapping_, begin, end, path.second);
+            for (auto other_node : nodes) {
+                if (!(distance_file >> value)) {
+                    break;
+                }
 
-            get_region(file, begin, end);
-            update_regions(mapping_, begin, end, path.second);
+                distances_[node][other_node] = value;
+            }
+
+            distances_[node][node] = local_distance;
         }
+#endif
     }
 
-    std::unordered_map<uint32_t, int32_t> mapping_;
+    std::vector<int32_t>               cpu_to_node_;  /**< Node of each CPU, -1 for CPUs that are not listed */
+    std::vector<std::vector<uint32_t>> node_to_cpus_; /**< CPUs of each node, empty for absent nodes */
+    std::vector<std::vector<int32_t>>  distances_;    /**< Node distances, INT32_MAX for absent nodes */
 };
 
-auto get_cpu_id() -> uint32_t {
-    uint32_t cpu_id = -1;
-
 #if defined(linux)
-    __rdtscp(&cpu_id);
+static inline bool is_rdpid_supported() noexcept {
+    uint32_t eax = 0u;
+    uint32_t ebx = 0u;
+    uint32_t ecx = 0u;
+    uint32_t edx = 0u;
+
+    // CPUID.(EAX=07H, ECX=0):ECX[bit 22]
+    return __get_cpuid_count(7u, 0u, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 22u));
+}
 #endif
 
-    return cpu_id;
+uint32_t get_cpu_id() noexcept {
+#if defined(linux)
+    static const bool rdpid_supported = is_rdpid_supported();
+
+    if (rdpid_supported) {
+        uint64_t processor_id = 0u;
+
+        // RDPID returns IA32_TSC_AUX, Linux keeps the CPU number in its low 12 bits
+        asm volatile(".byte 0xf3, 0x0f, 0xc7, 0xf8" : "=a"(processor_id));
+
+        return static_cast<uint32_t>(processor_id & 0xfffu);
+    }
+
+    const auto cpu_id = sched_getcpu();
+
+    return (cpu_id < 0) ? 0u : static_cast<uint32_t>(cpu_id);
+#else
+    return 0u;
+#endif
 }
 
 int32_t get_numa_id() noexcept {
 #if defined(linux)
-    static auto &numa_config = numa_configuration::get_instance();
+    static auto &topology = numa_topology::get_instance();
 
-    static thread_local auto cpu_id  = get_cpu_id();
-    static thread_local auto numa_id = numa_config[cpu_id];
-
-    return numa_id;
+    return topology.node_of(get_cpu_id());
 #else
     // Not supported in Windows yet
     return -1;
 #endif
 }
 
+int32_t get_numa_node_of_cpu(uint32_t cpu_id) noexcept {
+    return numa_topology::get_instance().node_of(cpu_id);
+}
+
+const std::vector<uint32_t> &get_numa_node_cpus(int32_t node) noexcept {
+    return numa_topology::get_instance().cpus_of(node);
+}
+
+uint32_t get_numa_node_count() noexcept {
+    return numa_topology::get_instance().node_count();
+}
+
+int32_t get_numa_distance(int32_t from_node, int32_t to_node) noexcept {
+    return numa_topology::get_instance().distance(from_node, to_node);
+}
+
 }
@@ -18,11 +18,48 @@
 #define DML_MIDDLE_LAYER_DISPATCHER_NUMA_HPP_
 
 #include <cstdint>
+#include <vector>
 
 namespace dml::ml::util {
 
+/**
+ * @brief Returns id of the CPU the calling thread runs on right now
+ *
+ * @note Cheap enough to be called on every submission: RDPID when the CPU supports it, getcpu otherwise.
+ */
+uint32_t get_cpu_id() noexcept;
+
+/**
+ * @brief Returns NUMA node of the CPU the calling thread runs on right now
+ *
+ * @note The value isn't cached, so a thread migrated by the scheduler gets its new node.
+ */
 int32_t get_numa_id() noexcept;
 
+/**
+ * @brief Returns the greatest NUMA node id in the system plus one
+ */
+uint32_t get_numa_node_count() noexcept;
+
+/**
+ * @brief Returns NUMA node of the given CPU, 0 for CPUs without NUMA information
+ */
+int32_t get_numa_node_of_cpu(uint32_t cpu_id) noexcept;
+
+/**
+ * @brief Returns CPUs of the given NUMA node, as listed in its sysfs cpulist
+ *
+ * @return Empty list if the node is unknown or the system has no NUMA information
+ */
+const std::vector<uint32_t> &get_numa_node_cpus(int32_t node) noexcept;
+
+/**
+ * @brief Returns distance between two NUMA nodes from the firmware tables (10 means local)
+ *
+ * @return INT32_MAX if one of the nodes is unknown
+ */
+int32_t get_numa_distance(int32_t from_node, int32_t to_node) noexcept;
+
 }
 
 #endif //DML_MIDDLE_LAYER_DISPATCHER_NUMA_HPP_
@@ -43,8 +43,13 @@ namespace dml::ml
          * @param delta_size    Byte size of the memory region with delta record
          * @param dst           Pointer to the destination memory region
          * @param size          Byte size of the memory region
+         * @param format        Format of the delta record, the wide one is applied on CPU by parts in parallel
          */
-        apply_delta(const byte_t *delta_record, size_t delta_size, byte_t *dst, size_t size) noexcept;
+        apply_delta(const byte_t *delta_record,
+                    size_t        delta_size,
+                    byte_t       *dst,
+                    size_t        size,
+                    delta_format  format = delta_format::standard) noexcept;
 
         /**
          * @brief Executes as Apply Delta operation
@@ -17,10 +17,68 @@
 #ifndef DML_AWAITER_HPP
 #define DML_AWAITER_HPP
 
+#include <cstddef>
 #include <cstdint>
 
 namespace dml::ml {
 
+    /**
+     * @brief Power state requested by umwait
+     */
+    enum class umwait_state : uint8_t {
+        automatic, /**< C0.1 while the operation is expected to finish soon, C0.2 after that */
+        c0_1,      /**< Faster wake-up, less power saving */
+        c0_2       /**< Slower wake-up, more power saving */
+    };
+
+    /**
+     * @brief Describes how a thread waits for an operation
+     *
+     * Waiting goes through three stages: spin with pause, umwait on the completion record
+     * (only if the CPU supports WAITPKG) and park with timed futex waits. The last enabled stage lasts
+     * until the operation is finished. Spin stage length is predicted from recent waits for operations of the same size.
+     *
+     * Park stage is entered only for operations predicted to take longer than park_threshold_ns: a thread sleeps
+     * until the predicted completion, then by intervals not longer than 1/8 of the predicted time.
+     *
+     * The default policy is read from DML_WAIT_POLICY environment variable: "spin", "umwait" (no park stage),
+     * "park" (park stage for operations of any duration) or "adaptive". Without the variable it's "adaptive",
+     * umwait stage is enabled only if the library is built with EFFICIENT_WAIT.
+     */
+    struct wait_policy {
+        uint32_t     spin_ns           = 0u;                       /**< Spin stage length, 0 - predicted by size */
+        uint32_t     max_spin_ns       = 20000u;                   /**< Limit of the predicted spin stage length */
+        uint32_t     umwait_ns         = 200000u;                  /**< Umwait stage length, 0 - no umwait stage */
+        uint32_t     park_ns           = 50000u;                   /**< First park interval after the predicted time */
+        uint32_t     max_park_ns       = 1000000u;                 /**< Limit of a park interval */
+        uint32_t     park_threshold_ns = 1000000u;                 /**< Minimal predicted wait time to park, 0 - any */
+        umwait_state state             = umwait_state::automatic;  /**< Power state requested by umwait */
+        bool         predict_spin      = true;                     /**< Predict spin stage length if spin_ns is 0 */
+        bool         park              = true;                     /**< Enables park stage */
+
+        /**
+         * @brief Returns the process default policy
+         */
+        static auto get_default() noexcept -> const wait_policy &;
+
+        /**
+         * @brief Policy that spins until the operation is finished
+         */
+        static auto spin() noexcept -> wait_policy;
+    };
+
+    /**
+     * @brief Counters of finished waits
+     */
+    struct wait_statistics {
+        static constexpr std::size_t histogram_size = 32u;
+
+        uint64_t wait_time_histogram[histogram_size]; /**< Waits by duration: bucket i counts [2^i, 2^(i+1)) ns */
+        uint64_t finished_spinning;                   /**< Waits finished in spin stage */
+        uint64_t finished_in_umwait;                  /**< Waits finished in umwait stage */
+        uint64_t finished_parked;                     /**< Waits finished in park stage */
+    };
+
     /**
      * @brief Class that allows to defer scope exit to the moment when a certain address is changed
      */
@@ -32,22 +90,34 @@ namespace dml::ml {
          *
          * @param address       pointer to memory that should be asynchronously changed
          * @param initial_value value to compare with
-         * @param period        number of clocks between checks
+         * @param policy        how to wait
+         * @param bytes         number of bytes the operation processes, used to predict its duration
          */
         explicit awaiter(volatile void *address,
                          uint8_t initial_value,
-                         uint32_t period = 200) noexcept;
+                         const wait_policy &policy = wait_policy::get_default(),
+                         std::size_t bytes = 0u) noexcept;
 
         /**
          * @brief Destructor that performs actual wait
          */
         ~awaiter() noexcept;
 
+        /**
+         * @brief Returns counters of waits finished since the library load (or the last reset)
+         */
+        static auto get_statistics() noexcept -> wait_statistics;
+
+        /**
+         * @brief Zeroes the wait counters
+         */
+        static void reset_statistics() noexcept;
+
     private:
         volatile uint8_t *address_ptr_  = nullptr;  /**<Pointer to memory that should be asynchronously changed */
-        uint32_t         period_        = 0u;       /**<Number of clocks between checks */
+        const wait_policy *policy_ptr_  = nullptr;  /**<How to wait */
+        std::size_t       bytes_        = 0u;       /**<Number of bytes the operation processes */
         uint8_t          initial_value_ = 0u;       /**<Value to compare with */
-        uint32_t         idle_state_    = 0u;       /**<State for CPU wait control */
     };
 
 }
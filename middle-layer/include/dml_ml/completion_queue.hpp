@@ -0,0 +1,140 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @date 10/18/2026
+ * @brief Contains definitions of @ref dml::ml::completion_queue type
+ */
+
+#ifndef DML_ML_COMPLETION_QUEUE_HPP
+#define DML_ML_COMPLETION_QUEUE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <dml_ml/hardware_path.hpp>
+#include <dml_ml/operation.hpp>
+#include <dml_ml/result.hpp>
+
+namespace dml::ml {
+
+    /**
+     * @brief Harvests completions of many outstanding operations from one thread
+     *
+     * Results of submitted operations are registered with an optional context and callback,
+     * @ref poll scans the registered completion records and reports the finished ones in batches.
+     * Status bytes are kept in a separate array in registration order (that is close to the completion order),
+     * so a scan reads them sequentially and prefetches the records ahead.
+     *
+     * @note The queue isn't thread-safe, it's intended to be driven by a single reactor thread.
+     *       An operation registered with its descriptor is resumed by @ref poll after a page fault
+     *       and reported once the whole operation is finished, other results reporting a page fault are reported
+     *       as they are.
+     */
+    class completion_queue final {
+    public:
+        /**
+         * @brief Type of callback called for a finished operation with its context
+         */
+        using callback_t = void (*)(void *context_ptr);
+
+        /**
+         * @brief Finished operation
+         */
+        struct completion {
+            const result *record_ptr  = nullptr; /**< Result of the operation, nullptr if it wasn't submitted */
+            void         *context_ptr = nullptr; /**< Context passed to @ref add */
+        };
+
+        /**
+         * @brief Registers a result of a submitted operation
+         *
+         * @param record_ptr  Result to watch, nullptr makes the entry finished on the next poll
+         * @param context_ptr Value reported with the completion
+         * @param callback    Function called with the context when the operation is finished, may be nullptr
+         */
+        void add(const result *record_ptr, void *context_ptr = nullptr, callback_t callback = nullptr);
+
+        /**
+         * @brief Registers an operation submitted with @ref hardware_path::submit and its result
+         *
+         * If the operation stops on a page fault, @ref poll resumes it and keeps it registered until the rest
+         * is finished, so the reported result looks as if the operation was executed at once.
+         *
+         * @param op          Submitted operation, it's advanced to the not completed part on resumption
+         * @param record      Result to watch
+         * @param context_ptr Value reported with the completion
+         * @param callback    Function called with the context when the operation is finished, may be nullptr
+         */
+        void add(operation &op, result &record, void *context_ptr = nullptr, callback_t callback = nullptr);
+
+        /**
+         * @brief Reports up to max finished operations and unregisters them, callbacks are called in the same order
+         *
+         * A callback may register new operations, they are checked starting from the next poll.
+         *
+         * @param completions_ptr Array for at least max completions
+         * @param max             Maximal number of completions to report
+         *
+         * @return Number of reported completions
+         */
+        auto poll(completion *completions_ptr, std::size_t max) noexcept -> std::size_t;
+
+        /**
+         * @brief Polls until at least one operation is finished, the queue is empty or timeout expires
+         *
+         * @param completions_ptr Array for at least max completions
+         * @param max             Maximal number of completions to report
+         * @param timeout         Maximal time to wait
+         *
+         * @return Number of reported completions
+         */
+        auto wait(completion *completions_ptr, std::size_t max, std::chrono::nanoseconds timeout) noexcept -> std::size_t;
+
+        /**
+         * @brief Returns number of registered not reported operations
+         */
+        [[nodiscard]] auto size() const noexcept -> std::size_t { return status_ptrs_.size(); }
+
+        /**
+         * @brief Checks if there are no registered operations
+         */
+        [[nodiscard]] auto empty() const noexcept -> bool { return status_ptrs_.empty(); }
+
+    private:
+        struct entry {
+            const result                *record_ptr  = nullptr;
+            void                        *context_ptr = nullptr;
+            callback_t                   callback    = nullptr;
+            operation                   *op_ptr      = nullptr; /**< Resumed after a page fault if set */
+            hardware_path::resume_state  resume      = {};
+        };
+
+        /**
+         * @brief Resumes the operation of a finished entry after a page fault
+         *
+         * @return true if the rest of the operation is in progress, the entry stays registered then
+         */
+        static auto resume(entry &registered) noexcept -> bool;
+
+        std::vector<const volatile byte_t *> status_ptrs_; /**< First bytes of the registered records, scanned by poll */
+        std::vector<entry>                   entries_;     /**< Registered operations, read for finished ones only */
+    };
+
+}
+#endif //DML_ML_COMPLETION_QUEUE_HPP
@@ -51,6 +51,23 @@ namespace dml::ml
          */
         void operator()() const noexcept;
 
+        /**
+         * @brief Returns CRC of two adjacent memory regions computed from CRC values of the regions
+         *
+         * Works for Copy with CRC values too.
+         *
+         * @param first_crc    CRC of the first region, computed with any seed
+         * @param second_crc   CRC of the second region, computed with zero seed
+         * @param second_size  Byte size of the second region
+         * @param parameters   Parameters the both values are computed with
+         *
+         * @return CRC of the both regions, computed with the seed of the first one
+         */
+        static auto combine(uint32_t       first_crc,
+                            uint32_t       second_crc,
+                            uint64_t       second_size,
+                            crc_parameters parameters) noexcept -> uint32_t;
+
         /**
          * @brief Provides polymorphic behavior via casting to @ref operation base class
          *
@@ -44,12 +44,14 @@ namespace dml::ml
          * @param size            Byte size of the the memory regions
          * @param delta_record    Pointer to the memory region for delta record
          * @param delta_max_size  Byte size of the delta record memory region
+         * @param format          Format of the delta record, the wide one is created on CPU by parts in parallel
          */
         create_delta(const byte_t *src1,
                      const byte_t *src2,
                      size_t        size,
                      byte_t *      delta_record,
-                     size_t        delta_max_size) noexcept;
+                     size_t        delta_max_size,
+                     delta_format  format = delta_format::standard) noexcept;
 
         /**
          * @brief Executes as Create Delta operation
@@ -25,6 +25,7 @@
 #include <dml_ml/operation.hpp>
 #include <dml_ml/result.hpp>
 
+#include <cstdint>
 #include <type_traits>
 
 namespace dml::ml
@@ -39,6 +40,12 @@ namespace dml::ml
         /**
          * @brief Submits an operation onto a dedicated hardware
          *
+         * Memory move (without overlapping), fill, dualcast, CRC, copy with CRC, compare, compare with pattern
+         * and cache flush bigger than the maximal transfer size of a device, or not smaller than
+         * the DML_STRIPE_THRESHOLD environment variable (4 MB by default) when several work queues are available,
+         * are split into page-aligned parts executed on all local work queues. Parts are combined into
+         * the result, like if the operation was executed at once.
+         *
          * @param op   Any operation
          * @param res  Reference to result instance
          *
@@ -46,6 +53,82 @@ namespace dml::ml
          *      - @ref status_code::ok if execution is started, an error code otherwise
          */
         static status_code submit(operation op, result& res) noexcept;
+
+        /**
+         * @brief Waits for an operation submitted with @ref submit to finish
+         *
+         * Hardware stops on a not present page and reports partial completion, in this case the rest
+         * of the operation is resubmitted after touching the page or completed on CPU.
+         * The result looks as if the operation was executed at once.
+         *
+         * @param op     Operation passed to @ref submit
+         * @param res    Reference to its result instance, it's written by the device like with @ref result::wait
+         * @param policy How to wait, see @ref wait_policy
+         */
+        static void wait(const operation &op,
+                         const result &res,
+                         const wait_policy &policy = wait_policy::get_default()) noexcept;
+
+        /**
+         * @brief Progress of an operation resumed after page faults, see @ref resume
+         */
+        struct resume_state
+        {
+            uint32_t completed_bytes = 0u; /**< Bytes completed before the last resumption */
+            uint32_t resubmissions   = 0u; /**< Times the rest of the operation was resubmitted */
+        };
+
+        /**
+         * @brief Resumes an operation stopped by a page fault without waiting for the rest of it
+         *
+         * The rest is resubmitted to a device, or completed on CPU if it's resubmitted too many times
+         * or the queues are full. Once the result is final, its offsets are made relative to the whole operation.
+         * A result without a page fault is final as is.
+         *
+         * @param op    Operation passed to @ref submit, it's advanced to the not completed part
+         * @param res   Its finished result
+         * @param state Progress kept between calls for the same operation, zero-initialized for the first call
+         *
+         * @return true if the rest is executed by a device and the result should be polled again,
+         *         false if the result is final
+         */
+        static bool resume(operation &op, result &res, resume_state &state) noexcept;
+
+        /**
+         * @brief Registers the calling thread as a submitter with a dedicated work queue
+         *
+         * Operations of the thread are submitted into the queue with MOVDIR64B, which avoids the non-posted
+         * round trip of ENQCMD. The thread tracks the queue occupancy with Drain descriptors of its own
+         * and uses shared queues while the dedicated one is full. A queue of a device local to the thread
+         * is preferred. Results of the operations may be waited for on any thread.
+         *
+         * @return true if a dedicated queue is given to the thread (or it already has one),
+         *         false if all dedicated queues are owned by other threads
+         */
+        static bool register_dedicated_submitter() noexcept;
+
+        /**
+         * @brief Returns the dedicated work queue of the calling thread, it's also done at the thread exit
+         *
+         * Waits until the operations submitted into the queue are finished.
+         */
+        static void unregister_dedicated_submitter() noexcept;
+
+        /**
+         * @brief Counters of operations resumed after page faults
+         */
+        struct page_fault_statistics
+        {
+            uint64_t resumed_on_hardware; /**< Times the rest of an operation was resubmitted to hardware */
+            uint64_t completed_on_cpu;    /**< Times the rest of an operation was completed on CPU        */
+        };
+
+        /**
+         * @brief Returns counters of operations resumed after page faults since the library load
+         *
+         * @note Counters are shared with the C API jobs
+         */
+        static page_fault_statistics get_page_fault_statistics() noexcept;
     };
 }  // namespace dml::ml
 
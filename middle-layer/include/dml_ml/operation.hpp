@@ -66,6 +66,13 @@ namespace dml::ml
          */
         void associate(result& record) noexcept;
 
+        /**
+         * @brief Makes the operation wait for completion of all previous operations of a batch
+         *
+         * Operations between fences may be executed in parallel.
+         */
+        void set_fence() noexcept;
+
         /**
          * @brief Returns raw pointer to the underlying data array
          *
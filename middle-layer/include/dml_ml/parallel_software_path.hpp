@@ -0,0 +1,89 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @date 10/18/2026
+ * @brief Contains definitions of @ref dml::ml::parallel_software_path type
+ */
+
+#ifndef DML_ML_PARALLEL_SOFTWARE_PATH_HPP
+#define DML_ML_PARALLEL_SOFTWARE_PATH_HPP
+
+#include <dml_ml/operation.hpp>
+#include <dml_ml/result.hpp>
+
+#include <cstddef>
+
+namespace dml::ml
+{
+    /**
+     * @ingroup dmlml_execution_paths
+     * @brief Defines functions related to parallel software execution path
+     *
+     * An operation is split into chunks with boundaries aligned to cache lines of the written memory
+     * (of the read one for operations without destination). Chunks are executed by the software kernels
+     * on @ref thread_pool workers and the calling thread, their results are merged into one:
+     *  - the first failed chunk, or the first mismatched one for comparisons, is reported
+     *    with offsets relative to the whole operation, the following chunks are skipped;
+     *  - CRC values of the chunks are combined with @ref crc::combine().
+     *
+     * Operations that can't be split (overlapping Memory Move, Delta Record operations and Batch) are executed
+     * as a whole, wide Delta Records are created and applied by parts in parallel anyway.
+     *
+     * Tuning:
+     *  - chunk size, 1 MB by default or the value of DML_PARALLEL_CHUNK_SIZE environment variable;
+     *  - parallelism (number of threads executing chunks of an operation), number of the pool workers
+     *    plus the caller by default or the value of DML_PARALLEL_THREADS environment variable.
+     */
+    struct parallel_software_path
+    {
+        /**
+         * @brief Executes operation on several CPU cores, returns after it's completed
+         *
+         * @param op  Operation
+         * @param res Reference to result instance
+         *
+         * @return Status code which is always successful
+         */
+        static status_code submit(operation op, result &res) noexcept;
+
+        /**
+         * @brief Sets number of bytes in a chunk, it's rounded up to a multiple of 4 KB
+         *
+         * @param chunk_size Number of bytes, 0 restores the default
+         */
+        static void set_chunk_size(std::size_t chunk_size) noexcept;
+
+        /**
+         * @brief Returns number of bytes in a chunk
+         */
+        static auto get_chunk_size() noexcept -> std::size_t;
+
+        /**
+         * @brief Sets maximal number of threads executing chunks of an operation, including the caller
+         *
+         * @param parallelism Number of threads, 0 restores the default
+         */
+        static void set_parallelism(std::size_t parallelism) noexcept;
+
+        /**
+         * @brief Returns maximal number of threads executing chunks of an operation
+         */
+        static auto get_parallelism() noexcept -> std::size_t;
+    };
+}  // namespace dml::ml
+
+#endif  //DML_ML_PARALLEL_SOFTWARE_PATH_HPP
@@ -52,6 +52,16 @@ namespace dml::ml {
             awaiter wait_for(static_cast<volatile void *>(data_), 0);
         }
 
+        /**
+         * @brief Blocks execution until result is written and ready for extraction
+         *
+         * @param policy how to wait
+         * @param bytes  number of bytes the operation processes, used to predict its duration
+         */
+        void wait(const wait_policy &policy, std::size_t bytes) const volatile noexcept {
+            awaiter wait_for(static_cast<volatile void *>(data_), 0, policy, bytes);
+        }
+
         /**
          * @brief Checks whether status written is a success one
          *
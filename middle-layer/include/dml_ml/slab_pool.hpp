@@ -0,0 +1,68 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @date 10/18/2026
+ * @brief Contains definitions of @ref dml::ml::slab_pool type
+ */
+
+#ifndef DML_ML_SLAB_POOL_HPP
+#define DML_ML_SLAB_POOL_HPP
+
+#include <cstddef>
+
+namespace dml::ml {
+
+    /**
+     * @brief Process-wide pool of small fixed-size blocks, used for completion records
+     *
+     * Blocks are 32 or 64 bytes and aligned to their size. Each thread keeps two magazines (arrays of free blocks)
+     * per block size, so allocation and deallocation don't synchronize, a block may be freed by any thread.
+     * Full and empty magazines are exchanged with a lock-free depot shared by all threads.
+     * Memory is never returned to the system, the pool size is bounded by the peak number of blocks in use.
+     */
+    class slab_pool final {
+    public:
+        /**
+         * @brief Smaller block size, fits @ref result
+         */
+        static constexpr std::size_t small_block_size = 32u;
+
+        /**
+         * @brief Bigger block size, a cache line
+         */
+        static constexpr std::size_t large_block_size = 64u;
+
+        /**
+         * @brief Allocates a block
+         *
+         * @param block_size @ref small_block_size or @ref large_block_size
+         *
+         * @return Block aligned to its size, nullptr if there's no memory
+         */
+        static auto allocate(std::size_t block_size) noexcept -> void *;
+
+        /**
+         * @brief Returns a block into the pool, it may be allocated by another thread
+         *
+         * @param block_ptr  Block returned by @ref allocate
+         * @param block_size Size the block was allocated with
+         */
+        static void deallocate(void *block_ptr, std::size_t block_size) noexcept;
+    };
+}
+
+#endif  //DML_ML_SLAB_POOL_HPP
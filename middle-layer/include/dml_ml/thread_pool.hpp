@@ -0,0 +1,139 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @date 10/18/2026
+ * @brief Contains definitions of @ref dml::ml::thread_pool type
+ */
+
+#ifndef DML_ML_THREAD_POOL_HPP
+#define DML_ML_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace dml::ml {
+
+    /**
+     * @brief Process-wide pool of worker threads with per-worker deques and work stealing
+     *
+     * Workers are started lazily on the first access to the instance, one per available CPU.
+     * Each worker is pinned to the CPUs of its NUMA node, a submit from an outside thread goes
+     * to a worker on the submitter's node, while a submit from a worker goes to its own deque.
+     * Idle workers steal from the front of the other deques, same node first.
+     */
+    class thread_pool final {
+    public:
+        /**
+         * @brief Type of task executed by the pool
+         */
+        using task_t = std::function<void()>;
+
+        /**
+         * @brief Snapshot of the pool counters
+         */
+        struct statistics {
+            std::size_t workers     = 0u; /**< Number of worker threads */
+            std::size_t queue_depth = 0u; /**< Number of tasks waiting in all deques */
+            uint64_t    submitted   = 0u; /**< Number of tasks pushed into the pool */
+            uint64_t    executed    = 0u; /**< Number of tasks completed by workers */
+            uint64_t    steals      = 0u; /**< Number of tasks taken from another worker's deque */
+        };
+
+        thread_pool(const thread_pool &other) = delete;
+
+        auto operator=(const thread_pool &other) -> thread_pool & = delete;
+
+        thread_pool(thread_pool &&other) = delete;
+
+        auto operator=(thread_pool &&other) -> thread_pool & = delete;
+
+        /**
+         * @brief Destructor that lets the workers drain all queued tasks and joins them
+         */
+        ~thread_pool() noexcept;
+
+        /**
+         * @brief Returns the process-wide pool, starting the workers on the first call
+         */
+        static auto get_instance() -> thread_pool &;
+
+        /**
+         * @brief Pushes a task into one of the worker deques
+         *
+         * @param task Instance of a callable task
+         */
+        void submit(task_t task);
+
+        /**
+         * @brief Calls the body for every index in [0, count) on the workers and the calling thread
+         *
+         * The caller takes indices too, so the call completes even if all workers are busy
+         * or the caller is a worker itself. Returns when all indices are processed.
+         *
+         * @param count Number of indices
+         * @param body  Callable invoked once per index
+         */
+        void parallel_for(std::size_t count, const std::function<void(std::size_t)> &body) noexcept;
+
+        /**
+         * @brief Returns number of worker threads
+         */
+        [[nodiscard]] auto size() const noexcept -> std::size_t;
+
+        /**
+         * @brief Returns number of tasks waiting for execution
+         */
+        [[nodiscard]] auto queue_depth() const noexcept -> std::size_t;
+
+        /**
+         * @brief Returns number of tasks taken by a worker from another worker's deque
+         */
+        [[nodiscard]] auto steal_count() const noexcept -> uint64_t;
+
+        /**
+         * @brief Returns a snapshot of the pool counters
+         */
+        [[nodiscard]] auto get_statistics() const noexcept -> statistics;
+
+    private:
+        struct worker;
+
+        thread_pool();
+
+        void run(std::size_t index) noexcept;
+
+        auto try_pop(std::size_t index, task_t &task) noexcept -> bool;
+
+        auto try_steal(std::size_t index, task_t &task) noexcept -> bool;
+
+        std::vector<std::unique_ptr<worker>> workers_;          /**< Worker threads and their deques */
+        std::mutex                           sleep_mutex_;      /**< Guards idle workers sleep */
+        std::condition_variable              wake_condition_;   /**< Wakes idle workers up */
+        std::atomic<std::size_t>             pending_{0u};      /**< Number of queued tasks */
+        std::atomic<std::size_t>             next_worker_{0u};  /**< Round-robin position for outside submits */
+        std::atomic<uint64_t>                submitted_{0u};    /**< Number of submitted tasks */
+        std::atomic<bool>                    stop_{false};      /**< Shutdown request */
+    };
+
+}
+#endif //DML_ML_THREAD_POOL_HPP
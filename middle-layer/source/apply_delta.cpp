@@ -15,13 +15,18 @@
  */
 
 #include "own/definitions.hpp"
+#include "own/parts.hpp"
 #include "own/types.hpp"
 
 #include <dml_ml/apply_delta.hpp>
 #include <dml_ml/result.hpp>
+#include <dml_ml/thread_pool.hpp>
 
 #include <core_api.h>
 
+#include <algorithm>
+#include <atomic>
+
 namespace dml::ml
 {
     DML_PACKED_STRUCT_DECLARATION_BEGIN(apply_delta_descriptor)
@@ -33,10 +38,12 @@ namespace dml::ml
         result *      completion_record_ptr{};    /**< Pointer to the completion record space */
         const byte_t *delta_record{};             /**< Pointer to the source 1 */
         byte_t *      destination{};              /**< Pointer to the destination */
-        size_t        transfer_size{};            /**< Count of bytes to copy */
+        uint32_t      transfer_size{};            /**< Count of bytes to copy */
         byte_t        reserved_memory1[4]{};      /**< Not used bytes in the descriptor */
-        size_t        delta_size{};               /**< Max size for delta record */
-        byte_t        reserved_memory2[10]{};     /**< Not used bytes in the descriptor */
+        uint32_t      delta_size{};               /**< Max size for delta record */
+        uint32_t      delta_size_high{};          /**< High 32 bits of the delta record size, software only */
+        byte_t        reserved_memory2[12]{};     /**< Not used bytes in the descriptor */
+        uint32_t      transfer_size_high{};       /**< High 32 bits of the count, software only */
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
@@ -51,10 +58,52 @@ namespace dml::ml
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
+    /**
+     * @brief Number of notes a task applies, when a wide record is applied
+     */
+    static constexpr uint32_t wide_delta_part_notes = 64u * 1024u;
+
+    /**
+     * @brief Applies a wide delta record by parts of the record, in parallel on the thread pool
+     *
+     * Offsets of the notes are absolute, so parts of the record are independent
+     * as long as the offsets are increasing, which is the case for created records.
+     *
+     * @return Core status of the first failed part
+     */
+    static auto own_apply_wide_delta(byte_t *dst, const byte_t *delta_record, uint64_t size, uint64_t delta_size)
+        noexcept -> dmlc_status_t
+    {
+        const auto part_size   = uint64_t(wide_delta_part_notes) * DML_WIDE_DELTA_NOTE_SIZE;
+        const auto parts_count = (delta_size + part_size - 1u) / part_size;
+
+        if (parts_count <= 1u)
+        {
+            return dmlc_apply_wide_delta_record_8u(dst, delta_record, size, static_cast<uint32_t>(delta_size));
+        }
+
+        std::atomic<dmlc_status_t> status{DML_STATUS_OK};
+
+        thread_pool::get_instance().parallel_for(parts_count, [&](std::size_t i)
+        {
+            const auto offset      = static_cast<uint64_t>(i) * part_size;
+            const auto notes_size  = static_cast<uint32_t>(std::min(part_size, delta_size - offset));
+            const auto part_status = dmlc_apply_wide_delta_record_8u(dst, delta_record + offset, size, notes_size);
+
+            if (part_status != DML_STATUS_OK)
+            {
+                status.store(part_status, std::memory_order_relaxed);
+            }
+        });
+
+        return status.load(std::memory_order_relaxed);
+    }
+
     apply_delta::apply_delta(const byte_t *delta_record,
                              const size_t  delta_size,
                              byte_t       *dst,
-                             const size_t  size) noexcept:
+                             const size_t  size,
+                             delta_format  format) noexcept:
         operation_()
     {
         auto &descriptor = *reinterpret_cast<apply_delta_descriptor *>(operation_.data());
@@ -62,10 +111,17 @@ namespace dml::ml
         descriptor.operation_type = hw_operation::apply_delta;
         descriptor.general_flags  = hw_option::cache_control;
 
-        descriptor.delta_record  = delta_record;
-        descriptor.destination   = dst;
-        descriptor.transfer_size = size;
-        descriptor.delta_size    = delta_size;
+        descriptor.delta_record       = delta_record;
+        descriptor.destination        = dst;
+        descriptor.transfer_size      = static_cast<uint32_t>(size);
+        descriptor.transfer_size_high = static_cast<uint32_t>(size >> 32u);
+        descriptor.delta_size         = static_cast<uint32_t>(delta_size);
+        descriptor.delta_size_high    = static_cast<uint32_t>(delta_size >> 32u);
+
+        if (format == delta_format::wide)
+        {
+            descriptor.operation_specific_flags = to_underlying(delta_option::wide_record);
+        }
     }
 
     void apply_delta::operator()() const noexcept
@@ -73,11 +129,21 @@ namespace dml::ml
         auto dsc    = reinterpret_cast<const apply_delta_descriptor *>(operation_.data());
         auto record = reinterpret_cast<apply_delta_completion_record *>(dsc->completion_record_ptr);
 
-        // No fail expected due to range check before
+        const auto is_wide = (dsc->operation_specific_flags & to_underlying(delta_option::wide_record)) != 0u;
+
+        const auto size       = join_halves(dsc->transfer_size, dsc->transfer_size_high);
+        const auto delta_size = join_halves(dsc->delta_size, dsc->delta_size_high);
+
+        // No fail expected due to range check before, offsets of the narrow record limit the size far below 4 GiB
         auto status =
-            dmlc_apply_delta_record_8u(dsc->destination, dsc->delta_record, dsc->transfer_size, dsc->delta_size);
+            is_wide ? own_apply_wide_delta(dsc->destination, dsc->delta_record, size, delta_size)
+                    : dmlc_apply_delta_record_8u(dsc->destination, dsc->delta_record, dsc->transfer_size, dsc->delta_size);
 
-        if (status != DML_STATUS_OK)
+        if (is_wide && status == DML_STATUS_MEMORY_OVERFLOW_ERROR)
+        {
+            record->status = hw_status::offset_overflow;
+        }
+        else if (status != DML_STATUS_OK)
         {
             record->status = hw_status::internal_error;
         }
@@ -14,9 +14,21 @@
  *
  */
 
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
 #include <dml_ml/awaiter.hpp>
 
 #if defined(linux)
+#include <cpuid.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #include <x86intrin.h>
 #else
 #include <intrin.h>
@@ -25,11 +37,60 @@
 
 namespace dml::ml {
 
-#ifdef DML_EFFICIENT_WAIT
-    static inline uint64_t current_time() {
-        return __rdtsc();
+    using clock_type = std::chrono::steady_clock;
+
+    // Number of operation size classes for wait time prediction, class is log2 of the operation size
+    static constexpr auto size_classes_count = 64u;
+
+    // Length of a single umwait in TSC ticks, the clock is checked between them
+    static constexpr uint64_t umwait_ticks = 10000u;
+
+    // Spin stage checks the clock once per this number of pauses
+    static constexpr auto pauses_per_clock_check = 16u;
+
+    static std::atomic<uint64_t> predicted_wait_ns[size_classes_count]{};
+    static std::atomic<uint64_t> wait_time_histogram[wait_statistics::histogram_size]{};
+    static std::atomic<uint64_t> finished_spinning{0u};
+    static std::atomic<uint64_t> finished_in_umwait{0u};
+    static std::atomic<uint64_t> finished_parked{0u};
+
+    static inline auto log2_floor(uint64_t value) noexcept -> uint32_t {
+        uint32_t result = 0u;
+
+        while (value > 1u) {
+            value >>= 1u;
+            ++result;
+        }
+
+        return result;
     }
 
+    static inline auto elapsed_ns(clock_type::time_point start) noexcept -> uint64_t {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start).count());
+    }
+
+    /**
+     * @brief Checks CPUID.(EAX=7, ECX=0):ECX.WAITPKG, the result is computed once
+     */
+    static auto is_umwait_supported() noexcept -> bool {
+#if defined(__GNUC__)
+        static const bool is_supported = []() {
+            unsigned int eax = 0u, ebx = 0u, ecx = 0u, edx = 0u;
+
+            if (__get_cpuid_count(7u, 0u, &eax, &ebx, &ecx, &edx) == 0) {
+                return false;
+            }
+
+            return (ecx & (1u << 5u)) != 0u;
+        }();
+
+        return is_supported;
+#else
+        return false;
+#endif
+    }
+
+#if defined(__GNUC__)
     static inline void monitor_address(volatile void *address) {
         asm volatile(".byte 0xf3, 0x48, 0x0f, 0xae, 0xf0" : : "a"(address));
     }
@@ -48,27 +109,215 @@ namespace dml::ml {
     }
 #endif
 
+    /**
+     * @brief Sleeps until the word containing the address is changed or the timeout expires
+     *
+     * The device writes memory and never wakes futex waiters, so the wait is always timed.
+     */
+    static void park(volatile uint8_t *address, uint8_t initial_value, uint64_t timeout_ns) noexcept {
+#if defined(linux)
+        auto *word_ptr = reinterpret_cast<volatile uint32_t *>(reinterpret_cast<uintptr_t>(address) & ~uintptr_t(3u));
+        auto expected  = *word_ptr;
+
+        if (initial_value != *address) {
+            return;
+        }
+
+        struct timespec timeout {};
+        timeout.tv_sec  = static_cast<time_t>(timeout_ns / 1000000000u);
+        timeout.tv_nsec = static_cast<long>(timeout_ns % 1000000000u);
+
+        syscall(SYS_futex, const_cast<uint32_t *>(word_ptr), FUTEX_WAIT_PRIVATE, expected, &timeout, nullptr, 0);
+#else
+        (void) address;
+        (void) initial_value;
+
+        std::this_thread::sleep_for(std::chrono::nanoseconds(timeout_ns));
+#endif
+    }
+
+    /**
+     * @brief Reads the default policy from DML_WAIT_POLICY environment variable
+     */
+    static auto read_default_policy() noexcept -> wait_policy {
+        wait_policy policy{};
+        const char *name_ptr = std::getenv("DML_WAIT_POLICY");
+
+#ifndef DML_EFFICIENT_WAIT
+        // umwait is used by default only if the library is built with EFFICIENT_WAIT
+        if (name_ptr == nullptr) {
+            policy.umwait_ns = 0u;
+        }
+#endif
+
+        if (name_ptr == nullptr) {
+            return policy;
+        }
+
+        if (std::strcmp(name_ptr, "spin") == 0) {
+            policy = wait_policy::spin();
+        } else if (std::strcmp(name_ptr, "umwait") == 0) {
+            policy.park = false;
+        } else if (std::strcmp(name_ptr, "park") == 0) {
+            policy.park_threshold_ns = 0u;
+        }
+
+        return policy;
+    }
+
+    auto wait_policy::get_default() noexcept -> const wait_policy & {
+        static const wait_policy policy = read_default_policy();
+
+        return policy;
+    }
+
+    auto wait_policy::spin() noexcept -> wait_policy {
+        wait_policy policy{};
+        policy.umwait_ns = 0u;
+        policy.park      = false;
+
+        return policy;
+    }
+
     awaiter::awaiter(volatile void *address,
                      uint8_t initial_value,
-                     uint32_t period) noexcept
+                     const wait_policy &policy,
+                     std::size_t bytes) noexcept
             : address_ptr_(reinterpret_cast<volatile uint8_t *>(address)),
-              period_(period),
+              policy_ptr_(&policy),
+              bytes_(bytes),
               initial_value_(initial_value) {
         // Empty constructor
     }
 
     awaiter::~awaiter() noexcept {
-#ifdef DML_EFFICIENT_WAIT
-        while (initial_value_ == *address_ptr_) {
-            monitor_address(address_ptr_);
+        const auto &policy      = *policy_ptr_;
+        const auto start        = clock_type::now();
+        const auto size_class   = log2_floor(bytes_);
+        const auto predicted_ns = predicted_wait_ns[size_class].load(std::memory_order_relaxed);
+        const auto use_umwait   = policy.umwait_ns != 0u && is_umwait_supported();
+
+        // Parking costs a wake-up latency, it's worth it for long operations only
+        const auto use_park = policy.park && (policy.park_threshold_ns == 0u ||
+                                              (predicted_ns != 0u && predicted_ns >= policy.park_threshold_ns));
+
+        // Spin for a bit longer than the operation usually takes. Operations that usually take longer than
+        // the spin limit aren't worth spinning for: the thread spins shortly and goes to the next stage.
+        uint64_t spin_ns = policy.spin_ns;
 
-            auto start = current_time();
-            wait_until(start + period_, idle_state_);
+        if (spin_ns == 0u && policy.predict_spin) {
+            if (predicted_ns == 0u) {
+                spin_ns = policy.max_spin_ns;
+            } else if (predicted_ns <= policy.max_spin_ns) {
+                spin_ns = std::min<uint64_t>(predicted_ns + predicted_ns / 4u, policy.max_spin_ns);
+            } else {
+                spin_ns = policy.max_spin_ns / 8u;
+            }
         }
-#else
-        while (initial_value_ == *address_ptr_) {
+
+        const auto is_last_stage = !use_umwait && !use_park;
+        auto      *finished_in   = &finished_spinning;
+
+        // Spin stage
+        for (uint32_t i = 0u; initial_value_ == *address_ptr_; ++i) {
             _mm_pause();
+
+            if (!is_last_stage && i % pauses_per_clock_check == 0u && elapsed_ns(start) >= spin_ns) {
+                finished_in = use_umwait ? &finished_in_umwait : &finished_parked;
+                break;
+            }
+        }
+
+#if defined(__GNUC__)
+        // Umwait stage
+        if (use_umwait && initial_value_ == *address_ptr_) {
+            const auto umwait_end_ns = spin_ns + policy.umwait_ns;
+
+            while (initial_value_ == *address_ptr_) {
+                const auto now_ns = elapsed_ns(start);
+
+                if (use_park && now_ns >= umwait_end_ns) {
+                    finished_in = &finished_parked;
+                    break;
+                }
+
+                auto is_light = policy.state == umwait_state::c0_1 ||
+                                (policy.state == umwait_state::automatic && now_ns < 2u * predicted_ns);
+
+                monitor_address(address_ptr_);
+
+                if (initial_value_ == *address_ptr_) {
+                    // Bit 0 of the state selects C0.1
+                    wait_until(__rdtsc() + umwait_ticks, is_light ? 1u : 0u);
+                }
+            }
         }
 #endif
+
+        // Park stage: sleep until the predicted completion, then by intervals short relative to the operation,
+        // so that the thread doesn't oversleep the completion by much more than the operation takes.
+        // The last moment the operation was seen unfinished is kept: the completion happened after it.
+        uint64_t unfinished_ns = 0u;
+
+        if (initial_value_ == *address_ptr_) {
+            const auto max_interval_ns = (predicted_ns == 0u)
+                                         ? uint64_t(policy.max_park_ns)
+                                         : std::clamp<uint64_t>(predicted_ns / 8u, 1u, policy.max_park_ns);
+            auto       interval_ns     = std::min<uint64_t>(std::max<uint32_t>(policy.park_ns, 1u), max_interval_ns);
+
+            while (initial_value_ == *address_ptr_) {
+                unfinished_ns = elapsed_ns(start);
+
+                if (unfinished_ns < predicted_ns) {
+                    const auto remaining_ns = predicted_ns - unfinished_ns;
+
+                    park(address_ptr_, initial_value_, std::min<uint64_t>(remaining_ns, policy.max_park_ns));
+                } else {
+                    park(address_ptr_, initial_value_, interval_ns);
+                    interval_ns = std::min<uint64_t>(2u * interval_ns, max_interval_ns);
+                }
+            }
+        }
+
+        // Statistics and prediction
+        const auto wait_ns = elapsed_ns(start);
+        const auto bucket  = std::min<uint32_t>(log2_floor(wait_ns), wait_statistics::histogram_size - 1u);
+
+        wait_time_histogram[bucket].fetch_add(1u, std::memory_order_relaxed);
+        finished_in->fetch_add(1u, std::memory_order_relaxed);
+
+        // Prediction is fed with the operation duration rather than with the wait time: the operation completed
+        // during the last park, the middle of it is taken. Otherwise oversleeping would make next waits park longer.
+        const auto duration_ns = (unfinished_ns != 0u) ? unfinished_ns + (wait_ns - unfinished_ns) / 2u : wait_ns;
+
+        // Exponential moving average with 1/8 weight, concurrent updates may lose a sample, it's fine
+        const auto new_prediction = (predicted_ns == 0u)
+                                    ? duration_ns
+                                    : predicted_ns - predicted_ns / 8u + duration_ns / 8u;
+        predicted_wait_ns[size_class].store(std::max<uint64_t>(new_prediction, 1u), std::memory_order_relaxed);
+    }
+
+    auto awaiter::get_statistics() noexcept -> wait_statistics {
+        wait_statistics statistics{};
+
+        for (std::size_t i = 0u; i < wait_statistics::histogram_size; ++i) {
+            statistics.wait_time_histogram[i] = wait_time_histogram[i].load(std::memory_order_relaxed);
+        }
+
+        statistics.finished_spinning  = finished_spinning.load(std::memory_order_relaxed);
+        statistics.finished_in_umwait = finished_in_umwait.load(std::memory_order_relaxed);
+        statistics.finished_parked    = finished_parked.load(std::memory_order_relaxed);
+
+        return statistics;
+    }
+
+    void awaiter::reset_statistics() noexcept {
+        for (auto &bucket : wait_time_histogram) {
+            bucket.store(0u, std::memory_order_relaxed);
+        }
+
+        finished_spinning.store(0u, std::memory_order_relaxed);
+        finished_in_umwait.store(0u, std::memory_order_relaxed);
+        finished_parked.store(0u, std::memory_order_relaxed);
     }
 }
@@ -19,6 +19,7 @@
 
 #include <dml_ml/batch.hpp>
 #include <dml_ml/result.hpp>
+#include <dml_ml/thread_pool.hpp>
 
 #include <core_api.h>
 
@@ -33,7 +34,7 @@ namespace dml::ml
         result *         completion_record_address{}; /**< Pointer to the completion record space */
         const operation *source{};                    /**< Pointer to the destination */
         byte_t           reserved_memory1[8]{};       /**< Not used bytes in the descriptor */
-        size_t           operation_count{};           /**< Count of bytes to copy */
+        uint32_t         operation_count{};           /**< Count of bytes to copy */
         byte_t           reserved_memory2[28]{};      /**< Not used bytes in the descriptor */
     };
     DML_PACKED_STRUCT_DECLARATION_END
@@ -42,7 +43,7 @@ namespace dml::ml
     {
         hw_status status{};                /**< Status of the executed task: success or some Error */
         uint8_t   reserved_1[3]{};         /**< Reserved bytes                                     */
-        uint32_t  descriptors_completed{}; /**< Count of processed elements (bytes, words and etc.)*/
+        uint32_t  descriptors_completed{}; /**< Count of successfully completed operations          */
         byte_t *  fault_address{};         /**< Address of Page Fault */
         uint8_t   reserved_2[16]{};        /**< Reserved bytes        */
     };
@@ -58,28 +59,71 @@ namespace dml::ml
         descriptor.operation_count = operation_count;
     }
 
+    /**
+     * @brief Returns completion record of an operation, it's fine to access it through any type of descriptor
+     */
+    static inline auto own_get_record(const operation &op) noexcept -> const result *
+    {
+        return reinterpret_cast<const batch_descriptor *>(op.data())->completion_record_address;
+    }
+
+    /**
+     * @brief Checks if an operation waits for completion of all previous operations of the batch
+     */
+    static inline auto own_is_fenced(const operation &op) noexcept -> bool
+    {
+        return any(reinterpret_cast<const batch_descriptor *>(op.data())->general_flags, hw_option::fence);
+    }
+
     void batch::operator()() const noexcept
     {
         auto dsc    = reinterpret_cast<const batch_descriptor *>(operation_.data());
         auto record = reinterpret_cast<batch_completion_record *>(dsc->completion_record_address);
 
-        for (auto i = 0u; i < dsc->operation_count; ++i)
+        const auto count     = dsc->operation_count;
+        uint32_t   completed = 0u;
+        bool       is_failed = false;
+
+        // Operations between fences are independent and executed in parallel, as a device does.
+        // A fenced operation and the following ones are abandoned if anything before it has failed
+        for (uint32_t begin = 0u; begin < count && !is_failed;)
         {
-            dsc->source[i].operator()();
+            auto end = begin + 1u;
+
+            while (end < count && !own_is_fenced(dsc->source[end]))
+            {
+                ++end;
+            }
+
+            if (end - begin == 1u)
+            {
+                dsc->source[begin].operator()();
+            }
+            else
+            {
+                thread_pool::get_instance().parallel_for(end - begin, [dsc, begin](std::size_t i)
+                {
+                    dsc->source[begin + i].operator()();
+                });
+            }
 
-            // It's fine to access completion record for  any operation through any type of descriptor
-            auto op_record =
-                reinterpret_cast<const batch_descriptor *>(dsc->source[i].data())->completion_record_address;
-            if (!op_record->is_success())
+            for (auto i = begin; i < end; ++i)
             {
-                record->status                = hw_status::batch_processing_error;
-                record->descriptors_completed = i;
-                return;
+                if (own_get_record(dsc->source[i])->is_success())
+                {
+                    ++completed;
+                }
+                else
+                {
+                    is_failed = true;
+                }
             }
+
+            begin = end;
         }
 
-        record->status                = hw_status::success;
-        record->descriptors_completed = dsc->operation_count;
+        record->status                = is_failed ? hw_status::batch_processing_error : hw_status::success;
+        record->descriptors_completed = completed;
     }
 
     result::operator batch_result() const noexcept
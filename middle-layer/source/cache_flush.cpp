@@ -15,6 +15,7 @@
  */
 
 #include "own/definitions.hpp"
+#include "own/parts.hpp"
 #include "own/types.hpp"
 
 #include <dml_ml/cache_flush.hpp>
@@ -33,8 +34,9 @@ namespace dml::ml
         result *     completion_record_ptr{};    /**< Pointer to the completion record space */
         byte_t       reserved_memory1[8]{};      /**< Not used bytes in the descriptor */
         byte_t *     destination_ptr{};          /**< Pointer to the destination */
-        size_t       transfer_size{};            /**< Count of bytes to copy */
-        byte_t       reserved_memory2[28]{};     /**< Not used bytes in the descriptor */
+        uint32_t     transfer_size{};            /**< Count of bytes to copy */
+        byte_t       reserved_memory2[24]{};     /**< Not used bytes in the descriptor */
+        uint32_t     transfer_size_high{};       /**< High 32 bits of the count, software only */
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
@@ -54,8 +56,9 @@ namespace dml::ml
 
         descriptor.operation_type = hw_operation::cache_flush;
 
-        descriptor.destination_ptr = dst;
-        descriptor.transfer_size   = size;
+        descriptor.destination_ptr    = dst;
+        descriptor.transfer_size      = static_cast<uint32_t>(size);
+        descriptor.transfer_size_high = static_cast<uint32_t>(size >> 32u);
 
         if (!invalidate)
         {
@@ -71,10 +74,15 @@ namespace dml::ml
         auto dsc    = reinterpret_cast<const cache_flush_descriptor *>(operation_.data());
         auto record = reinterpret_cast<cache_flush_completion_record *>(dsc->completion_record_ptr);
 
+        auto flush = [dsc](uint64_t offset, uint32_t part_size)
+        {
+            return (any(dsc->general_flags, hw_option::cache_control))
+                       ? dmlc_copy_cache_to_memory_8u(dsc->destination_ptr + offset, part_size)
+                       : dmlc_move_cache_to_memory_8u(dsc->destination_ptr + offset, part_size);
+        };
+
         // No fail expected due to range check before
-        auto status = (any(dsc->general_flags, hw_option::cache_control))
-                          ? dmlc_copy_cache_to_memory_8u(dsc->destination_ptr, dsc->transfer_size)
-                          : dmlc_move_cache_to_memory_8u(dsc->destination_ptr, dsc->transfer_size);
+        auto status = for_each_part(join_halves(dsc->transfer_size, dsc->transfer_size_high), flush);
 
         if (status != DML_STATUS_OK)
         {
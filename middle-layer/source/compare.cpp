@@ -15,6 +15,7 @@
  */
 
 #include "own/definitions.hpp"
+#include "own/parts.hpp"
 #include "own/types.hpp"
 
 #include <dml_ml/compare.hpp>
@@ -33,10 +34,11 @@ namespace dml::ml
         result *      completion_record_ptr{};    /**< Pointer to the completion record space */
         const byte_t *source_ptr1{};              /**< Pointer to the source 1 */
         const byte_t *source_ptr2{};              /**< Pointer to the source 2 */
-        size_t        transfer_size{};            /**< Count of bytes to copy */
+        uint32_t      transfer_size{};            /**< Count of bytes to copy */
         byte_t        reserved_memory1[4]{};      /**< Not used bytes in the descriptor */
         result_t      expected_result{};          /**< Expected result */
-        byte_t        reserved_memory2[23]{};     /**< Not used bytes in the descriptor */
+        byte_t        reserved_memory2[19]{};     /**< Not used bytes in the descriptor */
+        uint32_t      transfer_size_high{};       /**< High 32 bits of the count, software only */
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
@@ -47,7 +49,8 @@ namespace dml::ml
         uint8_t   reserved_1[2]{};     /**< Reserved bytes                                     */
         uint32_t  bytes_completed{};   /**< Count of processed elements (bytes, words and etc.)*/
         uint8_t * fault_address_ptr{}; /**< Address of Page Fault */
-        uint8_t   reserved_2[16]{};    /**< Reserved bytes        */
+        uint8_t   reserved_2[12]{};    /**< Reserved bytes        */
+        uint32_t  bytes_completed_high{}; /**< High 32 bits of the count, software only */
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
@@ -57,9 +60,10 @@ namespace dml::ml
 
         descriptor.operation_type = hw_operation::compare;
 
-        descriptor.source_ptr1   = src1;
-        descriptor.source_ptr2   = src2;
-        descriptor.transfer_size = size;
+        descriptor.source_ptr1        = src1;
+        descriptor.source_ptr2        = src2;
+        descriptor.transfer_size      = static_cast<uint32_t>(size);
+        descriptor.transfer_size_high = static_cast<uint32_t>(size >> 32u);
 
         if (expect == equality::equal)
         {
@@ -79,11 +83,27 @@ namespace dml::ml
         auto dsc    = reinterpret_cast<const compare_descriptor *>(operation_.data());
         auto record = reinterpret_cast<compare_completion_record *>(dsc->completion_record_ptr);
 
-        auto bytes_completed = uint32_t();
+        auto bytes_completed = uint64_t();
+
+        // The first mismatch stops the comparison, its offset is counted from the start of the operation
+        auto compare = [dsc, &bytes_completed](uint64_t offset, uint32_t part_size)
+        {
+            auto mismatch = uint32_t();
+            auto status   = dmlc_compare_8u(dsc->source_ptr1 + offset, dsc->source_ptr2 + offset, part_size, &mismatch);
+
+            if (status == DML_COMPARE_STATUS_NE)
+            {
+                bytes_completed = offset + mismatch;
+            }
+
+            return status;
+        };
 
         // No fail expected due to range check before
-        auto status = dmlc_compare_8u(dsc->source_ptr1, dsc->source_ptr2, dsc->transfer_size, &bytes_completed);
-        record->bytes_completed = bytes_completed;
+        auto status = for_each_part(join_halves(dsc->transfer_size, dsc->transfer_size_high), compare);
+
+        record->bytes_completed      = static_cast<uint32_t>(bytes_completed);
+        record->bytes_completed_high = static_cast<uint32_t>(bytes_completed >> 32u);
 
         if (status == DML_COMPARE_STATUS_NE)
         {
@@ -114,7 +134,7 @@ namespace dml::ml
                                : (record->status == hw_status::false_predicate_success) ? status_code::false_predicate
                                                                                         : status_code::execution_failed;
         auto result          = record->result;
-        auto bytes_processed = record->bytes_completed;
+        auto bytes_processed = join_halves(record->bytes_completed, record->bytes_completed_high);
 
         return {status, result, bytes_processed};
     }
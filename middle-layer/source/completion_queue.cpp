@@ -0,0 +1,124 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+#include <dml_ml/completion_queue.hpp>
+
+#if defined(linux)
+#include <x86intrin.h>
+#else
+#include <intrin.h>
+#include <emmintrin.h>
+#endif
+
+namespace dml::ml {
+
+    /**
+     * @brief Number of entries the record prefetch goes ahead of the scan
+     */
+    static constexpr std::size_t prefetch_distance = 8u;
+
+    /**
+     * @brief Status byte of entries registered without a result, it reads as finished
+     */
+    static const volatile byte_t finished_status = 1u;
+
+    void completion_queue::add(const result *record_ptr, void *context_ptr, callback_t callback) {
+        const auto *status_ptr = (record_ptr != nullptr) ? reinterpret_cast<const volatile byte_t *>(record_ptr)
+                                                         : &finished_status;
+
+        entries_.push_back({record_ptr, context_ptr, callback});
+        status_ptrs_.push_back(status_ptr);
+    }
+
+    void completion_queue::add(operation &op, result &record, void *context_ptr, callback_t callback) {
+        entries_.push_back({&record, context_ptr, callback, &op});
+        status_ptrs_.push_back(reinterpret_cast<const volatile byte_t *>(&record));
+    }
+
+    auto completion_queue::poll(completion *completions_ptr, std::size_t max) noexcept -> std::size_t {
+        const auto  count    = status_ptrs_.size();
+        std::size_t reported = 0u;
+        std::size_t kept     = 0u;
+
+        for (std::size_t i = 0u; i < count; ++i) {
+            if (i + prefetch_distance < count) {
+                _mm_prefetch(reinterpret_cast<const char *>(const_cast<const byte_t *>(status_ptrs_[i + prefetch_distance])),
+                             _MM_HINT_T0);
+            }
+
+            if (reported < max && *status_ptrs_[i] != 0u && !resume(entries_[i])) {
+                // Copied, a callback may register new operations
+                const auto finished = entries_[i];
+
+                completions_ptr[reported++] = {finished.record_ptr, finished.context_ptr};
+
+                if (finished.callback != nullptr) {
+                    finished.callback(finished.context_ptr);
+                }
+
+                continue;
+            }
+
+            // Unfinished entries are moved to the front, keeping their order
+            if (kept != i) {
+                status_ptrs_[kept] = status_ptrs_[i];
+                entries_[kept]     = entries_[i];
+            }
+
+            ++kept;
+        }
+
+        // Operations registered by callbacks follow the kept ones
+        status_ptrs_.erase(status_ptrs_.begin() + kept, status_ptrs_.begin() + count);
+        entries_.erase(entries_.begin() + kept, entries_.begin() + count);
+
+        return reported;
+    }
+
+    auto completion_queue::resume(entry &registered) noexcept -> bool {
+#if defined(DML_HW)
+        if (registered.op_ptr == nullptr) {
+            return false;
+        }
+
+        // Result storage is never constant: the device writes into it.
+        // The record is cleared when the rest of the operation goes to a device, it's polled again then
+        auto &record = const_cast<result &>(*registered.record_ptr);
+
+        return hardware_path::resume(*registered.op_ptr, record, registered.resume);
+#else
+        (void) registered;
+
+        return false;
+#endif
+    }
+
+    auto completion_queue::wait(completion *completions_ptr,
+                                std::size_t max,
+                                std::chrono::nanoseconds timeout) noexcept -> std::size_t {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        while (true) {
+            const auto reported = poll(completions_ptr, max);
+
+            if (reported != 0u || empty() || max == 0u || std::chrono::steady_clock::now() >= deadline) {
+                return reported;
+            }
+
+            _mm_pause();
+        }
+    }
+}
@@ -15,6 +15,7 @@
  */
 
 #include "own/definitions.hpp"
+#include "own/parts.hpp"
 #include "own/types.hpp"
 
 #include <dml_ml/copy_crc.hpp>
@@ -33,12 +34,13 @@ namespace dml::ml
         result *        completion_record_ptr{}; /**< Pointer to the completion record space */
         const byte_t *  source_ptr{};            /**< Pointer to the source */
         byte_t *        destination_ptr{};       /**< Pointer to the destination */
-        size_t          transfer_size{};         /**< Count of bytes to copy */
+        uint32_t        transfer_size{};         /**< Count of bytes to copy */
         byte_t          reserved_memory2[4]{};   /**< Not used bytes in the descriptor */
         uint32_t        copy_crc_seed{};         /**< CRC Seed value */
         byte_t          reserved_memory3[4]{};   /**< Not used bytes in the descriptor */
         const uint32_t *copy_crc_seed_address{}; /**< CRC Seed address */
-        byte_t          reserved_memory[8]{};    /**< Not used bytes in the descriptor */
+        byte_t          reserved_memory[4]{};    /**< Not used bytes in the descriptor */
+        uint32_t        transfer_size_high{};    /**< High 32 bits of the count, software only */
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
@@ -66,10 +68,11 @@ namespace dml::ml
         descriptor.operation_type = hw_operation::copy_crc;
         descriptor.general_flags  = hw_option::cache_control;
 
-        descriptor.source_ptr      = src;
-        descriptor.destination_ptr = dst;
-        descriptor.transfer_size   = size;
-        descriptor.copy_crc_seed   = copy_crc_seed;
+        descriptor.source_ptr         = src;
+        descriptor.destination_ptr    = dst;
+        descriptor.transfer_size      = static_cast<uint32_t>(size);
+        descriptor.transfer_size_high = static_cast<uint32_t>(size >> 32u);
+        descriptor.copy_crc_seed      = copy_crc_seed;
 
         if (parameters.bypass_reflection)
         {
@@ -99,16 +102,6 @@ namespace dml::ml
         auto dsc    = reinterpret_cast<const copy_crc_descriptor *>(operation_.data());
         auto record = reinterpret_cast<copy_crc_completion_record *>(dsc->completion_record_ptr);
 
-        // No fail expected due to range check before
-        auto status = dmlc_copy_8u(dsc->source_ptr, dsc->destination_ptr, dsc->transfer_size);
-
-
-        if (status != DML_STATUS_OK)
-        {
-            record->status = hw_status::internal_error;
-            return;  // Copy fail, skip CRC
-        }
-
         auto bypass_reflection      = any(dsc->crc_options, crc_option::bypass_reflection);
         auto bypass_data_reflection = any(dsc->crc_options, crc_option::bypass_data_reflection);
 
@@ -121,10 +114,23 @@ namespace dml::ml
             crc_value = reverse(crc_value);
         }
 
+        // Copy and CRC are fused, the source is read once, the CRC of a part is the seed of the next one
         // Bypass Data Reflection in case if DML_FLAG_DATA_REFLECTION set
-        status = (!bypass_data_reflection)
-                     ? dmlc_calculate_crc_reflected_32u(dsc->source_ptr, dsc->transfer_size, &crc_value, polynomial)
-                     : dmlc_calculate_crc_32u(dsc->source_ptr, dsc->transfer_size, &crc_value, polynomial);
+        auto copy = [dsc, bypass_data_reflection, &crc_value](uint64_t offset, uint32_t part_size)
+        {
+            return (!bypass_data_reflection) ? dmlc_copy_with_crc_reflected_32u(dsc->source_ptr + offset,
+                                                                                dsc->destination_ptr + offset,
+                                                                                part_size,
+                                                                                &crc_value,
+                                                                                polynomial)
+                                             : dmlc_copy_with_crc_32u(dsc->source_ptr + offset,
+                                                                      dsc->destination_ptr + offset,
+                                                                      part_size,
+                                                                      &crc_value,
+                                                                      polynomial);
+        };
+
+        auto status = for_each_part(join_halves(dsc->transfer_size, dsc->transfer_size_high), copy);
 
         // Bypass inversion and use reverse bit order for CRC result
         if (!bypass_reflection)
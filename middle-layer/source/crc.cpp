@@ -15,6 +15,7 @@
  */
 
 #include "own/definitions.hpp"
+#include "own/parts.hpp"
 #include "own/types.hpp"
 
 #include <dml_ml/crc.hpp>
@@ -33,12 +34,13 @@ namespace dml::ml
         result *        completion_record_ptr{}; /**< Pointer to the completion record space */
         const byte_t *  source_ptr{};            /**< Pointer to the source */
         byte_t          reserved_memory1[8]{};   /**< Not used bytes in the descriptor */
-        size_t          transfer_size{};         /**< Count of bytes to copy */
+        uint32_t        transfer_size{};         /**< Count of bytes to copy */
         byte_t          reserved_memory2[4]{};   /**< Not used bytes in the descriptor */
         uint32_t        crc_seed{};              /**< CRC Seed value */
         byte_t          reserved_memory3[4]{};   /**< Not used bytes in the descriptor */
         const uint32_t *crc_seed_address{};      /**< CRC Seed address */
-        byte_t          reserved_memory[8]{};    /**< Not used bytes in the descriptor */
+        byte_t          reserved_memory[4]{};    /**< Not used bytes in the descriptor */
+        uint32_t        transfer_size_high{};    /**< High 32 bits of the count, software only */
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
@@ -61,9 +63,10 @@ namespace dml::ml
 
         descriptor.operation_type = hw_operation::crc;
 
-        descriptor.source_ptr    = src;
-        descriptor.transfer_size = size;
-        descriptor.crc_seed      = crc_seed;
+        descriptor.source_ptr         = src;
+        descriptor.transfer_size      = static_cast<uint32_t>(size);
+        descriptor.transfer_size_high = static_cast<uint32_t>(size >> 32u);
+        descriptor.crc_seed           = crc_seed;
 
         if (parameters.bypass_reflection)
         {
@@ -76,20 +79,27 @@ namespace dml::ml
         }
     }
 
-    void crc::operator()() const noexcept
+    /**
+     * @brief CRC-32C polynomial, MSB-first
+     */
+    static constexpr uint32_t polynomial = 0x1EDC6F41u;
+
+    /**
+     * @brief Reverses bit order of a value
+     */
+    static inline auto reverse(uint32_t value) noexcept -> uint32_t
     {
-        constexpr auto polynomial = 0x1EDC6F41u;
-        auto           reverse    = [](uint32_t value)
-        {
-            value = (value & 0x55555555u) << 1u | (value & 0xAAAAAAAAu) >> 1u;
-            value = (value & 0x33333333u) << 2u | (value & 0xCCCCCCCCu) >> 2u;
-            value = (value & 0x0F0F0F0Fu) << 4u | (value & 0xF0F0F0F0u) >> 4u;
-            value = (value & 0x00FF00FFu) << 8u | (value & 0xFF00FF00u) >> 8u;
-            value = (value & 0x0000FFFFu) << 16u | (value & 0xFFFF0000u) >> 16u;
+        value = (value & 0x55555555u) << 1u | (value & 0xAAAAAAAAu) >> 1u;
+        value = (value & 0x33333333u) << 2u | (value & 0xCCCCCCCCu) >> 2u;
+        value = (value & 0x0F0F0F0Fu) << 4u | (value & 0xF0F0F0F0u) >> 4u;
+        value = (value & 0x00FF00FFu) << 8u | (value & 0xFF00FF00u) >> 8u;
+        value = (value & 0x0000FFFFu) << 16u | (value & 0xFFFF0000u) >> 16u;
 
-            return value;
-        };
+        return value;
+    }
 
+    void crc::operator()() const noexcept
+    {
         auto dsc    = reinterpret_cast<const crc_descriptor *>(operation_.data());
         auto record = reinterpret_cast<crc_completion_record *>(dsc->completion_record_ptr);
 
@@ -105,11 +115,16 @@ namespace dml::ml
             crc_value = reverse(crc_value);
         }
 
+        // The CRC of a part is the seed of the next one
         // Bypass Data Reflection in case if DML_FLAG_DATA_REFLECTION set
-        auto status =
-            (!bypass_data_reflection)
-                ? dmlc_calculate_crc_reflected_32u(dsc->source_ptr, dsc->transfer_size, &crc_value, polynomial)
-                : dmlc_calculate_crc_32u(dsc->source_ptr, dsc->transfer_size, &crc_value, polynomial);
+        auto calculate = [dsc, bypass_data_reflection, &crc_value](uint64_t offset, uint32_t part_size)
+        {
+            return (!bypass_data_reflection)
+                       ? dmlc_calculate_crc_reflected_32u(dsc->source_ptr + offset, part_size, &crc_value, polynomial)
+                       : dmlc_calculate_crc_32u(dsc->source_ptr + offset, part_size, &crc_value, polynomial);
+        };
+
+        auto status = for_each_part(join_halves(dsc->transfer_size, dsc->transfer_size_high), calculate);
 
         // Bypass inversion and use reverse bit order for CRC result
         if (!bypass_reflection)
@@ -130,6 +145,22 @@ namespace dml::ml
         }
     }
 
+    auto crc::combine(uint32_t first_crc, uint32_t second_crc, uint64_t second_size, crc_parameters parameters) noexcept
+        -> uint32_t
+    {
+        // Inversion of the seed and the result cancels out, reflected values are combined in reverse bit order
+        if (!parameters.bypass_reflection)
+        {
+            first_crc  = reverse(first_crc);
+            second_crc = reverse(second_crc);
+        }
+
+        // Data reflection doesn't matter: the second region is hashed already
+        dmlc_crc32_combine(&first_crc, second_crc, second_size, polynomial);
+
+        return (!parameters.bypass_reflection) ? reverse(first_crc) : first_crc;
+    }
+
     result::operator crc_result() const noexcept
     {
         auto record = reinterpret_cast<const crc_completion_record *>(data_);
@@ -15,13 +15,20 @@
  */
 
 #include "own/definitions.hpp"
+#include "own/parts.hpp"
 #include "own/types.hpp"
 
 #include <dml_ml/create_delta.hpp>
 #include <dml_ml/result.hpp>
+#include <dml_ml/thread_pool.hpp>
 
 #include <core_api.h>
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
 namespace dml::ml
 {
     DML_PACKED_STRUCT_DECLARATION_BEGIN(create_delta_descriptor)
@@ -33,13 +40,14 @@ namespace dml::ml
         result *      completion_record_ptr{};    /**< Pointer to the completion record space */
         const byte_t *source_ptr1{};              /**< Pointer to the source 1 */
         const byte_t *source_ptr2{};              /**< Pointer to the source 2 */
-        size_t        transfer_size{};            /**< Count of bytes to copy */
+        uint32_t      transfer_size{};            /**< Count of bytes to copy */
         byte_t        reserved_memory1[4]{};      /**< Not used bytes in the descriptor */
         byte_t *      delta_record{};             /**< Pointer to the delta record */
-        size_t        delta_max_size{};           /**< Max size for delta record */
-        byte_t        reserved_memory2[4]{};      /**< Not used bytes in the descriptor */
+        uint32_t      delta_max_size{};           /**< Max size for delta record */
+        uint32_t      delta_max_size_high{};      /**< High 32 bits of the max size, software only */
         result_t      expected_result{};          /**< Expected result */
-        byte_t        reserved_memory3[7]{};      /**< Not used bytes in the descriptor */
+        byte_t        reserved_memory3[3]{};      /**< Not used bytes in the descriptor */
+        uint32_t      transfer_size_high{};       /**< High 32 bits of the count, software only */
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
@@ -50,16 +58,149 @@ namespace dml::ml
         uint8_t   reserved_1[2]{};     /**< Reserved bytes                                     */
         uint32_t  bytes_completed{};   /**< Count of processed elements (bytes, words and etc.)*/
         uint8_t * fault_address_ptr{}; /**< Address of Page Fault */
-        size_t    delta_record_size{}; /**< Calculated delta record size*/
-        uint8_t   reserved_2[16]{};    /**< Reserved bytes        */
+        uint32_t  delta_record_size{}; /**< Calculated delta record size*/
+        uint32_t  delta_record_size_high{}; /**< High 32 bits of the record size, software only */
+        uint8_t   reserved_2[8]{};     /**< Reserved bytes        */
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
+    /**
+     * @brief Byte size of the compared regions part a task creates notes for, when a wide record is created
+     */
+    static constexpr uint32_t wide_delta_part_size = 1u << 20u;
+
+    /**
+     * @brief Notes created for a part of the compared regions
+     */
+    struct wide_delta_part
+    {
+        std::unique_ptr<byte_t[]> notes;                 /**< Notes of the part */
+        uint32_t                  size   = 0u;            /**< Byte size of the notes */
+        dmlc_status_t             status = DML_STATUS_OK; /**< Status reported for the part */
+    };
+
+    /**
+     * @brief Creates a wide delta record by parts of the compared regions, in parallel on the thread pool
+     *
+     * Each part gets own notes buffer, the buffers are concatenated in the order of the parts then.
+     * A region that fits a part, or parts that don't fit memory, are compared sequentially straight into the record.
+     *
+     * @return Core status: DML_STATUS_DELTA_RECORD_SIZE_ERROR if notes don't fit the record
+     */
+    static auto own_create_wide_delta(const byte_t *reference,
+                                      const byte_t *second,
+                                      uint64_t      size,
+                                      byte_t       *delta_record,
+                                      uint64_t      delta_max_size,
+                                      uint64_t     &record_size) noexcept -> dmlc_status_t
+    {
+        const auto parts_count = (size + wide_delta_part_size - 1u) / wide_delta_part_size;
+        const auto max_size    = delta_max_size / DML_WIDE_DELTA_NOTE_SIZE * DML_WIDE_DELTA_NOTE_SIZE;
+
+        std::vector<wide_delta_part> parts;
+
+        if (parts_count > 1u && max_size != 0u)
+        {
+            try
+            {
+                parts.resize(parts_count);
+
+                for (uint64_t i = 0u; i < parts_count; ++i)
+                {
+                    const auto part_size = std::min<uint64_t>(wide_delta_part_size, size - i * wide_delta_part_size);
+                    const auto capacity  = std::min<uint64_t>(part_size / 8u * DML_WIDE_DELTA_NOTE_SIZE, max_size);
+
+                    parts[i].size = static_cast<uint32_t>(capacity);
+                    parts[i].notes.reset(new byte_t[capacity]);
+                }
+            }
+            catch (...)
+            {
+                parts.clear();
+            }
+        }
+
+        if (parts.empty())
+        {
+            auto position = uint64_t(0u);
+
+            auto create = [&](uint64_t offset, uint32_t part_size)
+            {
+                const auto capacity         = std::min<uint64_t>(max_size - position, max_part_size);
+                auto       part_record_size = uint32_t();
+
+                if (capacity == 0u)
+                {
+                    // The record is full already, the rest is compared to tell if it overflows
+                    auto       mismatch = uint32_t();
+                    const auto status   = dmlc_compare_8u(reference + offset, second + offset, part_size, &mismatch);
+
+                    return (status == DML_COMPARE_STATUS_NE) ? DML_STATUS_DELTA_RECORD_SIZE_ERROR : status;
+                }
+
+                const auto status = dmlc_create_wide_delta_record_8u(reference + offset,
+                                                                     second + offset,
+                                                                     part_size,
+                                                                     offset / 8u,
+                                                                     static_cast<uint32_t>(capacity),
+                                                                     delta_record + position,
+                                                                     &part_record_size);
+                position += part_record_size;
+
+                return status;
+            };
+
+            const auto status = for_each_part(size, create);
+            record_size       = position;
+
+            return status;
+        }
+
+        thread_pool::get_instance().parallel_for(parts_count, [&](std::size_t i)
+        {
+            auto      &part      = parts[i];
+            const auto offset    = static_cast<uint64_t>(i) * wide_delta_part_size;
+            const auto part_size = static_cast<uint32_t>(std::min<uint64_t>(wide_delta_part_size, size - offset));
+            const auto capacity  = part.size;
+
+            part.status = dmlc_create_wide_delta_record_8u(reference + offset,
+                                                           second + offset,
+                                                           part_size,
+                                                           offset / 8u,
+                                                           capacity,
+                                                           part.notes.get(),
+                                                           &part.size);
+        });
+
+        // The record is cut at the first part that failed or doesn't fit
+        uint64_t position = 0u;
+
+        for (auto &part : parts)
+        {
+            const auto copied = std::min<uint64_t>(part.size, max_size - position);
+
+            std::memcpy(delta_record + position, part.notes.get(), copied);
+            position += copied;
+
+            if (part.status != DML_STATUS_OK || copied < part.size)
+            {
+                record_size = position;
+
+                return (part.status != DML_STATUS_OK) ? part.status : DML_STATUS_DELTA_RECORD_SIZE_ERROR;
+            }
+        }
+
+        record_size = position;
+
+        return DML_STATUS_OK;
+    }
+
     create_delta::create_delta(const byte_t *src1,
                                const byte_t *src2,
                                size_t        size,
                                byte_t *      delta_record,
-                               size_t        delta_max_size) noexcept:
+                               size_t        delta_max_size,
+                               delta_format  format) noexcept:
         operation_()
     {
         auto &descriptor = *reinterpret_cast<create_delta_descriptor *>(operation_.data());
@@ -67,11 +208,18 @@ namespace dml::ml
         descriptor.operation_type = hw_operation::create_delta;
         descriptor.general_flags  = hw_option::cache_control;
 
-        descriptor.source_ptr1    = src1;
-        descriptor.source_ptr2    = src2;
-        descriptor.transfer_size  = size;
-        descriptor.delta_record   = delta_record;
-        descriptor.delta_max_size = delta_max_size;
+        descriptor.source_ptr1         = src1;
+        descriptor.source_ptr2         = src2;
+        descriptor.transfer_size       = static_cast<uint32_t>(size);
+        descriptor.transfer_size_high  = static_cast<uint32_t>(size >> 32u);
+        descriptor.delta_record        = delta_record;
+        descriptor.delta_max_size      = static_cast<uint32_t>(delta_max_size);
+        descriptor.delta_max_size_high = static_cast<uint32_t>(delta_max_size >> 32u);
+
+        if (format == delta_format::wide)
+        {
+            descriptor.operation_specific_flags = to_underlying(delta_option::wide_record);
+        }
     }
 
     void create_delta::operator()() const noexcept
@@ -79,9 +227,36 @@ namespace dml::ml
         auto dsc    = reinterpret_cast<const create_delta_descriptor *>(operation_.data());
         auto record = reinterpret_cast<create_delta_completion_record *>(dsc->completion_record_ptr);
 
+        if ((dsc->operation_specific_flags & to_underlying(delta_option::wide_record)) != 0u)
+        {
+            auto delta_record_size = uint64_t();
+
+            // Flip src1 and src2 due to core differs from hardware spec
+            auto status = own_create_wide_delta(dsc->source_ptr2,
+                                                dsc->source_ptr1,
+                                                join_halves(dsc->transfer_size, dsc->transfer_size_high),
+                                                dsc->delta_record,
+                                                join_halves(dsc->delta_max_size, dsc->delta_max_size_high),
+                                                delta_record_size);
+            record->delta_record_size      = static_cast<uint32_t>(delta_record_size);
+            record->delta_record_size_high = static_cast<uint32_t>(delta_record_size >> 32u);
+
+            if (status == DML_STATUS_OK || status == DML_STATUS_DELTA_RECORD_SIZE_ERROR)
+            {
+                record->result = (status != DML_STATUS_OK) ? 2 : (delta_record_size != 0u) ? 1 : 0;
+                record->status = hw_status::success;
+            }
+            else
+            {
+                record->status = hw_status::internal_error;
+            }
+
+            return;
+        }
+
         auto delta_record_size = uint32_t();
 
-        // No fail expected due to range check before
+        // No fail expected due to range check before, offsets of the narrow record limit the size far below 4 GiB
         // Flip src1 and src2 due to core differs from hardware spec
         auto status = dmlc_create_delta_record_8u(dsc->source_ptr2,
                                                   dsc->source_ptr1,
@@ -119,7 +294,7 @@ namespace dml::ml
         auto status          = (record->status == hw_status::success) ? status_code::ok : status_code::execution_failed;
         auto result          = record->result;
         auto bytes_processed = record->bytes_completed;
-        auto size            = record->delta_record_size;
+        auto size            = join_halves(record->delta_record_size, record->delta_record_size_high);
 
         return {status, result, bytes_processed, size};
     }
@@ -15,6 +15,7 @@
  */
 
 #include "own/definitions.hpp"
+#include "own/parts.hpp"
 #include "own/types.hpp"
 
 #include <dml_ml/dualcast.hpp>
@@ -33,10 +34,11 @@ namespace dml::ml
         result *      completion_record_ptr{};    /**< Pointer to the completion record space */
         const byte_t *source_ptr{};               /**< Pointer to the source */
         byte_t *      destination_ptr1{};         /**< Pointer to the first destination */
-        size_t        transfer_size{};            /**< Count of bytes to copy */
+        uint32_t      transfer_size{};            /**< Count of bytes to copy */
         byte_t        reserved_memory1[4]{};      /**< Not used bytes in the descriptor */
         byte_t *      destination_ptr2{};         /**< Pointer to the second destination */
-        byte_t        reserved_memory2[16]{};     /**< Not used bytes in the descriptor */
+        byte_t        reserved_memory2[12]{};     /**< Not used bytes in the descriptor */
+        uint32_t      transfer_size_high{};       /**< High 32 bits of the count, software only */
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
@@ -58,10 +60,11 @@ namespace dml::ml
         descriptor.operation_type = hw_operation::dualcast;
         descriptor.general_flags  = hw_option::cache_control;
 
-        descriptor.source_ptr       = src;
-        descriptor.destination_ptr1 = dst1;
-        descriptor.destination_ptr2 = dst2;
-        descriptor.transfer_size    = size;
+        descriptor.source_ptr         = src;
+        descriptor.destination_ptr1   = dst1;
+        descriptor.destination_ptr2   = dst2;
+        descriptor.transfer_size      = static_cast<uint32_t>(size);
+        descriptor.transfer_size_high = static_cast<uint32_t>(size >> 32u);
     }
 
     void dualcast::operator()() const noexcept
@@ -69,9 +72,16 @@ namespace dml::ml
         auto dsc    = reinterpret_cast<const dualcast_descriptor *>(operation_.data());
         auto record = reinterpret_cast<dualcast_completion_record *>(dsc->completion_record_ptr);
 
+        auto copy = [dsc](uint64_t offset, uint32_t part_size)
+        {
+            return dmlc_dualcast_copy_8u(dsc->source_ptr + offset,
+                                         dsc->destination_ptr1 + offset,
+                                         dsc->destination_ptr2 + offset,
+                                         part_size);
+        };
+
         // No fail expected due to range check before
-        auto status =
-            dmlc_dualcast_copy_8u(dsc->source_ptr, dsc->destination_ptr1, dsc->destination_ptr2, dsc->transfer_size);
+        auto status = for_each_part(join_halves(dsc->transfer_size, dsc->transfer_size_high), copy);
 
         if (status != DML_STATUS_OK)
         {
@@ -15,6 +15,7 @@
  */
 
 #include "own/definitions.hpp"
+#include "own/parts.hpp"
 #include "own/types.hpp"
 
 #include <dml_ml/fill.hpp>
@@ -33,8 +34,9 @@ namespace dml::ml
         result *     completion_record_ptr{};    /**< Pointer to the completion record space */
         uint64_t     pattern{};                  /**< Pattern used to fill */
         byte_t *     destination_ptr{};          /**< Pointer to the destination */
-        size_t       transfer_size{};            /**< Count of bytes to copy */
-        byte_t       reserved_memory[28]{};      /**< Not used bytes in the descriptor */
+        uint32_t     transfer_size{};            /**< Count of bytes to copy */
+        byte_t       reserved_memory[24]{};      /**< Not used bytes in the descriptor */
+        uint32_t     transfer_size_high{};       /**< High 32 bits of the count, software only */
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
@@ -55,9 +57,10 @@ namespace dml::ml
         descriptor.operation_type = hw_operation::fill;
         descriptor.general_flags  = hw_option::cache_control;
 
-        descriptor.pattern         = pattern;
-        descriptor.destination_ptr = dst;
-        descriptor.transfer_size   = size;
+        descriptor.pattern            = pattern;
+        descriptor.destination_ptr    = dst;
+        descriptor.transfer_size      = static_cast<uint32_t>(size);
+        descriptor.transfer_size_high = static_cast<uint32_t>(size >> 32u);
     }
 
     void fill::operator()() const noexcept
@@ -65,8 +68,14 @@ namespace dml::ml
         auto dsc    = reinterpret_cast<const fill_descriptor *>(operation_.data());
         auto record = reinterpret_cast<fill_completion_record *>(dsc->completion_record_ptr);
 
+        // Parts are multiples of the pattern size, so each of them starts with the first pattern byte
+        auto fill = [dsc](uint64_t offset, uint32_t part_size)
+        {
+            return dmlc_fill_with_pattern_8u(dsc->pattern, dsc->destination_ptr + offset, part_size);
+        };
+
         // No fail expected due to range check before
-        auto status = dmlc_fill_with_pattern_8u(dsc->pattern, dsc->destination_ptr, dsc->transfer_size);
+        auto status = for_each_part(join_halves(dsc->transfer_size, dsc->transfer_size_high), fill);
 
         if (status != DML_STATUS_OK)
         {
@@ -14,13 +14,27 @@
  *
  */
 
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <vector>
+
 #include "own/definitions.hpp"
+#include "own/parts.hpp"
 #include "own/types.hpp"
 
+#include <dml_ml/batch.hpp>
+#include <dml_ml/crc.hpp>
 #include <dml_ml/hardware_path.hpp>
 #include <dml_ml/result.hpp>
+#include <dml_ml/thread_pool.hpp>
 #include <hardware_api.h>
 
+#include "hw_affinity.hpp"
 #include "hw_dispatcher.hpp"
 #include "numa.hpp"
 
@@ -37,62 +51,965 @@ namespace dml::ml
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
-status_code hardware_path::submit(operation op, result& res) noexcept {
-    static auto                 &dispatcher_instance = dispatcher::hw_dispatcher::get_instance();
-    static thread_local int32_t numa_id              = util::get_numa_id();
+/**
+ * @brief Devices a thread of each NUMA node submits into
+ *
+ * A node without devices gets the ones of the nearest nodes (by firmware distance), the last entry keeps
+ * all devices for threads whose node is unknown.
+ */
+using devices_by_node_t = std::vector<std::vector<uint32_t>>;
 
-        const auto n_devices = std::distance(dispatcher_instance.begin(), dispatcher_instance.end());
+static inline auto own_get_devices_by_node(const dispatcher::hw_dispatcher &dispatcher_instance) -> devices_by_node_t
+{
+    const auto        node_count = util::get_numa_node_count();
+    devices_by_node_t devices_by_node(node_count + 1u);
 
-        // Initially set to "end" index
-        static auto last_device_idx = std::atomic(n_devices);
+    for (uint32_t node = 0u; node < node_count; ++node)
+    {
+        auto nearest_distance = INT32_MAX;
 
-        // Loop FROM the device after the one used for last submit
-        for (auto device_idx = last_device_idx.load() + 1; device_idx < n_devices; ++device_idx)
+        for (auto device_it = dispatcher_instance.begin(); device_it != dispatcher_instance.end(); ++device_it)
         {
-            auto &device = *(dispatcher_instance.begin() + device_idx);
-            if (device.numa_id() != numa_id)
+            const auto device_idx = static_cast<uint32_t>(std::distance(dispatcher_instance.begin(), device_it));
+            const auto distance   = util::get_numa_distance(static_cast<int32_t>(node),
+                                                            static_cast<int32_t>(device_it->numa_id()));
+
+            if (distance < nearest_distance)
             {
-                continue;
+                nearest_distance = distance;
+                devices_by_node[node].clear();
             }
 
-        // Use BlockOnFault on hardware, until page fault handling is implemented in software side
-        auto dsc = reinterpret_cast<any_operation_descriptor*>(op.data());
-        dsc->general_flags = dsc->general_flags | hw_option::block_on_fault;
+            if (distance == nearest_distance)
+            {
+                devices_by_node[node].push_back(device_idx);
+            }
+        }
+    }
 
-        op.associate(res);
-        auto status = device.enqueue_descriptor(reinterpret_cast<const dsahw_descriptor_t *>(&op));
+    for (auto device_it = dispatcher_instance.begin(); device_it != dispatcher_instance.end(); ++device_it)
+    {
+        devices_by_node.back().push_back(static_cast<uint32_t>(std::distance(dispatcher_instance.begin(), device_it)));
+    }
+
+    return devices_by_node;
+}
+
+/**
+ * @brief Device the thread submits into, chosen again when the thread appears on another node
+ */
+struct device_affinity_t
+{
+    const std::vector<uint32_t> *devices_ptr = nullptr;  /**< Devices of thread's current node */
+    uint32_t                     preferred   = 0u;       /**< Position in the devices list */
+};
+
+/**
+ * @brief Returns devices local to the calling thread and its affinity to them
+ *
+ * @return nullptr if there are no devices
+ */
+static auto own_get_local_devices() noexcept -> const std::vector<uint32_t> *
+{
+    static auto                         &dispatcher_instance = dispatcher::hw_dispatcher::get_instance();
+    static const auto                   devices_by_node      = own_get_devices_by_node(dispatcher_instance);
+
+    // Node is checked on every submission, the scheduler may have migrated the thread
+    const auto numa_id       = util::get_numa_id();
+    const auto node_position = (numa_id >= 0 && static_cast<std::size_t>(numa_id) + 1u < devices_by_node.size())
+                               ? static_cast<std::size_t>(numa_id)
+                               : devices_by_node.size() - 1u;
+    const auto &devices      = devices_by_node[node_position];
+
+    return devices.empty() ? nullptr : &devices;
+}
+
+static inline auto own_get_device(uint32_t index) noexcept -> const dispatcher::hw_device &
+{
+    static auto &dispatcher_instance = dispatcher::hw_dispatcher::get_instance();
+
+    return *(dispatcher_instance.begin() + index);
+}
+
+/**
+ * @brief Dedicated work queue of a registered submitter thread
+ *
+ * MOVDIR64B doesn't report a full queue, so the owner counts descriptors that may still be in the queue and
+ * doesn't submit more of them than the queue size. Completion records of the descriptors belong to callers
+ * and may be waited for on other threads or freed, so they are never read here: every group of descriptors
+ * is closed by a Drain descriptor with a record of the submitter, its completion means the whole group
+ * and the groups before it left the queue. One slot is always kept for the Drain closing the open group.
+ */
+class dedicated_submitter
+{
+public:
+    static auto get_instance() noexcept -> dedicated_submitter &
+    {
+        static thread_local dedicated_submitter instance;
 
-            if (status == DML_STATUS_OK)
+        return instance;
+    }
+
+    [[nodiscard]] auto is_registered() const noexcept -> bool
+    {
+        return queue_ptr_ != nullptr;
+    }
+
+    auto acquire() noexcept -> bool
+    {
+        if (queue_ptr_ != nullptr)
+        {
+            return true;
+        }
+
+        static auto &dispatcher_instance = dispatcher::hw_dispatcher::get_instance();
+
+        // Local devices go first, then any device
+        if (const auto *devices_ptr = own_get_local_devices(); devices_ptr != nullptr)
+        {
+            for (const auto index : *devices_ptr)
             {
-                last_device_idx = device_idx;
-                return status_code::ok;
+                queue_ptr_ = own_get_device(index).acquire_dedicated_queue();
+
+                if (queue_ptr_ != nullptr)
+                {
+                    break;
+                }
             }
         }
 
-        // If the loop before didn't submit descriptor, then loop UNTIL the device that was used for last submit
-        for (auto device_idx = 0; device_idx <= last_device_idx; ++device_idx)
+        for (auto device_it = dispatcher_instance.begin(); queue_ptr_ == nullptr && device_it != dispatcher_instance.end(); ++device_it)
+        {
+            queue_ptr_ = device_it->acquire_dedicated_queue();
+        }
+
+        if (queue_ptr_ == nullptr)
+        {
+            return false;
+        }
+
+        // A descriptor and its Drain are needed to make progress
+        if (queue_ptr_->size() < 2u)
         {
-            auto &device = *(dispatcher_instance.begin() + device_idx);
-            if (device.numa_id() != numa_id)
+            queue_ptr_->release();
+            queue_ptr_ = nullptr;
+
+            return false;
+        }
+
+        // A group takes at least two slots: a descriptor and the Drain
+        group_size_ = std::max(queue_ptr_->size() / 4u, 2u);
+
+        try
+        {
+            groups_.resize(queue_ptr_->size() / 2u);
+        }
+        catch (...)
+        {
+            release();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Waits until the queue is empty and returns it, Drain records can't be freed earlier
+     */
+    void release() noexcept
+    {
+        if (queue_ptr_ != nullptr)
+        {
+            // Only the emulated queue may reject the Drain, its engines make room
+            while (open_count_ != 0u)
+            {
+                close_group();
+            }
+
+            for (; group_count_ != 0u; --group_count_)
             {
-                continue;
+                groups_[first_group_].drain_record.wait();
+                first_group_ = (first_group_ + 1u) % groups_.size();
             }
 
-            // Use BlockOnFault on hardware, until page fault handling is implemented in software side
-            auto dsc = reinterpret_cast<any_operation_descriptor*>(op.data());
-            dsc->general_flags = dsc->general_flags | hw_option::block_on_fault;
+            queue_ptr_->release();
+            queue_ptr_ = nullptr;
+        }
+
+        groups_.clear();
+        first_group_ = 0u;
+        group_count_ = 0u;
+        open_count_  = 0u;
+        occupancy_   = 0u;
+    }
+
+    /**
+     * @brief Submits an associated descriptor if the queue has room for it
+     */
+    auto enqueue(const operation &op) noexcept -> bool
+    {
+        const auto queue_size = queue_ptr_->size();
 
-            op.associate(res);
-            auto status = device.enqueue_descriptor(reinterpret_cast<const dsahw_descriptor_t *>(&op));
+        retire_drained_groups();
 
-            if (status == DML_STATUS_OK)
+        if (occupancy_ + 2u > queue_size)
+        {
+            // Without a Drain behind them, the open group descriptors would never be seen leaving the queue
+            if (open_count_ != 0u)
             {
-                last_device_idx = device_idx;
-                return status_code::ok;
+                close_group();
             }
+
+            return false;
         }
 
+        if (DML_STATUS_OK != queue_ptr_->enqueue_descriptor(reinterpret_cast<const dsahw_descriptor_t *>(&op)))
+        {
+            return false;
+        }
+
+        ++occupancy_;
+        ++open_count_;
+
+        if (open_count_ + 1u >= group_size_)
+        {
+            close_group();
+        }
+
+        return true;
+    }
+
+    ~dedicated_submitter() noexcept
+    {
+        release();
+    }
+
+private:
+    dedicated_submitter() noexcept = default;
+
+    /**
+     * @brief Descriptors closed by a Drain
+     */
+    struct group_t
+    {
+        result   drain_record{}; /**< Completion record of the Drain */
+        uint32_t size = 0u;      /**< Number of descriptors including the Drain */
+    };
+
+    void retire_drained_groups() noexcept
+    {
+        // Drains complete in order of submission
+        while (group_count_ != 0u && groups_[first_group_].drain_record.is_finished())
+        {
+            occupancy_ -= groups_[first_group_].size;
+            first_group_ = (first_group_ + 1u) % groups_.size();
+            --group_count_;
+        }
+    }
+
+    void close_group() noexcept
+    {
+        // A group takes at least two slots, so there is always an entry for it
+        auto &group = groups_[(first_group_ + group_count_) % groups_.size()];
+
+        operation drain{};
+        reinterpret_cast<any_operation_descriptor *>(drain.data())->operation_type = hw_operation::drain;
+        drain.associate(group.drain_record);
+
+        // The slot was kept for it, the emulated queue may still reject it: then it's retried later
+        if (DML_STATUS_OK != queue_ptr_->enqueue_descriptor(reinterpret_cast<const dsahw_descriptor_t *>(&drain)))
+        {
+            return;
+        }
+
+        group.size = open_count_ + 1u;
+
+        ++occupancy_;
+        ++group_count_;
+        open_count_ = 0u;
+    }
+
+    const dispatcher::hw_queue *queue_ptr_   = nullptr;
+    std::vector<group_t>        groups_;           /**< Ring of groups closed by Drains that are in the queue */
+    uint32_t                    first_group_ = 0u; /**< Index of the oldest closed group */
+    uint32_t                    group_count_ = 0u; /**< Number of closed groups in the queue */
+    uint32_t                    group_size_  = 0u; /**< Number of descriptors in a group including its Drain */
+    uint32_t                    open_count_  = 0u; /**< Number of descriptors not closed by a Drain yet */
+    uint32_t                    occupancy_   = 0u; /**< Number of descriptors that may still be in the queue */
+};
+
+/**
+ * @brief Submits a descriptor onto one of the local devices
+ *
+ * @param op          Descriptor
+ * @param res         Its result
+ * @param chunk_index Index of a striped operation part: parts go to consecutive devices and queues
+ *                    starting from the preferred ones, @ref dispatcher::hw_device::no_queue_hint otherwise
+ */
+static auto own_submit(operation op, result &res, uint32_t chunk_index) noexcept -> status_code
+{
+    static thread_local device_affinity_t thread_affinity;
+
+    const auto *devices_ptr = own_get_local_devices();
+
+    if (devices_ptr == nullptr)
+    {
         return status_code::error;
     }
 
+    const auto &devices = *devices_ptr;
+
+    if (thread_affinity.devices_ptr != devices_ptr)
+    {
+        thread_affinity.devices_ptr = devices_ptr;
+        thread_affinity.preferred   = dispatcher::affinity::random() % devices.size();
+    }
+
+    // Page faults are resolved by hardware_path::wait, only operations it can't resume block the device
+    auto dsc = reinterpret_cast<any_operation_descriptor*>(op.data());
+    dsc->general_flags = dsc->general_flags | hw_option::block_on_fault;
+    dsa_allow_page_faults(reinterpret_cast<dsahw_descriptor_t *>(op.data()));
+
+    op.associate(res);
+
+    const auto device_count = static_cast<uint32_t>(devices.size());
+    const auto is_chunk     = chunk_index != dispatcher::hw_device::no_queue_hint;
+
+    // Parts of a striped operation are spread over shared queues
+    if (!is_chunk)
+    {
+        auto &submitter = dedicated_submitter::get_instance();
+
+        if (submitter.is_registered() && submitter.enqueue(op))
+        {
+            return status_code::ok;
+        }
+    }
+    const auto queue_hint   = is_chunk ? chunk_index / device_count : dispatcher::hw_device::no_queue_hint;
+
+    const auto device_at = [&devices](uint32_t position) -> const dispatcher::hw_device &
+    {
+        return own_get_device(devices[position]);
+    };
+
+    const auto last_rejection = [&device_at](uint32_t position) -> uint64_t
+    {
+        return device_at(position).rejections().last_rejection();
+    };
+
+    const auto enqueue = [&op, &device_at, queue_hint](uint32_t position) -> bool
+    {
+        return DML_STATUS_OK == device_at(position).enqueue_descriptor(reinterpret_cast<const dsahw_descriptor_t *>(&op),
+                                                                       queue_hint);
+    };
+
+    // Stay on the preferred device while it has room
+    auto position = is_chunk ? (thread_affinity.preferred + chunk_index) % device_count : thread_affinity.preferred;
+
+    if (enqueue(position))
+    {
+        return status_code::ok;
+    }
+
+    // Move away using two random choices, then walk over the rest so that no free device is missed
+    const auto rejected_position = position;
+    position = dispatcher::affinity::choose_of_two(device_count, position, last_rejection);
+
+    for (uint32_t i = 0u; i < device_count; ++i, position = (position + 1u) % device_count)
+    {
+        if (position == rejected_position)
+        {
+            continue;
+        }
+
+        if (enqueue(position))
+        {
+            if (!is_chunk)
+            {
+                thread_affinity.preferred = position;
+            }
+
+            return status_code::ok;
+        }
+    }
+
+    return status_code::error;
+}
+
+/* ------ Striping ------ */
+
+static constexpr auto operation_flags_offset = 6u;
+static constexpr auto operation_type_offset  = 7u;
+static constexpr auto address_1_offset       = 16u;
+static constexpr auto address_2_offset       = 24u;
+static constexpr auto transfer_size_offset   = 32u;
+static constexpr auto crc_seed_offset        = 40u;
+static constexpr auto transfer_size_high_offset = 60u;  /**< Software only, reserved and zero for devices */
+
+static constexpr auto record_status_mask            = 0x3Fu;  /**< Bit 7 of the status is the faulted access type */
+static constexpr auto record_result_offset          = 1u;
+static constexpr auto record_bytes_completed_offset = 4u;
+static constexpr auto record_crc_offset             = 16u;
+static constexpr auto record_bytes_completed_high_offset = 28u;  /**< Software only, reserved for devices */
+
+static constexpr uint32_t pattern_size   = 8u;
+static constexpr uint32_t page_size      = 4096u;
+static constexpr uint32_t huge_page_size = 2u * 1024u * 1024u;
+
+static constexpr uint32_t default_stripe_threshold = 4u * 1024u * 1024u;
+
+template <class field_t>
+static inline auto own_read_field(const operation &op, uint32_t offset) noexcept -> field_t
+{
+    field_t value{};
+    std::memcpy(&value, op.data() + offset, sizeof(field_t));
+
+    return value;
+}
+
+template <class field_t>
+static inline void own_write_field(operation &op, uint32_t offset, field_t value) noexcept
+{
+    std::memcpy(op.data() + offset, &value, sizeof(field_t));
+}
+
+/**
+ * @brief Returns number of bytes in an operation, those with more than 4 GiB are executed by parts
+ */
+static inline auto own_get_transfer_size(const operation &op) noexcept -> uint64_t
+{
+    return join_halves(own_read_field<uint32_t>(op, transfer_size_offset),
+                       own_read_field<uint32_t>(op, transfer_size_high_offset));
+}
+
+/**
+ * @brief Returns the biggest operation all local devices accept, UINT32_MAX if there are no devices
+ */
+static auto own_get_max_transfer_size() noexcept -> uint32_t
+{
+    const auto *devices_ptr       = own_get_local_devices();
+    uint32_t    max_transfer_size = UINT32_MAX;
+
+    if (devices_ptr != nullptr)
+    {
+        for (const auto index : *devices_ptr)
+        {
+            max_transfer_size = std::min(max_transfer_size, own_get_device(index).max_transfer_size());
+        }
+    }
+
+    return max_transfer_size;
+}
+
+/**
+ * @brief Moves addresses of a part to its offset in the operation, the part is a device descriptor then
+ *
+ * Descriptors keep 32-bit sizes, so the offset is advanced by steps that fit them.
+ */
+static void own_advance_chunk(operation &chunk, uint64_t offset) noexcept
+{
+    own_write_field<uint32_t>(chunk, transfer_size_high_offset, 0u);
+
+    while (offset != 0u)
+    {
+        // The step is a multiple of the pattern size, so a pattern is rotated by the rest only
+        const auto step = static_cast<uint32_t>(std::min<uint64_t>(offset, 1u << 31u));
+
+        own_write_field<uint32_t>(chunk, transfer_size_offset, step);
+        dsa_advance_descriptor(reinterpret_cast<dsahw_descriptor_t *>(chunk.data()), step);
+
+        offset -= step;
+    }
+}
+
+/**
+ * @brief Returns size starting from which operations are striped, DML_STRIPE_THRESHOLD overrides the default
+ */
+static auto own_get_stripe_threshold() noexcept -> uint32_t
+{
+    static const auto threshold = []() -> uint32_t
+    {
+        const char *value_ptr = std::getenv("DML_STRIPE_THRESHOLD");
+
+        if (value_ptr == nullptr)
+        {
+            return default_stripe_threshold;
+        }
+
+        char *end_ptr = nullptr;
+        auto  value   = std::strtoull(value_ptr, &end_ptr, 0);
+
+        if (end_ptr == value_ptr || value == 0u)
+        {
+            return default_stripe_threshold;
+        }
+
+        return (value > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(value);
+    }();
+
+    return threshold;
+}
+
+/**
+ * @brief Returns address that chunk boundaries are aligned against: the written one, or the read one
+ *
+ * @return 0 if the operation can't be split
+ */
+static auto own_get_stripe_address(const operation &op) noexcept -> uint64_t
+{
+    const auto type          = static_cast<hw_operation>(op.data()[operation_type_offset]);
+    const auto transfer_size = own_get_transfer_size(op);
+    const auto source        = own_read_field<uint64_t>(op, address_1_offset);
+    const auto destination   = own_read_field<uint64_t>(op, address_2_offset);
+
+    switch (type)
+    {
+        case hw_operation::mem_move:
+            // Parts of overlapping regions can't be copied in parallel
+            return (destination + transfer_size <= source || source + transfer_size <= destination) ? destination : 0u;
+        case hw_operation::fill:
+        case hw_operation::dualcast:
+        case hw_operation::cache_flush:
+            return destination;
+        case hw_operation::copy_crc:
+            return destination;
+        case hw_operation::crc:
+            return source;
+        case hw_operation::compare:
+        case hw_operation::compare_pattern:
+            return source;
+        default:
+            return 0u;
+    }
+}
+
+/**
+ * @brief Operation split into parts executed on several devices and queues
+ */
+struct stripe
+{
+    operation              op;          /**< Original operation */
+    result                *result_ptr;  /**< Result of the original operation */
+    std::vector<operation> chunks;      /**< Parts of the operation */
+    std::vector<result>    results;     /**< Results of the parts */
+    std::vector<uint64_t>  offsets;     /**< Offsets of the parts in the operation */
+    std::vector<bool>      submitted;   /**< Parts accepted by a device, the rest is executed on CPU */
+};
+
+/**
+ * @brief Waits for parts of a striped operation and writes its result, runs as a task of @ref thread_pool
+ *
+ * Parts that didn't fit the queues are retried and executed on CPU by the pool workers in parallel,
+ * while the accepted ones go on in the devices. The task itself takes the parts no worker is free for,
+ * so it doesn't depend on other pool tasks.
+ */
+static void own_finish_stripe(stripe &target) noexcept
+{
+    const auto count = target.chunks.size();
+
+    thread_pool::get_instance().parallel_for(count, [&target](std::size_t i)
+    {
+        if (target.submitted[i])
+        {
+            return;
+        }
+
+        // Queues may have freed slots since the submission
+        if (status_code::ok == own_submit(target.chunks[i], target.results[i], static_cast<uint32_t>(i)))
+        {
+            hardware_path::wait(target.chunks[i], target.results[i]);
+        }
+        else
+        {
+            target.chunks[i].associate(target.results[i]);
+            target.chunks[i]();
+        }
+    });
+
+    for (std::size_t i = 0u; i < count; ++i)
+    {
+        if (target.submitted[i])
+        {
+            hardware_path::wait(target.chunks[i], target.results[i]);
+        }
+    }
+
+    const auto type       = static_cast<hw_operation>(target.op.data()[operation_type_offset]);
+    const auto is_crc     = type == hw_operation::crc || type == hw_operation::copy_crc;
+    const auto is_compare = type == hw_operation::compare || type == hw_operation::compare_pattern;
+
+    // The first failed or mismatched part is reported with offsets relative to the whole operation,
+    // otherwise the last part is reported with the combined CRC
+    std::size_t reported   = count - 1u;
+    bool        is_stopped = false;
+    uint32_t    crc        = 0u;
+
+    const auto crc_options = static_cast<crc_option>(target.op.data()[operation_flags_offset]);
+    const auto parameters  = crc_parameters{any(crc_options, crc_option::bypass_reflection),
+                                           any(crc_options, crc_option::bypass_data_reflection)};
+
+    for (std::size_t i = 0u; i < count; ++i)
+    {
+        const auto *record_bytes = reinterpret_cast<const byte_t *>(&target.results[i]);
+        const auto  status       = static_cast<hw_status>(record_bytes[0] & record_status_mask);
+
+        if ((status != hw_status::success && status != hw_status::false_predicate_success) ||
+            (is_compare && record_bytes[record_result_offset] != 0u))
+        {
+            reported   = i;
+            is_stopped = true;
+            break;
+        }
+
+        if (is_crc)
+        {
+            uint32_t part_crc = 0u;
+            std::memcpy(&part_crc, record_bytes + record_crc_offset, sizeof(part_crc));
+
+            const auto part_size = own_read_field<uint32_t>(target.chunks[i], transfer_size_offset);
+
+            crc = (i == 0u) ? part_crc : crc::combine(crc, part_crc, part_size, parameters);
+        }
+    }
+
+    byte_t record_bytes[sizeof(result)];
+    std::memcpy(record_bytes, &target.results[reported], sizeof(result));
+
+    if (is_stopped)
+    {
+        uint32_t bytes_completed[2] = {0u, 0u};
+        std::memcpy(&bytes_completed[0], record_bytes + record_bytes_completed_offset, sizeof(uint32_t));
+        std::memcpy(&bytes_completed[1], record_bytes + record_bytes_completed_high_offset, sizeof(uint32_t));
+
+        const auto offset = join_halves(bytes_completed[0], bytes_completed[1]) + target.offsets[reported];
+
+        bytes_completed[0] = static_cast<uint32_t>(offset);
+        bytes_completed[1] = static_cast<uint32_t>(offset >> 32u);
+        std::memcpy(record_bytes + record_bytes_completed_offset, &bytes_completed[0], sizeof(uint32_t));
+        std::memcpy(record_bytes + record_bytes_completed_high_offset, &bytes_completed[1], sizeof(uint32_t));
+    }
+    else if (is_crc)
+    {
+        std::memcpy(record_bytes + record_crc_offset, &crc, sizeof(crc));
+    }
+
+    // Status goes last: a waiter polls the first byte only
+    auto *result_bytes = reinterpret_cast<volatile byte_t *>(target.result_ptr);
+
+    for (std::size_t i = 1u; i < sizeof(result); ++i)
+    {
+        result_bytes[i] = record_bytes[i];
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+    result_bytes[0] = record_bytes[0];
+}
+
+/**
+ * @brief Splits a big operation into parts aligned to pages and submits them onto local devices and queues
+ *
+ * @return status_code::error if the operation isn't striped, it's submitted as is then
+ */
+static auto own_submit_striped(const operation &op, result &res) noexcept -> status_code
+{
+    const auto transfer_size = own_get_transfer_size(op);
+    const auto address       = own_get_stripe_address(op);
+
+    if (address == 0u || transfer_size < page_size)
+    {
+        return status_code::error;
+    }
+
+    const auto *devices_ptr = own_get_local_devices();
+
+    if (devices_ptr == nullptr)
+    {
+        return status_code::error;
+    }
+
+    uint32_t queue_count       = 0u;
+    uint32_t max_transfer_size = UINT32_MAX;
+
+    for (const auto index : *devices_ptr)
+    {
+        const auto &device = own_get_device(index);
+
+        queue_count       += static_cast<uint32_t>(device.size());
+        max_transfer_size  = std::min(max_transfer_size, device.max_transfer_size());
+    }
+
+    const auto is_too_big = transfer_size > max_transfer_size;
+
+    if (!is_too_big && (queue_count < 2u || transfer_size < own_get_stripe_threshold()))
+    {
+        return status_code::error;
+    }
+
+    // A part per queue, aligned to huge pages if they are big enough
+    uint64_t chunk_size  = (transfer_size + queue_count - 1u) / std::max(queue_count, 1u);
+    const auto alignment = (chunk_size >= huge_page_size && max_transfer_size >= huge_page_size) ? huge_page_size
+                                                                                                 : page_size;
+
+    chunk_size = (chunk_size + alignment - 1u) / alignment * alignment;
+
+    if (chunk_size > max_transfer_size)
+    {
+        chunk_size = (max_transfer_size >= alignment) ? max_transfer_size / alignment * alignment : max_transfer_size;
+    }
+
+    auto target_ptr = std::unique_ptr<stripe>(new (std::nothrow) stripe{op, &res, {}, {}, {}, {}});
+
+    if (target_ptr == nullptr)
+    {
+        return status_code::error;
+    }
+
+    auto &target = *target_ptr;
+
+    const auto type   = static_cast<hw_operation>(op.data()[operation_type_offset]);
+    const auto is_crc = type == hw_operation::crc || type == hw_operation::copy_crc;
+
+    try
+    {
+        const auto count = (transfer_size + chunk_size - 1u) / chunk_size + 1u;
+
+        target.chunks.reserve(count);
+        target.results.reserve(count);
+        target.offsets.reserve(count);
+        target.submitted.reserve(count);
+    }
+    catch (...)
+    {
+        return status_code::error;
+    }
+
+    // Inner boundaries are aligned against the address, so parts are shorter than chunk_size at most by alignment
+    for (uint64_t offset = 0u; offset < transfer_size;)
+    {
+        auto end = (address + offset + chunk_size) / alignment * alignment - address;
+
+        // Pattern mismatch is reported for 8-byte blocks counted from the start of the operation
+        if (type == hw_operation::compare_pattern)
+        {
+            end -= end % pattern_size;
+        }
+
+        if (end <= offset)
+        {
+            end = offset + chunk_size;
+        }
+
+        end = std::min<uint64_t>(end, transfer_size);
+
+        auto chunk = op;
+        own_advance_chunk(chunk, offset);
+        own_write_field<uint32_t>(chunk, transfer_size_offset, static_cast<uint32_t>(end - offset));
+
+        if (offset != 0u && is_crc)
+        {
+            // CRC of the other parts is combined with the first one, only the first part reads the seed
+            own_write_field<uint32_t>(chunk, crc_seed_offset, 0u);
+            chunk.data()[operation_flags_offset] &= static_cast<byte_t>(~to_underlying(crc_option::read_seed));
+        }
+
+        target.chunks.push_back(chunk);
+        target.offsets.push_back(offset);
+
+        offset = end;
+    }
+
+    target.results.resize(target.chunks.size());
+
+    for (std::size_t i = 0u; i < target.chunks.size(); ++i)
+    {
+        target.submitted.push_back(status_code::ok == own_submit(target.chunks[i], target.results[i], static_cast<uint32_t>(i)));
+    }
+
+    res = result();
+
+    // Each stripe is finished by its own task, so unrelated stripes complete independently
+    std::shared_ptr<stripe> shared_target = std::move(target_ptr);
+
+    try
+    {
+        thread_pool::get_instance().submit([shared_target]() { own_finish_stripe(*shared_target); });
+    }
+    catch (...)
+    {
+        own_finish_stripe(*shared_target);
+    }
+
+    return status_code::ok;
+}
+
+/**
+ * @brief Checks if the operation has options devices don't support, a batch is checked by its members
+ *
+ * Members of a batch aren't striped, so a member with more than 4 GiB makes the batch software only too.
+ */
+static auto own_is_software_only(const operation &op) noexcept -> bool
+{
+    const auto type = static_cast<hw_operation>(op.data()[operation_type_offset]);
+
+    if (type == hw_operation::batch)
+    {
+        const auto *list_ptr = own_read_field<const operation *>(op, address_1_offset);
+        const auto  count    = own_read_field<uint32_t>(op, transfer_size_offset);
+
+        auto is_software_only = [](const operation &member)
+        {
+            return own_is_software_only(member) || own_get_transfer_size(member) > UINT32_MAX;
+        };
+
+        return std::any_of(list_ptr, list_ptr + count, is_software_only);
+    }
+
+    return (type == hw_operation::create_delta || type == hw_operation::apply_delta) &&
+           (op.data()[operation_flags_offset] & to_underlying(delta_option::wide_record)) != 0u;
+}
+
+/**
+ * @brief Executes the operation on CPU, the completion record is ready on return
+ */
+static auto own_execute_on_cpu(operation &op, result &res) noexcept -> status_code
+{
+    op.associate(res);
+
+    if (static_cast<hw_operation>(op.data()[operation_type_offset]) == hw_operation::batch)
+    {
+        reinterpret_cast<const batch &>(op)();
+    }
+    else
+    {
+        op();
+    }
+
+    return status_code::ok;
+}
+
+status_code hardware_path::submit(operation op, result& res) noexcept {
+    if (own_is_software_only(op))
+    {
+        // Wide delta records are created and applied on CPU
+        return own_execute_on_cpu(op, res);
+    }
+
+    if (status_code::ok == own_submit_striped(op, res))
+    {
+        return status_code::ok;
+    }
+
+    // An operation devices don't accept and that can't be split, e.g. an overlapping copy, is executed by parts on CPU
+    if (static_cast<hw_operation>(op.data()[operation_type_offset]) != hw_operation::batch &&
+        own_get_transfer_size(op) > own_get_max_transfer_size())
+    {
+        return own_execute_on_cpu(op, res);
+    }
+
+    return own_submit(op, res, dispatcher::hw_device::no_queue_hint);
+}
+
+/**
+ * @brief Number of times the rest of an operation is resubmitted, then it's completed on CPU
+ */
+static constexpr uint32_t max_page_fault_resubmissions = 16u;
+
+void hardware_path::wait(const operation &op, const result &record, const wait_policy &policy) noexcept
+{
+    const auto transfer_size = own_get_transfer_size(op);
+
+    record.wait(policy, transfer_size);
+
+    // Result storage is never constant: the device writes into it
+    auto &res          = const_cast<result &>(record);
+    auto *record_bytes = reinterpret_cast<byte_t *>(&res);
+
+    if ((record_bytes[0] & record_status_mask) != static_cast<byte_t>(hw_status::page_fault_during_processing))
+    {
+        return;
+    }
+
+    auto         remainder = op;
+    resume_state state{};
+
+    while (resume(remainder, res, state))
+    {
+        res.wait(policy, transfer_size - state.completed_bytes);
+    }
+}
+
+bool hardware_path::resume(operation &op, result &res, resume_state &state) noexcept
+{
+    auto *record_bytes = reinterpret_cast<byte_t *>(&res);
+
+    while ((record_bytes[0] & record_status_mask) == static_cast<byte_t>(hw_status::page_fault_during_processing))
+    {
+        uint32_t bytes_completed = 0u;
+
+        if (DML_STATUS_OK != dsa_resume_descriptor(reinterpret_cast<dsahw_descriptor_t *>(op.data()),
+                                                   reinterpret_cast<const dsahw_completion_record_t *>(&res),
+                                                   0u,
+                                                   &bytes_completed))
+        {
+            // Reported as is
+            break;
+        }
+
+        state.completed_bytes += bytes_completed;
+
+        if (state.resubmissions < max_page_fault_resubmissions &&
+            status_code::ok == own_submit(op, res, dispatcher::hw_device::no_queue_hint))
+        {
+            ++state.resubmissions;
+            dsa_count_page_fault_resume(0u);
+
+            return true;
+        }
+
+        // Software kernels write the same completion record
+        op.associate(res);
+        op();
+
+        dsa_count_page_fault_resume(1u);
+    }
+
+    // Offsets reported by the last execution are relative to the resumed operation
+    const auto status      = static_cast<hw_status>(record_bytes[0] & record_status_mask);
+    const auto type        = reinterpret_cast<const any_operation_descriptor *>(op.data())->operation_type;
+    const auto is_mismatch = (type == hw_operation::compare || type == hw_operation::compare_pattern) &&
+                             record_bytes[record_result_offset] != 0u;
+
+    if ((status != hw_status::success && status != hw_status::false_predicate_success) || is_mismatch)
+    {
+        uint32_t bytes_completed = 0u;
+        std::memcpy(&bytes_completed, record_bytes + record_bytes_completed_offset, sizeof(bytes_completed));
+
+        bytes_completed += state.completed_bytes;
+        std::memcpy(record_bytes + record_bytes_completed_offset, &bytes_completed, sizeof(bytes_completed));
+    }
+
+    state.completed_bytes = 0u;
+
+    return false;
+}
+
+bool hardware_path::register_dedicated_submitter() noexcept
+{
+    return dedicated_submitter::get_instance().acquire();
+}
+
+void hardware_path::unregister_dedicated_submitter() noexcept
+{
+    dedicated_submitter::get_instance().release();
+}
+
+hardware_path::page_fault_statistics hardware_path::get_page_fault_statistics() noexcept
+{
+    dml_page_fault_statistics_t statistics{};
+    dsa_get_page_fault_statistics(&statistics);
+
+    return {statistics.resumed_on_hardware, statistics.completed_on_cpu};
+}
+
 }  // namespace dml::ml
@@ -15,6 +15,7 @@
  */
 
 #include "own/definitions.hpp"
+#include "own/parts.hpp"
 #include "own/types.hpp"
 
 #include <dml_ml/mem_move.hpp>
@@ -33,8 +34,9 @@ namespace dml::ml
         result *      completion_record_ptr{};    /**< Pointer to the completion record space */
         const byte_t *source_ptr{};               /**< Pointer to the source */
         byte_t *      destination_ptr{};          /**< Pointer to the destination */
-        size_t        transfer_size{};            /**< Count of bytes to copy */
-        byte_t        reserved_memory[28]{};      /**< Not used bytes in the descriptor */
+        uint32_t      transfer_size{};            /**< Count of bytes to copy */
+        byte_t        reserved_memory[24]{};      /**< Not used bytes in the descriptor */
+        uint32_t      transfer_size_high{};       /**< High 32 bits of the count, software only */
     };
     DML_PACKED_STRUCT_DECLARATION_END
 
@@ -56,9 +58,10 @@ namespace dml::ml
         descriptor.operation_type = hw_operation::mem_move;
         descriptor.general_flags  = hw_option::cache_control;
 
-        descriptor.source_ptr      = src;
-        descriptor.destination_ptr = dst;
-        descriptor.transfer_size   = size;
+        descriptor.source_ptr         = src;
+        descriptor.destination_ptr    = dst;
+        descriptor.transfer_size      = static_cast<uint32_t>(size);
+        descriptor.transfer_size_high = static_cast<uint32_t>(size >> 32u);
     }
 
     void mem_move::operator()() const noexcept
@@ -66,8 +69,25 @@ namespace dml::ml
         auto dsc    = reinterpret_cast<const mem_move_descriptor *>(operation_.data());
         auto record = reinterpret_cast<mem_move_completion_record *>(dsc->completion_record_ptr);
 
+        const auto size        = join_halves(dsc->transfer_size, dsc->transfer_size_high);
+        const auto is_backward =
+            dsc->source_ptr < dsc->destination_ptr && dsc->source_ptr + size > dsc->destination_ptr;
+        const auto last_offset = (size == 0u) ? 0u : (size - 1u) / max_part_size * max_part_size;
+
+        // Backward move goes from the last part, so a part never overwrites the source of the next one
+        auto move = [dsc, size, is_backward, last_offset](uint64_t offset, uint32_t part_size)
+        {
+            if (is_backward)
+            {
+                offset    = last_offset - offset;
+                part_size = static_cast<uint32_t>(std::min<uint64_t>(size - offset, max_part_size));
+            }
+
+            return dmlc_move_8u(dsc->source_ptr + offset, dsc->destination_ptr + offset, part_size);
+        };
+
         // No fail expected due to range check before
-        auto status = dmlc_move_8u(dsc->source_ptr, dsc->destination_ptr, dsc->transfer_size);
+        auto status = for_each_part(size, move);
 
         if (status != DML_STATUS_OK)
         {
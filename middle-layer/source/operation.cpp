@@ -20,6 +20,7 @@
 #include <dml_ml/operation.hpp>
 
 #include <dml_ml/apply_delta.hpp>
+#include <dml_ml/batch.hpp>
 #include <dml_ml/cache_flush.hpp>
 #include <dml_ml/compare.hpp>
 #include <dml_ml/compare_pattern.hpp>
@@ -52,6 +53,7 @@ namespace dml::ml
             case hw_operation::nop:
                 break;
             case hw_operation::batch:
+                reinterpret_cast<const batch *>(data_)->operator()();
                 break;
             case hw_operation::drain:
                 break;
@@ -109,4 +111,10 @@ namespace dml::ml
         // Set flags to request completion record
         dsc->general_flags = dsc->general_flags | hw_use_completion_record;
     }
+
+    void operation::set_fence() noexcept
+    {
+        auto dsc           = reinterpret_cast<any_operation_descriptor *>(this);
+        dsc->general_flags = dsc->general_flags | hw_option::fence;
+    }
 }  // namespace dml::ml
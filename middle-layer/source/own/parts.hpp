@@ -0,0 +1,77 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+#ifndef DML_ML_SOURCE_OWN_PARTS_HPP
+#define DML_ML_SOURCE_OWN_PARTS_HPP
+
+#include <core_api.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace dml::ml
+{
+    /**
+     * @brief Maximal number of bytes a core kernel processes at once, longer operations are processed by parts
+     *
+     * The size is a multiple of 8, so a fill pattern and 8-byte comparison blocks continue in the next part.
+     */
+    static constexpr uint32_t max_part_size = 1u << 30u;
+
+    /**
+     * @brief Joins a 64-bit value kept in two 32-bit fields of a descriptor or a completion record
+     *
+     * Devices use the low field only, the high one is a reserved field for them and stays zero.
+     *
+     * @param low  Low 32 bits
+     * @param high High 32 bits
+     *
+     * @return Joined value
+     */
+    constexpr auto join_halves(uint32_t low, uint32_t high) noexcept -> uint64_t
+    {
+        return (static_cast<uint64_t>(high) << 32u) | low;
+    }
+
+    /**
+     * @brief Calls a kernel for each part of an operation in order, until it reports something but success
+     *
+     * An empty operation is a single empty part, so the kernel checks it the same way.
+     *
+     * @tparam kernel_t Callable with (uint64_t offset, uint32_t part_size) arguments that returns @ref dmlc_status_t
+     *
+     * @param size   Number of bytes in the operation
+     * @param kernel Kernel to call
+     *
+     * @return Status of the last called kernel
+     */
+    template <typename kernel_t>
+    auto for_each_part(uint64_t size, kernel_t kernel) noexcept -> dmlc_status_t
+    {
+        auto status = dmlc_status_t(DML_STATUS_OK);
+        auto offset = uint64_t(0u);
+
+        do
+        {
+            status = kernel(offset, static_cast<uint32_t>(std::min<uint64_t>(size - offset, max_part_size)));
+            offset += max_part_size;
+        } while (status == DML_STATUS_OK && offset < size);
+
+        return status;
+    }
+}  // namespace dml::ml
+
+#endif  //DML_ML_SOURCE_OWN_PARTS_HPP
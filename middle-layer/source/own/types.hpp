@@ -116,6 +116,16 @@ namespace dml::ml
         bypass_data_reflection = 0b100
     };
 
+    /**
+     * @brief Options of delta operations that exist in software only
+     *
+     * Descriptors with these options are never passed to a device.
+     */
+    enum class delta_option : uint8_t
+    {
+        wide_record = 0x80  /**< Delta record consists of 16-byte notes with 64-bit offsets */
+    };
+
     /**
      * @brief Helper for casting enumeration to its underlying type
      *
@@ -0,0 +1,398 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "own/definitions.hpp"
+#include "own/parts.hpp"
+#include "own/types.hpp"
+
+#include <dml_ml/crc.hpp>
+#include <dml_ml/parallel_software_path.hpp>
+#include <dml_ml/thread_pool.hpp>
+
+namespace dml::ml
+{
+static constexpr auto operation_flags_offset    = 6u;
+static constexpr auto operation_type_offset     = 7u;
+static constexpr auto address_1_offset          = 16u;  /**< Source, the first source for Compare, pattern for Fill */
+static constexpr auto address_2_offset          = 24u;  /**< Destination, pattern for Compare Pattern              */
+static constexpr auto transfer_size_offset      = 32u;
+static constexpr auto address_3_offset          = 40u;  /**< The second destination of Dualcast */
+static constexpr auto crc_seed_offset           = 40u;
+static constexpr auto transfer_size_high_offset = 60u;
+
+static constexpr auto record_status_mask                 = 0x3Fu;
+static constexpr auto record_result_offset               = 1u;
+static constexpr auto record_bytes_completed_offset      = 4u;
+static constexpr auto record_crc_offset                  = 16u;
+static constexpr auto record_bytes_completed_high_offset = 28u;
+
+static constexpr uint32_t    pattern_size       = 8u;
+static constexpr uint32_t    cache_line_size    = 64u;
+static constexpr std::size_t page_size          = 4096u;
+static constexpr std::size_t default_chunk_size = 1u << 20u;
+
+static std::atomic<std::size_t> chunk_size_setting{0u};   /**< 0 means the default */
+static std::atomic<std::size_t> parallelism_setting{0u};  /**< 0 means the default */
+
+template <class field_t>
+static inline auto own_read_field(const operation &op, uint32_t offset) noexcept -> field_t
+{
+    field_t value{};
+    std::memcpy(&value, op.data() + offset, sizeof(field_t));
+
+    return value;
+}
+
+template <class field_t>
+static inline void own_write_field(operation &op, uint32_t offset, field_t value) noexcept
+{
+    std::memcpy(op.data() + offset, &value, sizeof(field_t));
+}
+
+static inline auto own_get_transfer_size(const operation &op) noexcept -> uint64_t
+{
+    return join_halves(own_read_field<uint32_t>(op, transfer_size_offset),
+                       own_read_field<uint32_t>(op, transfer_size_high_offset));
+}
+
+/**
+ * @brief Returns value of an environment variable, or the default one if it's not set or invalid
+ */
+static auto own_get_environment_value(const char *name, std::size_t default_value) noexcept -> std::size_t
+{
+    const char *value_ptr = std::getenv(name);
+
+    if (value_ptr == nullptr)
+    {
+        return default_value;
+    }
+
+    char *end_ptr = nullptr;
+    auto  value   = std::strtoull(value_ptr, &end_ptr, 0);
+
+    return (end_ptr == value_ptr || value == 0u) ? default_value : static_cast<std::size_t>(value);
+}
+
+/**
+ * @brief Returns chunk size rounded up to a multiple of a page, it's not longer than a part of the kernels
+ */
+static inline auto own_round_chunk_size(std::size_t chunk_size) noexcept -> std::size_t
+{
+    chunk_size = std::min<std::size_t>(chunk_size, max_part_size);
+
+    return (chunk_size + page_size - 1u) / page_size * page_size;
+}
+
+/**
+ * @brief Returns address that chunk boundaries are aligned against: the written one, or the read one
+ *
+ * @return 0 if the operation can't be split
+ */
+static auto own_get_split_address(const operation &op) noexcept -> uint64_t
+{
+    const auto type          = static_cast<hw_operation>(op.data()[operation_type_offset]);
+    const auto transfer_size = own_get_transfer_size(op);
+    const auto source        = own_read_field<uint64_t>(op, address_1_offset);
+    const auto destination   = own_read_field<uint64_t>(op, address_2_offset);
+
+    switch (type)
+    {
+        case hw_operation::mem_move:
+            // Parts of overlapping regions can't be copied in parallel
+            return (destination + transfer_size <= source || source + transfer_size <= destination) ? destination : 0u;
+        case hw_operation::fill:
+        case hw_operation::dualcast:
+        case hw_operation::copy_crc:
+        case hw_operation::cache_flush:
+            return destination;
+        case hw_operation::crc:
+        case hw_operation::compare:
+        case hw_operation::compare_pattern:
+            return source;
+        default:
+            return 0u;
+    }
+}
+
+/**
+ * @brief Rotates 8-byte pattern, so that the rest of the region starts with the byte of the pattern it had
+ */
+static inline void own_advance_pattern(operation &chunk, uint32_t offset, uint64_t bytes) noexcept
+{
+    const auto shift   = static_cast<uint32_t>(bytes % pattern_size) * 8u;
+    const auto pattern = own_read_field<uint64_t>(chunk, offset);
+
+    if (shift != 0u)
+    {
+        own_write_field<uint64_t>(chunk, offset, (pattern >> shift) | (pattern << (64u - shift)));
+    }
+}
+
+static inline void own_advance_address(operation &chunk, uint32_t offset, uint64_t bytes) noexcept
+{
+    own_write_field<uint64_t>(chunk, offset, own_read_field<uint64_t>(chunk, offset) + bytes);
+}
+
+/**
+ * @brief Returns the part of an operation that starts at an offset and ends at another one
+ */
+static auto own_make_chunk(const operation &op, uint64_t begin, uint64_t end) noexcept -> operation
+{
+    auto       chunk = op;
+    const auto type  = static_cast<hw_operation>(op.data()[operation_type_offset]);
+
+    switch (type)
+    {
+        case hw_operation::mem_move:
+        case hw_operation::compare:
+            own_advance_address(chunk, address_1_offset, begin);
+            own_advance_address(chunk, address_2_offset, begin);
+            break;
+        case hw_operation::fill:
+            own_advance_pattern(chunk, address_1_offset, begin);
+            own_advance_address(chunk, address_2_offset, begin);
+            break;
+        case hw_operation::compare_pattern:
+            own_advance_address(chunk, address_1_offset, begin);
+            own_advance_pattern(chunk, address_2_offset, begin);
+            break;
+        case hw_operation::dualcast:
+            own_advance_address(chunk, address_1_offset, begin);
+            own_advance_address(chunk, address_2_offset, begin);
+            own_advance_address(chunk, address_3_offset, begin);
+            break;
+        case hw_operation::copy_crc:
+            own_advance_address(chunk, address_2_offset, begin);
+            [[fallthrough]];
+        case hw_operation::crc:
+            own_advance_address(chunk, address_1_offset, begin);
+
+            if (begin != 0u)
+            {
+                // CRC of the other chunks is combined with the first one, only the first chunk reads the seed
+                own_write_field<uint32_t>(chunk, crc_seed_offset, 0u);
+                chunk.data()[operation_flags_offset] &= static_cast<byte_t>(~to_underlying(crc_option::read_seed));
+            }
+            break;
+        case hw_operation::cache_flush:
+            own_advance_address(chunk, address_2_offset, begin);
+            break;
+        default:
+            break;
+    }
+
+    own_write_field<uint32_t>(chunk, transfer_size_offset, static_cast<uint32_t>(end - begin));
+    own_write_field<uint32_t>(chunk, transfer_size_high_offset, static_cast<uint32_t>((end - begin) >> 32u));
+
+    return chunk;
+}
+
+/**
+ * @brief Chunks of an operation, their boundaries are computed by index
+ */
+struct chunk_layout
+{
+    uint64_t    address;     /**< Address boundaries are aligned against */
+    uint64_t    size;        /**< Number of bytes in the operation */
+    std::size_t chunk_size;  /**< Number of bytes in a chunk before alignment */
+    std::size_t count;       /**< Number of chunks */
+    bool        is_pattern;  /**< Boundaries are multiples of the pattern size too */
+
+    /**
+     * @brief Returns offset of a chunk, the offset of the chunk past the last one is the operation size
+     *
+     * Inner boundaries are aligned down to a cache line, chunks are a page long at least, so they aren't empty.
+     */
+    [[nodiscard]] auto begin(std::size_t index) const noexcept -> uint64_t
+    {
+        if (index == 0u || index >= count)
+        {
+            return (index == 0u) ? 0u : size;
+        }
+
+        auto offset = (address + index * chunk_size) / cache_line_size * cache_line_size - address;
+
+        // Pattern mismatch is reported for 8-byte blocks counted from the start of the operation
+        return is_pattern ? offset - offset % pattern_size : offset;
+    }
+};
+
+static inline auto own_is_stopped(const result &record, hw_operation type) noexcept -> bool
+{
+    const auto *record_bytes = reinterpret_cast<const byte_t *>(&record);
+    const auto  status       = static_cast<hw_status>(record_bytes[0] & record_status_mask);
+    const auto  is_compare   = type == hw_operation::compare || type == hw_operation::compare_pattern;
+
+    return (status != hw_status::success && status != hw_status::false_predicate_success) ||
+           (is_compare && record_bytes[record_result_offset] != 0u);
+}
+
+status_code parallel_software_path::submit(operation op, result &res) noexcept
+{
+    const auto type    = static_cast<hw_operation>(op.data()[operation_type_offset]);
+    const auto address = own_get_split_address(op);
+    const auto size    = own_get_transfer_size(op);
+
+    const auto chunk_size  = get_chunk_size();
+    const auto count       = static_cast<std::size_t>((size + chunk_size - 1u) / chunk_size);
+    const auto parallelism = std::min(get_parallelism(), count);
+
+    std::vector<result> results;
+
+    if (address != 0u && parallelism > 1u)
+    {
+        try
+        {
+            results.resize(count);
+        }
+        catch (...)
+        {
+            results.clear();
+        }
+    }
+
+    if (results.empty())
+    {
+        op.associate(res);
+        op();
+
+        return status_code::ok;
+    }
+
+    const auto layout = chunk_layout{address, size, chunk_size, count, type == hw_operation::compare_pattern};
+
+    // Chunks after a stopped one are skipped, so the first stopped one is always executed
+    std::atomic<std::size_t> next_chunk{0u};
+    std::atomic<std::size_t> first_stopped{count};
+
+    thread_pool::get_instance().parallel_for(parallelism, [&](std::size_t)
+    {
+        for (auto i = next_chunk.fetch_add(1u); i < count; i = next_chunk.fetch_add(1u))
+        {
+            if (i > first_stopped.load(std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            auto chunk = own_make_chunk(op, layout.begin(i), layout.begin(i + 1u));
+            chunk.associate(results[i]);
+            chunk();
+
+            if (own_is_stopped(results[i], type))
+            {
+                auto stopped = first_stopped.load(std::memory_order_relaxed);
+
+                while (i < stopped && !first_stopped.compare_exchange_weak(stopped, i))
+                {
+                }
+            }
+        }
+    });
+
+    // The first stopped chunk is reported with offsets relative to the whole operation,
+    // otherwise the last chunk is reported with the combined CRC
+    const auto is_crc     = type == hw_operation::crc || type == hw_operation::copy_crc;
+    const auto reported   = std::min(first_stopped.load(), count - 1u);
+    const auto is_stopped = first_stopped.load() != count;
+
+    byte_t record_bytes[sizeof(result)];
+    std::memcpy(record_bytes, &results[reported], sizeof(result));
+
+    if (is_stopped)
+    {
+        uint32_t bytes_completed[2] = {0u, 0u};
+        std::memcpy(&bytes_completed[0], record_bytes + record_bytes_completed_offset, sizeof(uint32_t));
+        std::memcpy(&bytes_completed[1], record_bytes + record_bytes_completed_high_offset, sizeof(uint32_t));
+
+        const auto offset = join_halves(bytes_completed[0], bytes_completed[1]) + layout.begin(reported);
+
+        bytes_completed[0] = static_cast<uint32_t>(offset);
+        bytes_completed[1] = static_cast<uint32_t>(offset >> 32u);
+        std::memcpy(record_bytes + record_bytes_completed_offset, &bytes_completed[0], sizeof(uint32_t));
+        std::memcpy(record_bytes + record_bytes_completed_high_offset, &bytes_completed[1], sizeof(uint32_t));
+    }
+    else if (is_crc)
+    {
+        const auto crc_options = static_cast<crc_option>(op.data()[operation_flags_offset]);
+        const auto parameters  = crc_parameters{any(crc_options, crc_option::bypass_reflection),
+                                               any(crc_options, crc_option::bypass_data_reflection)};
+
+        uint32_t crc = 0u;
+
+        for (std::size_t i = 0u; i < count; ++i)
+        {
+            const auto *chunk_record = reinterpret_cast<const byte_t *>(&results[i]);
+            const auto  crc_size     = layout.begin(i + 1u) - layout.begin(i);
+
+            uint32_t chunk_crc = 0u;
+            std::memcpy(&chunk_crc, chunk_record + record_crc_offset, sizeof(chunk_crc));
+
+            crc = (i == 0u) ? chunk_crc : crc::combine(crc, chunk_crc, crc_size, parameters);
+        }
+
+        std::memcpy(record_bytes + record_crc_offset, &crc, sizeof(crc));
+    }
+
+    // Status goes last: a waiter polls the first byte only
+    auto *result_bytes = reinterpret_cast<volatile byte_t *>(&res);
+
+    for (std::size_t i = 1u; i < sizeof(result); ++i)
+    {
+        result_bytes[i] = record_bytes[i];
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+    result_bytes[0] = record_bytes[0];
+
+    return status_code::ok;
+}
+
+void parallel_software_path::set_chunk_size(std::size_t chunk_size) noexcept
+{
+    chunk_size_setting.store((chunk_size == 0u) ? 0u : own_round_chunk_size(chunk_size), std::memory_order_relaxed);
+}
+
+auto parallel_software_path::get_chunk_size() noexcept -> std::size_t
+{
+    static const auto default_value = own_round_chunk_size(
+        own_get_environment_value("DML_PARALLEL_CHUNK_SIZE", default_chunk_size));
+
+    const auto chunk_size = chunk_size_setting.load(std::memory_order_relaxed);
+
+    return (chunk_size != 0u) ? chunk_size : default_value;
+}
+
+void parallel_software_path::set_parallelism(std::size_t parallelism) noexcept
+{
+    parallelism_setting.store(parallelism, std::memory_order_relaxed);
+}
+
+auto parallel_software_path::get_parallelism() noexcept -> std::size_t
+{
+    static const auto default_value = own_get_environment_value("DML_PARALLEL_THREADS",
+                                                                thread_pool::get_instance().size() + 1u);
+
+    const auto parallelism = parallelism_setting.load(std::memory_order_relaxed);
+
+    return (parallelism != 0u) ? parallelism : default_value;
+}
+}  // namespace dml::ml
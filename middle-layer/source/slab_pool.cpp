@@ -0,0 +1,284 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include <dml_ml/slab_pool.hpp>
+
+namespace dml::ml {
+
+    /**
+     * @brief Number of blocks in a magazine, also number of blocks allocated from the system at once
+     */
+    static constexpr std::size_t magazine_capacity = 64u;
+
+    /**
+     * @brief Number of block sizes served by the pool
+     */
+    static constexpr std::size_t size_classes_count = 2u;
+
+    /**
+     * @brief Array of free blocks, magazines in the depot are linked into lists
+     */
+    struct magazine {
+        magazine    *next_ptr = nullptr;
+        std::size_t count     = 0u;
+        void        *blocks[magazine_capacity];
+    };
+
+    /**
+     * @brief Free block outside of magazines, only blocks freed during a thread exit get there
+     */
+    struct loose_block {
+        loose_block *next_ptr;
+    };
+
+    /**
+     * @brief Magazines and blocks shared by all threads
+     *
+     * Lists are only pushed to and taken out entirely, so they are free from ABA problem.
+     */
+    struct depot {
+        std::atomic<magazine *>    full_ptr{nullptr};   /**< Magazines with at least one block */
+        std::atomic<magazine *>    empty_ptr{nullptr};  /**< Magazines without blocks */
+        std::atomic<loose_block *> loose_ptr{nullptr};  /**< Blocks freed without a thread cache */
+    };
+
+    static depot depots[size_classes_count];
+
+    static inline auto get_size_class(std::size_t block_size) noexcept -> std::size_t {
+        return (block_size <= slab_pool::small_block_size) ? 0u : 1u;
+    }
+
+    static inline auto get_block_size(std::size_t size_class) noexcept -> std::size_t {
+        return (size_class == 0u) ? slab_pool::small_block_size : slab_pool::large_block_size;
+    }
+
+    template <typename node_t>
+    static void push_list(std::atomic<node_t *> &head, node_t *first_ptr, node_t *last_ptr) noexcept {
+        auto *old_head_ptr = head.load(std::memory_order_relaxed);
+
+        do {
+            last_ptr->next_ptr = old_head_ptr;
+        } while (!head.compare_exchange_weak(old_head_ptr, first_ptr, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Takes one node out of a list: the whole list is taken and the rest is pushed back
+     */
+    template <typename node_t>
+    static auto pop(std::atomic<node_t *> &head) noexcept -> node_t * {
+        if (head.load(std::memory_order_relaxed) == nullptr) {
+            return nullptr;
+        }
+
+        auto *first_ptr = head.exchange(nullptr, std::memory_order_acquire);
+
+        if (first_ptr != nullptr && first_ptr->next_ptr != nullptr) {
+            auto *last_ptr = first_ptr->next_ptr;
+
+            while (last_ptr->next_ptr != nullptr) {
+                last_ptr = last_ptr->next_ptr;
+            }
+
+            push_list(head, first_ptr->next_ptr, last_ptr);
+        }
+
+        return first_ptr;
+    }
+
+    static auto get_empty_magazine(std::size_t size_class) noexcept -> magazine * {
+        auto *magazine_ptr = pop(depots[size_class].empty_ptr);
+
+        return (magazine_ptr != nullptr) ? magazine_ptr : new (std::nothrow) magazine();
+    }
+
+    static void put_magazine(std::size_t size_class, magazine *magazine_ptr) noexcept {
+        auto &shelf = (magazine_ptr->count != 0u) ? depots[size_class].full_ptr : depots[size_class].empty_ptr;
+
+        push_list(shelf, magazine_ptr, magazine_ptr);
+    }
+
+    /**
+     * @brief Fills an empty magazine with loose blocks or with new blocks allocated from the system
+     */
+    static void refill(std::size_t size_class, magazine &target) noexcept {
+        auto *block_ptr = depots[size_class].loose_ptr.exchange(nullptr, std::memory_order_acquire);
+
+        while (block_ptr != nullptr && target.count < magazine_capacity) {
+            auto *next_ptr = block_ptr->next_ptr;
+
+            target.blocks[target.count++] = block_ptr;
+            block_ptr = next_ptr;
+        }
+
+        if (block_ptr != nullptr) {
+            auto *last_ptr = block_ptr;
+
+            while (last_ptr->next_ptr != nullptr) {
+                last_ptr = last_ptr->next_ptr;
+            }
+
+            push_list(depots[size_class].loose_ptr, block_ptr, last_ptr);
+        }
+
+        if (target.count != 0u) {
+            return;
+        }
+
+        const auto block_size = get_block_size(size_class);
+        auto      *chunk_ptr  = static_cast<uint8_t *>(::operator new(block_size * magazine_capacity,
+                                                                      std::align_val_t(slab_pool::large_block_size),
+                                                                      std::nothrow));
+
+        if (chunk_ptr == nullptr) {
+            return;
+        }
+
+        for (std::size_t i = 0u; i < magazine_capacity; ++i) {
+            target.blocks[i] = chunk_ptr + (magazine_capacity - 1u - i) * block_size;
+        }
+
+        target.count = magazine_capacity;
+    }
+
+    /**
+     * @brief Magazines of a thread, they are returned to the depot when the thread exits
+     */
+    struct thread_cache {
+        magazine *loaded_ptrs[size_classes_count]   = {};  /**< Blocks are taken from and put into these ones */
+        magazine *previous_ptrs[size_classes_count] = {};  /**< Either full or empty, swapped with the loaded one */
+
+        ~thread_cache() noexcept;
+    };
+
+    static thread_local bool         is_cache_destroyed = false;
+    static thread_local thread_cache cache;
+
+    thread_cache::~thread_cache() noexcept {
+        is_cache_destroyed = true;
+
+        for (std::size_t size_class = 0u; size_class < size_classes_count; ++size_class) {
+            for (auto *magazine_ptr : {loaded_ptrs[size_class], previous_ptrs[size_class]}) {
+                if (magazine_ptr != nullptr) {
+                    put_magazine(size_class, magazine_ptr);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the thread magazines for the size class, allocates them on the first call
+     *
+     * @return false if the thread cache is destroyed or there's no memory for magazines
+     */
+    static inline auto get_magazines(std::size_t size_class, magazine **&loaded_ptr, magazine **&previous_ptr) noexcept -> bool {
+        if (is_cache_destroyed) {
+            return false;
+        }
+
+        loaded_ptr   = &cache.loaded_ptrs[size_class];
+        previous_ptr = &cache.previous_ptrs[size_class];
+
+        if (*loaded_ptr == nullptr) {
+            *loaded_ptr = get_empty_magazine(size_class);
+        }
+
+        if (*previous_ptr == nullptr) {
+            *previous_ptr = get_empty_magazine(size_class);
+        }
+
+        return *loaded_ptr != nullptr && *previous_ptr != nullptr;
+    }
+
+    auto slab_pool::allocate(std::size_t block_size) noexcept -> void * {
+        const auto size_class   = get_size_class(block_size);
+        magazine **loaded_ptr   = nullptr;
+        magazine **previous_ptr = nullptr;
+
+        if (!get_magazines(size_class, loaded_ptr, previous_ptr)) {
+            // Thread is exiting, blocks go directly from and to the system
+            return ::operator new(get_block_size(size_class), std::align_val_t(large_block_size), std::nothrow);
+        }
+
+        if ((*loaded_ptr)->count == 0u) {
+            if ((*previous_ptr)->count != 0u) {
+                std::swap(*loaded_ptr, *previous_ptr);
+            } else {
+                auto *full_ptr = pop(depots[size_class].full_ptr);
+
+                if (full_ptr != nullptr) {
+                    put_magazine(size_class, *previous_ptr);
+                    *previous_ptr = *loaded_ptr;
+                    *loaded_ptr   = full_ptr;
+                } else {
+                    refill(size_class, **loaded_ptr);
+
+                    if ((*loaded_ptr)->count == 0u) {
+                        return nullptr;
+                    }
+                }
+            }
+        }
+
+        auto &loaded = **loaded_ptr;
+
+        return loaded.blocks[--loaded.count];
+    }
+
+    void slab_pool::deallocate(void *block_ptr, std::size_t block_size) noexcept {
+        if (block_ptr == nullptr) {
+            return;
+        }
+
+        const auto size_class   = get_size_class(block_size);
+        magazine **loaded_ptr   = nullptr;
+        magazine **previous_ptr = nullptr;
+
+        if (!get_magazines(size_class, loaded_ptr, previous_ptr)) {
+            auto *loose_ptr = static_cast<loose_block *>(block_ptr);
+            push_list(depots[size_class].loose_ptr, loose_ptr, loose_ptr);
+
+            return;
+        }
+
+        if ((*loaded_ptr)->count == magazine_capacity) {
+            if ((*previous_ptr)->count != magazine_capacity) {
+                std::swap(*loaded_ptr, *previous_ptr);
+            } else {
+                auto *empty_ptr = get_empty_magazine(size_class);
+
+                if (empty_ptr == nullptr) {
+                    auto *loose_ptr = static_cast<loose_block *>(block_ptr);
+                    push_list(depots[size_class].loose_ptr, loose_ptr, loose_ptr);
+
+                    return;
+                }
+
+                put_magazine(size_class, *previous_ptr);
+                *previous_ptr = *loaded_ptr;
+                *loaded_ptr   = empty_ptr;
+            }
+        }
+
+        auto &loaded = **loaded_ptr;
+
+        loaded.blocks[loaded.count++] = block_ptr;
+    }
+}
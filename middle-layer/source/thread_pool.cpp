@@ -0,0 +1,347 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+#include <dml_ml/thread_pool.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <thread>
+
+#if defined(linux)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "numa.hpp"
+
+namespace dml::ml {
+
+    struct thread_pool::worker {
+        std::mutex            mutex;         /**< Guards the deque */
+        std::deque<task_t>    tasks;         /**< Tasks owned by the worker, owner works on the back */
+        std::thread           thread;        /**< Worker thread */
+        std::vector<uint32_t> cpus;          /**< CPUs of the worker's NUMA node it is pinned to */
+        int32_t               numa_id = -1;  /**< NUMA node of the worker */
+        std::atomic<uint64_t> executed{0u};  /**< Number of tasks completed by the worker */
+        std::atomic<uint64_t> steals{0u};    /**< Number of tasks stolen by the worker */
+    };
+
+    /**
+     * @brief Pool that owns the current thread (nullptr for non-worker threads) and the worker index
+     */
+    static thread_local const thread_pool *current_pool  = nullptr;
+    static thread_local std::size_t        current_index = 0u;
+
+    static inline auto get_available_cpus() -> std::vector<uint32_t> {
+        std::vector<uint32_t> cpus;
+
+#if defined(linux)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+
+        if (0 == sched_getaffinity(0, sizeof(set), &set)) {
+            for (uint32_t cpu = 0u; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &set)) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+#endif
+
+        if (cpus.empty()) {
+            auto count = std::max(std::thread::hardware_concurrency(), 1u);
+
+            for (uint32_t cpu = 0u; cpu < count; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        }
+
+        return cpus;
+    }
+
+    static inline void pin_current_thread(const std::vector<uint32_t> &cpus) noexcept {
+#if defined(linux)
+        if (cpus.empty()) {
+            return;
+        }
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+
+        for (auto cpu_id : cpus) {
+            if (cpu_id < CPU_SETSIZE) {
+                CPU_SET(cpu_id, &set);
+            }
+        }
+
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        (void) cpus;
+#endif
+    }
+
+    thread_pool::thread_pool() {
+        const auto cpus = get_available_cpus();
+
+        workers_.reserve(cpus.size());
+
+        // A worker per CPU, pinned to the whole node: the scheduler balances the workers inside the node,
+        // while their memory stays local
+        for (auto cpu_id : cpus) {
+            auto w = std::make_unique<worker>();
+
+            w->numa_id = util::get_numa_node_of_cpu(cpu_id);
+
+            for (auto node_cpu : util::get_numa_node_cpus(w->numa_id)) {
+                if (std::binary_search(cpus.begin(), cpus.end(), node_cpu)) {
+                    w->cpus.push_back(node_cpu);
+                }
+            }
+
+            workers_.push_back(std::move(w));
+        }
+
+        // Start threads only after the vector is complete, workers steal from each other
+        for (std::size_t i = 0u; i < workers_.size(); ++i) {
+            workers_[i]->thread = std::thread([this, i] { run(i); });
+        }
+    }
+
+    thread_pool::~thread_pool() noexcept {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        wake_condition_.notify_all();
+
+        for (auto &w : workers_) {
+            if (w->thread.joinable()) {
+                w->thread.join();
+            }
+        }
+    }
+
+    auto thread_pool::get_instance() -> thread_pool & {
+        static thread_pool instance{};
+
+        return instance;
+    }
+
+    void thread_pool::submit(task_t task) {
+        std::size_t index = 0u;
+
+        if (current_pool == this) {
+            // Nested submit from a worker: keep the task local, it is likely cache-hot
+            index = current_index;
+        } else {
+            const auto numa_id = util::get_numa_id();
+            const auto count   = workers_.size();
+            const auto start   = next_worker_.fetch_add(1u, std::memory_order_relaxed);
+
+            index = start % count;
+
+            for (std::size_t i = 0u; i < count; ++i) {
+                auto candidate = (start + i) % count;
+
+                if (workers_[candidate]->numa_id == numa_id) {
+                    index = candidate;
+                    break;
+                }
+            }
+        }
+
+        {
+            auto &w = *workers_[index];
+            std::lock_guard<std::mutex> lock(w.mutex);
+            w.tasks.push_back(std::move(task));
+
+            // Counted after the push, so a worker woken by the counter finds the task, and under the deque lock,
+            // so the worker that takes the task never decrements the counter below zero
+            pending_.fetch_add(1u, std::memory_order_release);
+        }
+
+        submitted_.fetch_add(1u, std::memory_order_relaxed);
+
+        // Empty critical section prevents a lost wake-up between predicate check and sleep
+        { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+        wake_condition_.notify_one();
+    }
+
+    void thread_pool::parallel_for(std::size_t count, const std::function<void(std::size_t)> &body) noexcept {
+        if (count == 0u) {
+            return;
+        }
+
+        // Helpers may start after the call returns, they touch the body only after taking a valid index
+        struct loop_state {
+            std::atomic<std::size_t> next{0u};
+            std::atomic<std::size_t> done{0u};
+            std::mutex               mutex;
+            std::condition_variable  finished;
+        };
+
+        std::shared_ptr<loop_state> state;
+
+        try {
+            state = std::make_shared<loop_state>();
+        } catch (...) {
+            for (std::size_t i = 0u; i < count; ++i) {
+                body(i);
+            }
+
+            return;
+        }
+
+        const auto *body_ptr = &body;
+        auto run_indices = [state, body_ptr, count]() {
+            for (auto i = state->next.fetch_add(1u); i < count; i = state->next.fetch_add(1u)) {
+                (*body_ptr)(i);
+
+                if (state->done.fetch_add(1u) + 1u == count) {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    state->finished.notify_all();
+                }
+            }
+        };
+
+        const auto helpers = std::min(count, workers_.size() + 1u) - 1u;
+
+        for (std::size_t i = 0u; i < helpers; ++i) {
+            try {
+                submit(run_indices);
+            } catch (...) {
+                break;
+            }
+        }
+
+        run_indices();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finished.wait(lock, [&state, count] { return state->done.load() == count; });
+    }
+
+    auto thread_pool::size() const noexcept -> std::size_t {
+        return workers_.size();
+    }
+
+    auto thread_pool::try_pop(std::size_t index, task_t &task) noexcept -> bool {
+        auto &w = *workers_[index];
+        std::lock_guard<std::mutex> lock(w.mutex);
+
+        if (w.tasks.empty()) {
+            return false;
+        }
+
+        task = std::move(w.tasks.back());
+        w.tasks.pop_back();
+
+        return true;
+    }
+
+    auto thread_pool::try_steal(std::size_t index, task_t &task) noexcept -> bool {
+        const auto count   = workers_.size();
+        const auto numa_id = workers_[index]->numa_id;
+
+        // First pass looks at the same NUMA node only, second pass at the remote ones
+        for (auto local_pass : {true, false}) {
+            for (std::size_t i = 1u; i < count; ++i) {
+                auto &victim = *workers_[(index + i) % count];
+
+                if ((victim.numa_id == numa_id) != local_pass) {
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+
+                if (!lock.owns_lock() || victim.tasks.empty()) {
+                    continue;
+                }
+
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+
+                workers_[index]->steals.fetch_add(1u, std::memory_order_relaxed);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void thread_pool::run(std::size_t index) noexcept {
+        auto &self = *workers_[index];
+
+        current_pool  = this;
+        current_index = index;
+
+        pin_current_thread(self.cpus);
+
+        task_t task;
+
+        while (true) {
+            if (try_pop(index, task) || try_steal(index, task)) {
+                pending_.fetch_sub(1u, std::memory_order_acq_rel);
+
+                task();
+                task = nullptr;
+
+                self.executed.fetch_add(1u, std::memory_order_relaxed);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            wake_condition_.wait(lock, [this] {
+                return pending_.load(std::memory_order_acquire) != 0u || stop_.load();
+            });
+
+            // Drain everything before exit, handlers may still wait for their results
+            if (stop_ && pending_.load(std::memory_order_acquire) == 0u) {
+                return;
+            }
+        }
+    }
+
+    auto thread_pool::queue_depth() const noexcept -> std::size_t {
+        return pending_.load(std::memory_order_relaxed);
+    }
+
+    auto thread_pool::steal_count() const noexcept -> uint64_t {
+        uint64_t steals = 0u;
+
+        for (const auto &w : workers_) {
+            steals += w->steals.load(std::memory_order_relaxed);
+        }
+
+        return steals;
+    }
+
+    auto thread_pool::get_statistics() const noexcept -> statistics {
+        statistics stats{};
+
+        stats.workers     = workers_.size();
+        stats.queue_depth = queue_depth();
+        stats.submitted   = submitted_.load(std::memory_order_relaxed);
+        stats.steals      = steal_count();
+
+        for (const auto &w : workers_) {
+            stats.executed += w->executed.load(std::memory_order_relaxed);
+        }
+
+        return stats;
+    }
+
+}
@@ -33,6 +33,7 @@
 #include "core_compare.h"
 #include "core_memory.h"
 #include "core_cpu_features.h"
+#include "core_dispatcher.h"
 #include "core_hash_functions.h"
 
 #endif //KERNEL_API_H__
@@ -49,6 +49,8 @@ extern "C" {
 typedef uint64_t pattern_t;     /**< Special type for 8-byte pattern */
 #define DML_SIZE_PATTERN_T  64  /**< pattern_t size in bits */
 
+#define DML_WIDE_DELTA_NOTE_SIZE 16u /**< Size of a wide delta note: 64-bit qword offset followed by 8 bytes of data */
+
 
 /* ------ Kernel Compare Functions ------ */
 
@@ -160,6 +162,71 @@ DML_CORE_API(dmlc_status_t, apply_delta_record_8u, (uint8_t * memory_region_ptr,
                                                    const uint32_t memory_region_size,
                                                    const uint32_t delta_record_size));
 
+/**
+ * @brief Creates wide delta record if vectors are not equal
+ *
+ * Wide delta note is @ref DML_WIDE_DELTA_NOTE_SIZE bytes: 64-bit offset of the mismatched qword
+ * followed by the qword itself, so the compared regions aren't limited by the note offset range.
+ *
+ * @param[in]  reference_vector_ptr    pointer to the base vector
+ * @param[in]  second_vector_ptr       pointer to the delta that is written into the delta record
+ * @param[in]  compared_bytes          number of bytes to compare
+ * @param[in]  first_offset            qword offset added to the offsets of the notes, used for
+ *                                     a record of a region compared by parts
+ * @param[in]  delta_record_max_size   maximal delta record size
+ * @param[out] delta_record_ptr        pointer to the delta record
+ * @param[out] record_size_ptr         created delta record size
+ *
+ * @warning: Compared vectors addresses must be aligned to a multiple of 8.
+ * @warning: Number of bytes to compare must be multiple of 8.
+ * @warning: Number of available bytes in delta record must be multiple of 16.
+ *
+ * @return
+ *      - @ref DML_STATUS_OK;
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR;
+ *      - @ref DML_STATUS_DELTA_ALIGN_ERROR in case if vector address or size is not aligned to be a
+ *             multiple of 8;
+ *      - @ref DML_STATUS_DELTA_INPUT_SIZE_ERROR in case if max_delta_record_size is zero or
+ *             not a multiple of 16u;
+ *      - @ref DML_STATUS_DELTA_RECORD_SIZE_ERROR in case if max_delta_record_size is not sufficient
+ *             for delta record creation, the record contains the notes that fit
+ *
+ */
+DML_CORE_API(dmlc_status_t, create_wide_delta_record_8u, (const uint8_t *reference_vector_ptr,
+                                                         const uint8_t *second_vector_ptr,
+                                                         const uint32_t compared_bytes,
+                                                         const uint64_t first_offset,
+                                                         const uint32_t delta_record_max_size,
+                                                         uint8_t *delta_record_ptr,
+                                                         uint32_t *const record_size_ptr));
+
+/**
+ * @brief Applies wide delta record to the contents of memory at destination address
+ *
+ * @param[out] memory_region_ptr    pointer to a memory region that is updated with a delta
+ * @param[in]  delta_record_ptr     pointer to a wide delta record
+ * @param[in]  memory_region_size   destination size
+ * @param[in]  delta_record_size    delta record size
+ *
+ * @warning Memory region byte size must be multiply of 8.
+ * @warning Delta record byte size must be multiply of 16.
+ * @warning Function does not support vectors' overlap.
+ *
+ * @return
+ *      - @ref DML_STATUS_OK;
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR;
+ *      - @ref DML_STATUS_DELTA_ALIGN_ERROR in case if memory_region_ptr address or memory region size
+ *             is not aligned a multiple of 8;
+ *      - @ref DML_STATUS_DELTA_RECORD_SIZE_ERROR in case if delta record size is not multiple of 16;
+ *      - @ref DML_STATUS_OVERLAPPING_BUFFER_ERROR in case if vectors overlap
+ *      - @ref DML_STATUS_MEMORY_OVERFLOW_ERROR in case if offset is outside of the memory region,
+ *             the notes before it are applied
+ */
+DML_CORE_API(dmlc_status_t, apply_wide_delta_record_8u, (uint8_t *memory_region_ptr,
+                                                        const uint8_t *delta_record_ptr,
+                                                        const uint64_t memory_region_size,
+                                                        const uint32_t delta_record_size));
+
 #ifdef __cplusplus
 }
 #endif
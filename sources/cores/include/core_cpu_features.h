@@ -59,6 +59,20 @@ DML_CORE_OWN_INLINE(void, cpuid, (int info[4], int info_type, int info_subtype))
 {
     __cpuidex(info, info_type, info_subtype);
 }
+
+/**
+ * @brief Returns value of extended control register, tells which register states are enabled by the OS
+ *
+ * @param[in] index - index of extended control register (0 for XCR0)
+ *
+ * @return
+ *      Value of the register
+ *
+ */
+DML_CORE_OWN_INLINE(uint64_t, xgetbv, (uint32_t index))
+{
+    return _xgetbv(index);
+}
 #else
 
 //  GCC Intrinsics 
@@ -80,8 +94,89 @@ DML_CORE_OWN_INLINE(void, cpuid, (int info[4], int info_type, int info_subtype))
 {
     __cpuid_count(info_type, info_subtype, info[0], info[1], info[2], info[3]);
 }
+
+/**
+ * @brief Returns value of extended control register, tells which register states are enabled by the OS
+ *
+ * @param[in] index - index of extended control register (0 for XCR0)
+ *
+ * @return
+ *      Value of the register
+ *
+ */
+DML_CORE_OWN_INLINE(uint64_t, xgetbv, (uint32_t index))
+{
+    uint32_t eax = 0u;
+    uint32_t edx = 0u;
+
+    // Encoded manually, the intrinsic requires -mxsave
+    __asm__ volatile (".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(index));
+
+    return ((uint64_t) edx << 32u) | eax;
+}
 #endif
 
+/**
+ * @brief Checks if CPU and OS both support the instructions used by AVX-512 kernels
+ *
+ * @details AVX512F, AVX512BW, AVX512VL, AVX512DQ, CLFLUSHOPT, CLWB and PCLMULQDQ are required,
+ * also the OS must save opmask and ZMM register states (XCR0 bits 1, 2, 5, 6, 7).
+ *
+ * @return
+ *      - 1 if AVX-512 kernels can be used;
+ *      - 0 otherwise.
+ *
+ */
+DML_CORE_OWN_INLINE(int, is_avx512_supported, (void))
+{
+    const uint64_t xcr0_avx512_mask = 0xE6u;
+    int32_t        info[4]          = {0, 0, 0, 0};
+
+    dmlc_own_cpuid(info, 0, 0);
+    if (info[0] < 7)
+    {
+        return 0;
+    }
+
+    // Leaf 1: ECX[27] - OSXSAVE, ECX[1] - PCLMULQDQ
+    dmlc_own_cpuid(info, 1, 0);
+    if (!(info[2] & (1 << 27)) || !(info[2] & (1 << 1)))
+    {
+        return 0;
+    }
+
+    if ((dmlc_own_xgetbv(0u) & xcr0_avx512_mask) != xcr0_avx512_mask)
+    {
+        return 0;
+    }
+
+    // Leaf 7: EBX[16] - AVX512F, EBX[17] - AVX512DQ, EBX[23] - CLFLUSHOPT,
+    //         EBX[24] - CLWB, EBX[30] - AVX512BW, EBX[31] - AVX512VL
+    dmlc_own_cpuid(info, 7, 0);
+    const uint32_t features = (uint32_t) info[1];
+    const uint32_t required = (1u << 16u) | (1u << 17u) | (1u << 23u) | (1u << 24u) | (1u << 30u) | (1u << 31u);
+
+    return (features & required) == required;
+}
+
+/**
+ * @brief Checks if CPU supports carry-less multiplication used by the default CRC kernels
+ *
+ * @return
+ *      - 1 if PCLMULQDQ and SSE4.1 are supported;
+ *      - 0 otherwise.
+ *
+ */
+DML_CORE_OWN_INLINE(int, is_pclmul_supported, (void))
+{
+    int32_t info[4] = {0, 0, 0, 0};
+
+    // Leaf 1: ECX[1] - PCLMULQDQ, ECX[19] - SSE4.1
+    dmlc_own_cpuid(info, 1, 0);
+
+    return (info[2] & (1 << 1)) && (info[2] & (1 << 19));
+}
+
 /**
  * @brief Flushes the processor caches at the destination address with сache line invalidation from all cache hierarchy.
  *
@@ -164,6 +259,33 @@ DML_CORE_OWN_INLINE(dml_status_t, get_max_cache_size, (int32_t * size))
     }
 }
 
+/**
+ * @brief Threshold used when the cache size can't be detected
+ */
+#define OWN_DEFAULT_NON_TEMPORAL_THRESHOLD (4u * 1024u * 1024u)
+
+/**
+ * @brief Returns size, starting from which memory kernels bypass the cache with non-temporal stores
+ *
+ * @details Half of the largest cache is taken: source and destination both compete for it,
+ * so a bigger operation evicts the whole cache and leaves nothing useful in it.
+ *
+ * @return
+ *      Threshold in bytes
+ *
+ */
+DML_CORE_OWN_INLINE(uint32_t, get_non_temporal_threshold, (void))
+{
+    int32_t size = 0;
+
+    if ((DML_STATUS_OK != dmlc_own_get_max_cache_size(&size)) || (size <= 0))
+    {
+        return OWN_DEFAULT_NON_TEMPORAL_THRESHOLD;
+    }
+
+    return (uint32_t) size / 2u;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -62,8 +62,14 @@ extern "C" {
 #define DML_CORE_OWN_INLINE(type, name, arg) type static inline dmlc_own_##name arg
 
 #if !defined( DML_CORE_API )
+#if defined( DML_CORE_DISPATCH ) && defined( AVX512 )
+#define DML_CORE_API(type, name, arg) type DML_CORE_STDCALL dmlc_k0_##name arg /**< AVX-512 kernel, reached through the dispatcher */
+#elif defined( DML_CORE_DISPATCH ) && defined( PX )
+#define DML_CORE_API(type, name, arg) type DML_CORE_STDCALL dmlc_px_##name arg /**< Default kernel, reached through the dispatcher */
+#else
 #define DML_CORE_API(type, name, arg) type DML_CORE_STDCALL dmlc_##name arg /**< Declaration macros to manipulate function name */
 #endif
+#endif
 
 /* ------ Statuses ------ */
 
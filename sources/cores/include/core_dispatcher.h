@@ -0,0 +1,77 @@
+/*
+ * Copyright 2020-2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @date 10/18/2026
+ *
+ * @defgroup core_public_dispatcher Kernels Dispatcher
+ * @ingroup core_public_features
+ * @{
+ *
+ * @brief Runtime selection of the kernel set.
+ *
+ * @details Both default (px) and AVX-512 (k0) kernel sets are linked into the library.
+ * Every public core function calls the kernel from a table, which is filled once at library load
+ * according to CPUID. The `DML_CORE_ARCH` environment variable forces a kernel set:
+ *  -   `px` - default kernels;
+ *  -   `avx512` - AVX-512 kernels, ignored if the CPU does not support them.
+ *
+ */
+
+#include "core_definitions.h"
+
+#ifndef DML_KERNEL_DISPATCHER_H__
+#define DML_KERNEL_DISPATCHER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Kernel sets available in the library
+ */
+typedef enum
+{
+    DMLC_ARCH_PX     = 0, /**< Default kernels */
+    DMLC_ARCH_AVX512 = 1  /**< AVX-512 kernels */
+} dmlc_arch_t;
+
+/**
+ * @brief Returns kernel set used by the core functions
+ *
+ * @return
+ *      - @ref DMLC_ARCH_PX;
+ *      - @ref DMLC_ARCH_AVX512.
+ */
+DML_CORE_API(dmlc_arch_t, get_active_arch, (void));
+
+/**
+ * @brief Returns printable name of a kernel set
+ *
+ * @param[in] arch  kernel set
+ *
+ * @return
+ *      Null-terminated name ("px" or "avx512"), "unknown" for unsupported values
+ */
+DML_CORE_API(const char *, get_arch_name, (dmlc_arch_t arch));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //DML_KERNEL_DISPATCHER_H__
+
+/** @} */
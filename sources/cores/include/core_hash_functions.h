@@ -71,6 +71,32 @@ DML_CORE_API(dmlc_status_t, calculate_crc_16u, (const uint8_t  *const memory_reg
                                                 uint16_t polynomial));
 
 
+/**
+ * @brief Calculates CRC16 hash/checksum for a series of equally sized memory blocks
+ *
+ * @param[in]     memory_region_ptr        address of the first block to hash
+ * @param[in]     block_size               size of every block, in bytes, to hash
+ * @param[in]     block_stride             distance, in bytes, between starts of neighbouring blocks
+ * @param[in]     block_count              number of blocks
+ * @param[in,out] crc_ptr                  array of block_count CRC seeds / results
+ * @param[in]     polynomial	           polynomial to XORing
+ *
+ * @note No memory alignment is required;
+ * @note Several blocks are hashed at once, so the result is the same as
+ *       @ref dmlc_calculate_crc_16u() called for every block but it is faster for small blocks
+ *
+ * @return
+ *      - @ref DML_STATUS_OK;
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR.
+ */
+DML_CORE_API(dmlc_status_t, calculate_crc_16u_blocks, (const uint8_t  *const memory_region_ptr,
+                                                       uint32_t block_size,
+                                                       uint32_t block_stride,
+                                                       uint32_t block_count,
+                                                       uint16_t *const crc_ptr,
+                                                       uint16_t polynomial));
+
+
 /**
  * @brief Calculates CRC32 hash/checksum for a signified memory region
  *
@@ -113,6 +139,96 @@ DML_CORE_API(dmlc_status_t, calculate_crc_reflected_32u, (const uint8_t *const m
                                                           uint32_t polynomial ) );
 
 
+/**
+ * @brief Copies a memory region and calculates CRC32 hash/checksum of it in a single pass
+ *
+ * @param[in]     source_ptr               address of memory region to copy and hash
+ * @param[out]    destination_ptr          address of destination memory region
+ * @param[in]     bytes_to_process         memory regions size, in bytes
+ * @param[in,out] crc_ptr                  CRC seed / result
+ * @param[in]     polynomial	           polynomial to XORing
+ *
+ * @note No memory alignment is required;
+ * @note Every byte of the source is read once, the result is the same as
+ *       @ref dmlc_copy_8u() followed by @ref dmlc_calculate_crc_32u()
+ *
+ * @return
+ *      - @ref DML_STATUS_OK;
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR.
+ */
+DML_CORE_API(dmlc_status_t, copy_with_crc_32u, (const uint8_t *const source_ptr,
+                                                uint8_t *const destination_ptr,
+                                                uint32_t bytes_to_process,
+                                                uint32_t *const crc_ptr,
+                                                uint32_t polynomial));
+
+
+/**
+ * @brief Copies a memory region and calculates CRC32 hash/checksum of it with reversed bytes bits in a single pass
+ *
+ * @param[in]     source_ptr               address of memory region to copy and hash
+ * @param[out]    destination_ptr          address of destination memory region
+ * @param[in]     bytes_to_process         memory regions size, in bytes
+ * @param[in,out] crc_ptr                  CRC seed / result
+ * @param[in]     polynomial	           polynomial to XORing
+ *
+ * @note No memory alignment is required;
+ * @note Every byte of the source is read once, the result is the same as
+ *       @ref dmlc_copy_8u() followed by @ref dmlc_calculate_crc_reflected_32u()
+ *
+ * @return
+ *      - @ref DML_STATUS_OK;
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR.
+ */
+DML_CORE_API(dmlc_status_t, copy_with_crc_reflected_32u, (const uint8_t *const source_ptr,
+                                                          uint8_t *const destination_ptr,
+                                                          uint32_t bytes_to_process,
+                                                          uint32_t *const crc_ptr,
+                                                          uint32_t polynomial));
+
+/**
+ * @brief Combines CRC32 values of two adjacent memory regions into CRC32 of the both regions
+ *
+ * @param[in,out] crc_ptr                  CRC of the first region computed with any seed / CRC of the both regions
+ * @param[in]     second_crc               CRC of the second region computed with zero seed
+ * @param[in]     second_size              size of the second region, in bytes
+ * @param[in]     polynomial	           polynomial the CRC values are computed with
+ *
+ * @note The result is the same as @ref dmlc_calculate_crc_32u() called for the both regions at once
+ *       with the seed of the first one. It holds for @ref dmlc_calculate_crc_reflected_32u() values too;
+ * @note Regions may be hashed in parallel then and combined in O(log(second_size)) multiplications,
+ *       operators of recently combined sizes are cached per thread.
+ *
+ * @return
+ *      - @ref DML_STATUS_OK;
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR.
+ */
+DML_CORE_API(dmlc_status_t, crc32_combine, (uint32_t *const crc_ptr,
+                                            uint32_t second_crc,
+                                            uint64_t second_size,
+                                            uint32_t polynomial));
+
+/**
+ * @brief Combines CRC16 values of two adjacent memory regions into CRC16 of the both regions
+ *
+ * @param[in,out] crc_ptr                  CRC of the first region computed with any seed / CRC of the both regions
+ * @param[in]     second_crc               CRC of the second region computed with zero seed
+ * @param[in]     second_size              size of the second region, in bytes
+ * @param[in]     polynomial	           polynomial the CRC values are computed with
+ *
+ * @note The result is the same as @ref dmlc_calculate_crc_16u() called for the both regions at once
+ *       with the seed of the first one.
+ *
+ * @return
+ *      - @ref DML_STATUS_OK;
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR.
+ */
+DML_CORE_API(dmlc_status_t, crc16_combine, (uint16_t *const crc_ptr,
+                                            uint16_t second_crc,
+                                            uint64_t second_size,
+                                            uint16_t polynomial));
+
+
 #ifdef __cplusplus
 }
 #endif
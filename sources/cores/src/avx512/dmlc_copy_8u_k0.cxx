@@ -302,6 +302,101 @@ DML_CORE_OWN_INLINE(__m512i, mm512_alignr_epi8, (__m512i a, __m512i b, uint32_t
     }
 }
 
+/**
+ * @brief Distance, in bytes, the source is prefetched ahead of the streaming loops
+ */
+#define OWN_STREAM_PREFETCH_DISTANCE 1024u
+
+/**
+ * @brief Returns mask of the lowest `length` bytes of a 64-byte vector, `length` is less than 64
+ */
+DML_CORE_OWN_INLINE(__mmask64, head_mask, (uint32_t length))
+{
+    return (__mmask64) ((1llu << length) - 1u);
+}
+
+/**
+ * @brief Copies a memory region with non-temporal stores, the destination does not pollute the cache
+ *
+ * @note Ends with sfence, so the data is globally visible when the function returns
+ */
+DML_CORE_OWN_INLINE(void, stream_copy_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length))
+{
+    // Streaming stores need 64-byte aligned destination
+    uint32_t head = (64u - ((uint64_t)dst_ptr & 0x3Fu)) & 0x3Fu;
+    head = (head < length) ? head : length;
+
+    if (0u != head) {
+        __mmask64 mask = dmlc_own_head_mask(head);
+        _mm512_mask_storeu_epi8(dst_ptr, mask, _mm512_maskz_loadu_epi8(mask, src_ptr));
+        src_ptr += head;
+        dst_ptr += head;
+        length -= head;
+    }
+
+    while (length >= 256u) {
+        _mm_prefetch((const char *)(src_ptr + OWN_STREAM_PREFETCH_DISTANCE), _MM_HINT_NTA);
+        _mm_prefetch((const char *)(src_ptr + OWN_STREAM_PREFETCH_DISTANCE + 64u), _MM_HINT_NTA);
+        _mm_prefetch((const char *)(src_ptr + OWN_STREAM_PREFETCH_DISTANCE + 128u), _MM_HINT_NTA);
+        _mm_prefetch((const char *)(src_ptr + OWN_STREAM_PREFETCH_DISTANCE + 192u), _MM_HINT_NTA);
+        __m512i zmm0 = _mm512_loadu_si512((const __m512i *)src_ptr);
+        __m512i zmm1 = _mm512_loadu_si512((const __m512i *)(src_ptr + 64u));
+        __m512i zmm2 = _mm512_loadu_si512((const __m512i *)(src_ptr + 128u));
+        __m512i zmm3 = _mm512_loadu_si512((const __m512i *)(src_ptr + 192u));
+        _mm512_stream_si512((__m512i *)dst_ptr, zmm0);
+        _mm512_stream_si512((__m512i *)(dst_ptr + 64u), zmm1);
+        _mm512_stream_si512((__m512i *)(dst_ptr + 128u), zmm2);
+        _mm512_stream_si512((__m512i *)(dst_ptr + 192u), zmm3);
+        src_ptr += 256u;
+        dst_ptr += 256u;
+        length -= 256u;
+    }
+
+    while (length >= 64u) {
+        _mm512_stream_si512((__m512i *)dst_ptr, _mm512_loadu_si512((const __m512i *)src_ptr));
+        src_ptr += 64u;
+        dst_ptr += 64u;
+        length -= 64u;
+    }
+
+    if (0u != length) {
+        __mmask64 mask = dmlc_own_head_mask(length);
+        _mm512_mask_storeu_epi8(dst_ptr, mask, _mm512_maskz_loadu_epi8(mask, src_ptr));
+    }
+
+    // Non-temporal stores are weakly ordered
+    _mm_sfence();
+}
+
+/**
+ * @brief Copies a memory region from the end to the beginning, destination may overlap the source tail
+ *
+ * @details Every 64-byte block is loaded before it is stored, so an overlapping destination
+ * above the source never overwrites not yet copied bytes.
+ */
+DML_CORE_OWN_INLINE(void, copy_backward_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length))
+{
+    // Blocks are stored from the end, so the end of the destination is aligned first
+    uint32_t tail = (uint32_t)((uint64_t)(dst_ptr + length) & 0x3Fu);
+    tail = (tail < length) ? tail : length;
+
+    if (0u != tail) {
+        __mmask64 mask = dmlc_own_head_mask(tail);
+        length -= tail;
+        _mm512_mask_storeu_epi8(dst_ptr + length, mask, _mm512_maskz_loadu_epi8(mask, src_ptr + length));
+    }
+
+    while (length >= 64u) {
+        length -= 64u;
+        _mm512_store_si512((__m512i *)(dst_ptr + length), _mm512_loadu_si512((const __m512i *)(src_ptr + length)));
+    }
+
+    if (0u != length) {
+        __mmask64 mask = dmlc_own_head_mask(length);
+        _mm512_mask_storeu_epi8(dst_ptr, mask, _mm512_maskz_loadu_epi8(mask, src_ptr));
+    }
+}
+
 DML_CORE_OWN_INLINE(void, copy_8u, (const uint8_t *src_ptr,
     uint8_t *dst_ptr,
     uint32_t length))
@@ -311,13 +406,10 @@ DML_CORE_OWN_INLINE(void, copy_8u, (const uint8_t *src_ptr,
         return;
     }
 
-    if (length > 32000) {
-        int32_t size = 0u;
-        dmlc_own_get_max_cache_size(&size);
-        if ((size > 0) && (length > (uint32_t)size)) {
-            dmlc_own_px_copy_8u_unrolled(src_ptr, dst_ptr, length);
-            return;
-        }
+    // Copies bigger than the cache would only evict it, they go straight to memory
+    if ((length > 32000u) && (length > dmlc_own_get_non_temporal_threshold())) {
+        dmlc_own_stream_copy_8u(src_ptr, dst_ptr, length);
+        return;
     }
 
     uint32_t align_dst = 64u - ((uint64_t)dst_ptr & 0x3F);
@@ -719,31 +811,21 @@ DML_CORE_OWN_INLINE(void, move_8u, (const uint8_t *const source_ptr,
     uint8_t *const destination_ptr,
     uint32_t       bytes_to_process))
 {
+    const uint8_t is_overlapped = (source_ptr + bytes_to_process > destination_ptr) &&
+                                  (destination_ptr + bytes_to_process > source_ptr);
+
+    // Overlapped lines were just read, streaming them out to memory would only slow the move down
+    if (!is_overlapped && (bytes_to_process > 32000u) && (bytes_to_process > dmlc_own_get_non_temporal_threshold())) {
+        dmlc_own_stream_copy_8u(source_ptr, destination_ptr, bytes_to_process);
+        return;
+    }
+
     if (source_ptr > destination_ptr || source_ptr + bytes_to_process <= destination_ptr) {
         dmlc_own_px_copy_8u_not_unrolled(source_ptr, destination_ptr, bytes_to_process);
         return;
     }
 
-    // Current position in source vector
-    const uint8_t *source_current_ptr = (const uint8_t *)(source_ptr + bytes_to_process);
-
-    // Current position in destination vector
-    uint8_t *destination_current_ptr = (uint8_t *)(destination_ptr + bytes_to_process);
-
-    while (0u < bytes_to_process)
-    {
-        // Shift position in destination vector
-        destination_current_ptr--;
-
-        // Shift position in source vector
-        source_current_ptr--;
-
-        // Copy 1 byte
-        (*destination_current_ptr) = (*source_current_ptr);
-
-        // Decrease bytes counter
-        bytes_to_process -= sizeof(uint8_t);
-    }
+    dmlc_own_copy_backward_8u(source_ptr, destination_ptr, bytes_to_process);
 }
 
 
@@ -752,33 +834,56 @@ DML_CORE_OWN_INLINE(void, dualcast_copy_8u, (const uint8_t *const source_ptr,
     uint8_t *const second_destination_ptr,
     uint32_t       bytes_to_process))
 {
-    // Current position in source vector 64u
-    const uint8_t *source_current_ptr = (const uint8_t *)source_ptr;
-
-    // Current position in first destination vector 64u
-    uint8_t *first_destination_current_ptr = (uint8_t *)first_destination_ptr;
-
-    // Current position in second destination vector 64u
-    uint8_t *second_destination_current_ptr = (uint8_t *)second_destination_ptr;
-
-    while (0 < bytes_to_process)
-    {
-        // Copy 1 byte to first destination vector
-        (*first_destination_current_ptr) = (*source_current_ptr);
-
-        // Copy 1 byte to second destination vector
-        (*second_destination_current_ptr) = (*source_current_ptr);
+    const uint8_t *src_ptr    = source_ptr;
+    uint8_t       *dst1_ptr   = first_destination_ptr;
+    uint8_t       *dst2_ptr   = second_destination_ptr;
+    uint32_t       length     = bytes_to_process;
+
+    // Both destinations are written, so the footprint is three buffers
+    const uint8_t is_streaming = (length > dmlc_own_get_non_temporal_threshold() / 2u) ? OWN_BOOL_TRUE : OWN_BOOL_FALSE;
+
+    // Destinations have equal 0:11 bits, aligning the first one aligns both
+    uint32_t head = (64u - ((uint64_t)dst1_ptr & 0x3Fu)) & 0x3Fu;
+    head = (head < length) ? head : length;
+
+    if (0u != head) {
+        __mmask64 mask = dmlc_own_head_mask(head);
+        __m512i zmm0 = _mm512_maskz_loadu_epi8(mask, src_ptr);
+        _mm512_mask_storeu_epi8(dst1_ptr, mask, zmm0);
+        _mm512_mask_storeu_epi8(dst2_ptr, mask, zmm0);
+        src_ptr += head;
+        dst1_ptr += head;
+        dst2_ptr += head;
+        length -= head;
+    }
+
+    while (length >= 64u) {
+        __m512i zmm0 = _mm512_loadu_si512((const __m512i *)src_ptr);
 
-        // Shift position in first destination vector
-        first_destination_current_ptr++;
+        if (is_streaming) {
+            _mm_prefetch((const char *)(src_ptr + OWN_STREAM_PREFETCH_DISTANCE), _MM_HINT_NTA);
+            _mm512_stream_si512((__m512i *)dst1_ptr, zmm0);
+            _mm512_stream_si512((__m512i *)dst2_ptr, zmm0);
+        }
+        else {
+            _mm512_store_si512((__m512i *)dst1_ptr, zmm0);
+            _mm512_store_si512((__m512i *)dst2_ptr, zmm0);
+        }
 
-        // Shift position in second destination vector
-        second_destination_current_ptr++;
+        src_ptr += 64u;
+        dst1_ptr += 64u;
+        dst2_ptr += 64u;
+        length -= 64u;
+    }
 
-        // Shift position in source vector
-        source_current_ptr++;
+    if (0u != length) {
+        __mmask64 mask = dmlc_own_head_mask(length);
+        __m512i zmm0 = _mm512_maskz_loadu_epi8(mask, src_ptr);
+        _mm512_mask_storeu_epi8(dst1_ptr, mask, zmm0);
+        _mm512_mask_storeu_epi8(dst2_ptr, mask, zmm0);
+    }
 
-        // Decrease bytes counter
-        bytes_to_process -= sizeof(uint8_t);
+    if (is_streaming) {
+        _mm_sfence();
     }
-}
\ No newline at end of file
+}
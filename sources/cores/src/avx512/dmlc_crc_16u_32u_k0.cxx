@@ -16,7 +16,9 @@
 
 /**
  * @brief Contain implementation of the follow functions:
+ *      - @ref dmlc_calculate_crc_16u()
  *      - @ref dmlc_calculate_crc_32u()
+ *      - @ref dmlc_calculate_crc_reflected_32u()
  *
  * @date 7/20/2021
  *
@@ -122,16 +124,63 @@ static inline void own_gen_crc_opt_poly_8u(uint64_t poly, uint8_t optPoly[128])
     }
 }
 
+/**
+ * @brief Folding constants generated for a polynomial
+ */
+typedef struct
+{
+    uint64_t poly;          /**< Polynomial the constants are generated for (0 if none) */
+    uint64_t opt_poly[16];  /**< Constants, 128 bytes */
+} own_crc_opt_poly_cache_t;
+
+/**
+ * @brief Returns folding constants for a polynomial, constants are regenerated when the polynomial changes
+ *
+ * @note The cache is per thread, so no synchronization is needed.
+ */
+static inline const uint8_t *dmlc_own_get_crc_opt_poly(uint64_t poly)
+{
+    static OWN_THREAD_LOCAL own_crc_opt_poly_cache_t cache;
+
+    if (cache.poly != poly)
+    {
+        own_gen_crc_opt_poly_8u(poly, (uint8_t *) cache.opt_poly);
+        cache.poly = poly;
+    }
+
+    return (const uint8_t *) cache.opt_poly;
+}
+
 DML_CORE_OWN_INLINE(dmlc_status_t, calculate_crc_32u, (const uint8_t* const memory_region_ptr,
         uint32_t bytes_to_hash,
         uint32_t* const crc_ptr,
         uint32_t polynomial))
 {
     uint64_t poly = (uint64_t)polynomial | ((uint64_t)1u << (uint64_t)32u);
-    uint8_t  opt_poly_ptr[128];
 
-    own_gen_crc_opt_poly_8u(poly, opt_poly_ptr);
-    own_CRC_8u_k0(memory_region_ptr, bytes_to_hash, poly, opt_poly_ptr, *crc_ptr, crc_ptr);
+    own_CRC_8u_k0(memory_region_ptr, bytes_to_hash, poly, dmlc_own_get_crc_opt_poly(poly), *crc_ptr, crc_ptr);
+    return DML_STATUS_OK;
+}
+
+DML_CORE_OWN_INLINE(dmlc_status_t, calculate_crc_16u, (const uint8_t* const memory_region_ptr,
+        uint32_t bytes_to_hash,
+        uint16_t* const crc_ptr,
+        uint16_t polynomial))
+{
+    if (bytes_to_hash < OWN_CRC_FOLD_MIN_LENGTH)
+    {
+        (*crc_ptr) = dmlc_own_crc_16u_slice_8(memory_region_ptr, bytes_to_hash, (*crc_ptr), polynomial);
+
+        return DML_STATUS_OK;
+    }
+
+    // Non-reflected CRC16 equals to high half of CRC32 with the polynomial and the seed shifted by 16 bits
+    uint64_t poly = ((uint64_t)polynomial << 16u) | ((uint64_t)1u << (uint64_t)32u);
+    uint32_t crc  = (uint32_t)(*crc_ptr) << 16u;
+
+    own_CRC_8u_k0(memory_region_ptr, bytes_to_hash, poly, dmlc_own_get_crc_opt_poly(poly), crc, &crc);
+
+    (*crc_ptr) = (uint16_t)(crc >> 16u);
     return DML_STATUS_OK;
 }
 
@@ -615,4 +664,35 @@ dmlc_status_t dmlc_own_calculate_crc_32u_noopt(const uint8_t* const memory_regio
     (*crc_ptr) = current_crc;
 
     return DML_STATUS_OK;
-}
\ No newline at end of file
+}
+
+DML_CORE_OWN_INLINE(dmlc_status_t, calculate_crc_reflected_32u, (const uint8_t* const memory_region_ptr,
+        uint32_t bytes_to_hash,
+        uint32_t* const crc_ptr,
+        uint32_t polynomial))
+{
+    // CRC over bit-reversed bytes equals to bit-reversed LSB-first CRC with bit-reversed state and polynomial
+    const uint32_t reflected_polynomial = dmlc_own_reverse_32u(polynomial);
+    uint32_t       reflected_crc        = dmlc_own_reverse_32u(*crc_ptr);
+    const uint8_t *src_ptr              = memory_region_ptr;
+
+    if (bytes_to_hash >= OWN_CRC_FOLD_MIN_LENGTH)
+    {
+        const uint32_t blocks_count = bytes_to_hash / 16u;
+
+        reflected_crc = dmlc_own_crc_reflected_32u_fold(src_ptr,
+                                                        NULL,
+                                                        blocks_count,
+                                                        reflected_crc,
+                                                        dmlc_own_get_crc_reflected_fold(polynomial));
+
+        src_ptr       += blocks_count * 16u;
+        bytes_to_hash -= blocks_count * 16u;
+    }
+
+    reflected_crc = dmlc_own_crc_reflected_32u_slice_16(src_ptr, bytes_to_hash, reflected_crc, reflected_polynomial);
+
+    (*crc_ptr) = dmlc_own_reverse_32u(reflected_crc);
+
+    return DML_STATUS_OK;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2020-2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+ /**
+  * @brief Contain AVX-512 implementation of the follow functions:
+  *      - @ref dmlc_own_create_delta_record_8u()
+  *
+  */
+
+/**
+ * @brief Checks if 32 regions starting from the given pointers are equal
+ */
+DML_CORE_OWN_INLINE(uint32_t, is_equal_256, (const region_t *reference_ptr, const region_t *second_ptr))
+{
+    __m512i difference = _mm512_setzero_si512();
+
+    for (uint32_t j = 0u; j < 4u; j++)
+    {
+        difference = _mm512_or_si512(difference,
+                                     _mm512_xor_si512(_mm512_loadu_si512((const void *) (reference_ptr + j * 8u)),
+                                                      _mm512_loadu_si512((const void *) (second_ptr + j * 8u))));
+    }
+
+    return 0u == _mm512_test_epi64_mask(difference, difference);
+}
+
+DML_CORE_OWN_INLINE(dmlc_status_t, create_delta_record_8u, (const region_t *reference_ptr,
+                                                            const region_t *second_ptr,
+                                                            uint32_t regions_count,
+                                                            uint64_t first_offset,
+                                                            uint8_t *delta_record_ptr,
+                                                            uint32_t note_size,
+                                                            uint32_t delta_note_count,
+                                                            uint32_t *notes_count_ptr))
+{
+    const __m512i region_indices = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+    uint64_t      data_buffer[8];
+    uint64_t      offset_buffer[8];
+    uint32_t      notes_count    = 0u;
+    uint32_t      i              = 0u;
+
+    (*notes_count_ptr) = 0u;
+
+    while (i < regions_count)
+    {
+        // Skip equal 256-byte chunks
+        while (((i + 32u) <= regions_count) && dmlc_own_is_equal_256(reference_ptr + i, second_ptr + i))
+        {
+            i += 32u;
+        }
+
+        const uint32_t chunk_end = ((i + 32u) <= regions_count) ? (i + 32u) : regions_count;
+
+        for (; i < chunk_end; i += 8u)
+        {
+            const uint32_t  remaining = chunk_end - i;
+            const __mmask8  load_mask = (remaining >= 8u) ? (__mmask8) 0xFFu : (__mmask8) ((1u << remaining) - 1u);
+            const __m512i   reference = _mm512_maskz_loadu_epi64(load_mask, (const void *) (reference_ptr + i));
+            const __m512i   second    = _mm512_maskz_loadu_epi64(load_mask, (const void *) (second_ptr + i));
+            const __mmask8  mismatch  = _mm512_mask_cmpneq_epi64_mask(load_mask, reference, second);
+
+            if (0u == mismatch)
+            {
+                continue;
+            }
+
+            // Pack mismatched regions and their offsets to the front, then interleave them into notes
+            const __m512i offsets = _mm512_add_epi64(region_indices, _mm512_set1_epi64((long long) (first_offset + i)));
+
+            _mm512_storeu_si512((void *) data_buffer, _mm512_maskz_compress_epi64(mismatch, reference));
+            _mm512_storeu_si512((void *) offset_buffer, _mm512_maskz_compress_epi64(mismatch, offsets));
+
+            const uint32_t mismatch_count = (uint32_t) _mm_popcnt_u32((uint32_t) mismatch);
+            const uint32_t free_count     = delta_note_count - notes_count;
+            const uint32_t write_count    = (mismatch_count < free_count) ? mismatch_count : free_count;
+
+            for (uint32_t j = 0u; j < write_count; j++)
+            {
+                dmlc_own_store_delta_note(delta_record_ptr, note_size, notes_count + j, offset_buffer[j], data_buffer[j]);
+            }
+
+            notes_count += write_count;
+
+            if (write_count < mismatch_count)
+            {
+                (*notes_count_ptr) = notes_count;
+
+                return DML_STATUS_DELTA_RECORD_SIZE_ERROR;
+            }
+        }
+    }
+
+    (*notes_count_ptr) = notes_count;
+
+    return DML_STATUS_OK;
+}
@@ -23,6 +23,7 @@
  */
 
 #include "core_memory.h"
+#include "core_cpu_features.h"
 #include "own_dmlc_definitions.h"
 
 DML_CORE_OWN_INLINE(void, opt_fill_with_pattern_8u_big, ( uint64_t        pattern,
@@ -82,8 +83,19 @@ DML_CORE_OWN_INLINE(void, opt_fill_with_pattern_8u_big, ( uint64_t        patter
     __m512i *head_ptr = (__m512i *)aligned_memory_region_ptr;
     __m512i *tail_ptr = (__m512i *)head_ptr + head_size;
 
-    // Fill head part
-    if (0u != head_size)
+    // Fill head part, regions bigger than the cache are streamed to memory
+    if (bytes_to_process > dmlc_own_get_non_temporal_threshold())
+    {
+        while (head_ptr != tail_ptr)
+        {
+            _mm512_stream_si512(head_ptr, zmm_pattern);
+            head_ptr++;
+        }
+
+        // Non-temporal stores are weakly ordered
+        _mm_sfence();
+    }
+    else if (0u != head_size)
     {
         while (head_ptr != tail_ptr)
         {
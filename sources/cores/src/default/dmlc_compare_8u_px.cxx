@@ -15,7 +15,7 @@
  */
 
  /**
-  * @brief Contain default implementation of the follow functions:
+  * @brief Contain AVX2 implementation of the follow functions:
   *      - @ref dmlc_own_compare_8u()
   *      - @ref dmlc_own_compare_with_pattern_8u()
   *
@@ -23,12 +23,71 @@
   *
   */
 
+/**
+ * @brief Returns mask with a bit set for every byte that differs between two 32-byte vectors
+ */
+DML_CORE_OWN_INLINE(uint32_t, mismatch_mask_256, (__m256i first, __m256i second))
+{
+    return ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(first, second));
+}
+
 DML_CORE_OWN_INLINE(dmlc_status_t, compare_8u, (const uint8_t* first_vector_ptr,
     const uint8_t* second_vector_ptr,
     const uint32_t size,
     uint32_t* const mismatch_offset_ptr))
 {
-    for (uint32_t i = 0u; i < size; i++)
+    uint32_t i = 0u;
+
+    // 128 bytes per iteration, the position is looked for only when something differs
+    for (; (i + 128u) <= size; i += 128u)
+    {
+        __m256i equal = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(first_vector_ptr + i)),
+                                          _mm256_loadu_si256((const __m256i *)(second_vector_ptr + i)));
+
+        for (uint32_t j = 32u; j < 128u; j += 32u)
+        {
+            equal = _mm256_and_si256(equal,
+                                     _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(first_vector_ptr + i + j)),
+                                                       _mm256_loadu_si256((const __m256i *)(second_vector_ptr + i + j))));
+        }
+
+        if (0xFFFFFFFFu != (uint32_t) _mm256_movemask_epi8(equal))
+        {
+            break;
+        }
+    }
+
+    for (; (i + 32u) <= size; i += 32u)
+    {
+        const uint32_t mask = dmlc_own_mismatch_mask_256(_mm256_loadu_si256((const __m256i *)(first_vector_ptr + i)),
+                                                         _mm256_loadu_si256((const __m256i *)(second_vector_ptr + i)));
+
+        if (0u != mask)
+        {
+            *mismatch_offset_ptr = i + _tzcnt_u32(mask);
+
+            return DML_COMPARE_STATUS_NE;
+        }
+    }
+
+    // Tail: the last 32 bytes are compared again, bytes before the tail are known to be equal
+    if ((i < size) && (size >= 32u))
+    {
+        const uint32_t last = size - 32u;
+        const uint32_t mask = dmlc_own_mismatch_mask_256(_mm256_loadu_si256((const __m256i *)(first_vector_ptr + last)),
+                                                         _mm256_loadu_si256((const __m256i *)(second_vector_ptr + last)));
+
+        if (0u != mask)
+        {
+            *mismatch_offset_ptr = last + _tzcnt_u32(mask);
+
+            return DML_COMPARE_STATUS_NE;
+        }
+
+        return DML_COMPARE_STATUS_EQ;
+    }
+
+    for (; i < size; i++)
     {
         if (first_vector_ptr[i] != second_vector_ptr[i])
         {
@@ -52,8 +111,44 @@ DML_CORE_OWN_INLINE(dmlc_status_t, compare_with_pattern_8u, (const uint8_t* memo
     const uint64_t tail_bytes_count = size % pattern_size;
     const uint64_t* const pattern_region_ptr = (uint64_t*)memory_region_ptr;
 
-    // Compare by pattern chunks
-    for (uint32_t i = 0u; i < pattern_chunk_count; i++)
+    const __m256i pattern_256 = _mm256_set1_epi64x((long long) pattern);
+    const uint32_t chunks_size = pattern_chunk_count * pattern_size;
+
+    uint32_t offset = 0u;
+
+    // Compare by 32 bytes, mismatch is reported at the start of the pattern chunk, as in other kernels
+    for (; (offset + 128u) <= chunks_size; offset += 128u)
+    {
+        __m256i equal = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(memory_region_ptr + offset)), pattern_256);
+
+        for (uint32_t j = 32u; j < 128u; j += 32u)
+        {
+            equal = _mm256_and_si256(equal,
+                                     _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(memory_region_ptr + offset + j)),
+                                                       pattern_256));
+        }
+
+        if (0xFFFFFFFFu != (uint32_t) _mm256_movemask_epi8(equal))
+        {
+            break;
+        }
+    }
+
+    for (; (offset + 32u) <= chunks_size; offset += 32u)
+    {
+        const uint32_t mask = dmlc_own_mismatch_mask_256(_mm256_loadu_si256((const __m256i *)(memory_region_ptr + offset)),
+                                                         pattern_256);
+
+        if (0u != mask)
+        {
+            *mismatch_offset_ptr = (offset + _tzcnt_u32(mask)) & ~(pattern_size - 1u);
+
+            return DML_COMPARE_STATUS_NE;
+        }
+    }
+
+    // Compare remaining pattern chunks
+    for (uint32_t i = offset / pattern_size; i < pattern_chunk_count; i++)
     {
         if (pattern_region_ptr[i] != pattern)
         {
@@ -16,7 +16,9 @@
 
  /**
   * @brief Contain implementation of the follow functions:
+  *      - @ref dmlc_calculate_crc_16u()
   *      - @ref dmlc_calculate_crc_32u()
+  *      - @ref dmlc_calculate_crc_reflected_32u()
   *
   * @date 7/20/2021
   *
@@ -27,17 +29,61 @@ DML_CORE_OWN_INLINE(dmlc_status_t, calculate_crc_32u, (const uint8_t* const memo
     uint32_t* const crc_ptr,
     uint32_t polynomial))
 {
-     // Current crc value
-    uint32_t current_crc = (*crc_ptr);
+    const uint8_t *src_ptr     = memory_region_ptr;
+    uint32_t       current_crc = (*crc_ptr);
 
-    // Through all bytes
-    for (uint32_t i = 0u; i < bytes_to_hash; ++i)
+    if ((bytes_to_hash >= OWN_CRC_FOLD_MIN_LENGTH) && dmlc_own_is_crc_fold_available())
     {
-        // Calculate crc for current byte
-        current_crc = dmlc_own_crc_byte_32u(current_crc, memory_region_ptr[i], polynomial);
+        const uint32_t blocks_count = bytes_to_hash / 16u;
+
+        current_crc = dmlc_own_crc_32u_fold(src_ptr, NULL, blocks_count, current_crc, dmlc_own_get_crc_fold(polynomial));
+
+        src_ptr       += blocks_count * 16u;
+        bytes_to_hash -= blocks_count * 16u;
     }
 
     // Store result
-    (*crc_ptr) = current_crc;
+    (*crc_ptr) = dmlc_own_crc_32u_slice_16(src_ptr, bytes_to_hash, current_crc, polynomial);
+
+    return DML_STATUS_OK;
+}
+
+DML_CORE_OWN_INLINE(dmlc_status_t, calculate_crc_16u, (const uint8_t* const memory_region_ptr,
+    uint32_t bytes_to_hash,
+    uint16_t* const crc_ptr,
+    uint16_t polynomial))
+{
+    (*crc_ptr) = dmlc_own_crc_16u_slice_8(memory_region_ptr, bytes_to_hash, (*crc_ptr), polynomial);
+
+    return DML_STATUS_OK;
+}
+
+DML_CORE_OWN_INLINE(dmlc_status_t, calculate_crc_reflected_32u, (const uint8_t* const memory_region_ptr,
+    uint32_t bytes_to_hash,
+    uint32_t* const crc_ptr,
+    uint32_t polynomial))
+{
+    // CRC over bit-reversed bytes equals to bit-reversed LSB-first CRC with bit-reversed state and polynomial
+    const uint8_t *src_ptr       = memory_region_ptr;
+    uint32_t       reflected_crc = dmlc_own_reverse_32u(*crc_ptr);
+
+    if ((bytes_to_hash >= OWN_CRC_FOLD_MIN_LENGTH) && dmlc_own_is_crc_fold_available())
+    {
+        const uint32_t blocks_count = bytes_to_hash / 16u;
+
+        reflected_crc = dmlc_own_crc_reflected_32u_fold(src_ptr,
+                                                        NULL,
+                                                        blocks_count,
+                                                        reflected_crc,
+                                                        dmlc_own_get_crc_reflected_fold(polynomial));
+
+        src_ptr       += blocks_count * 16u;
+        bytes_to_hash -= blocks_count * 16u;
+    }
+
+    reflected_crc = dmlc_own_crc_reflected_32u_slice_16(src_ptr, bytes_to_hash, reflected_crc, dmlc_own_reverse_32u(polynomial));
+
+    (*crc_ptr) = dmlc_own_reverse_32u(reflected_crc);
+
     return DML_STATUS_OK;
 }
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2020-2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+ /**
+  * @brief Contain AVX2 implementation of the follow functions:
+  *      - @ref dmlc_own_create_delta_record_8u()
+  *
+  */
+
+/**
+ * @brief Writes delta notes for regions marked in the mismatch mask
+ *
+ * @param[in]     reference_ptr     pointer to the first region covered by the mask
+ * @param[in]     first_offset      offset of the first region covered by the mask
+ * @param[in]     mismatch_mask     bit per region, set if the region differs
+ * @param[out]    delta_record_ptr  pointer to the delta record
+ * @param[in]     note_size         size of a note, selects the record format
+ * @param[in]     delta_note_count  delta record capacity in notes
+ * @param[in,out] notes_count_ptr   number of notes written into the delta record
+ *
+ * @return
+ *      - @ref DML_STATUS_OK;
+ *      - @ref DML_STATUS_DELTA_RECORD_SIZE_ERROR.
+ */
+DML_CORE_OWN_INLINE(dmlc_status_t, write_delta_notes, (const region_t *reference_ptr,
+                                                       uint64_t first_offset,
+                                                       uint32_t mismatch_mask,
+                                                       uint8_t *delta_record_ptr,
+                                                       uint32_t note_size,
+                                                       uint32_t delta_note_count,
+                                                       uint32_t *notes_count_ptr))
+{
+    uint32_t notes_count = (*notes_count_ptr);
+
+    while (0u != mismatch_mask)
+    {
+        const uint32_t region_idx = _tzcnt_u32(mismatch_mask);
+
+        if (notes_count == delta_note_count)
+        {
+            (*notes_count_ptr) = notes_count;
+
+            return DML_STATUS_DELTA_RECORD_SIZE_ERROR;
+        }
+
+        dmlc_own_store_delta_note(delta_record_ptr,
+                                  note_size,
+                                  notes_count,
+                                  first_offset + region_idx,
+                                  reference_ptr[region_idx]);
+        notes_count++;
+
+        mismatch_mask = _blsr_u32(mismatch_mask);
+    }
+
+    (*notes_count_ptr) = notes_count;
+
+    return DML_STATUS_OK;
+}
+
+DML_CORE_OWN_INLINE(dmlc_status_t, create_delta_record_8u, (const region_t *reference_ptr,
+                                                            const region_t *second_ptr,
+                                                            uint32_t regions_count,
+                                                            uint64_t first_offset,
+                                                            uint8_t *delta_record_ptr,
+                                                            uint32_t note_size,
+                                                            uint32_t delta_note_count,
+                                                            uint32_t *notes_count_ptr))
+{
+    dmlc_status_t status = DML_STATUS_OK;
+    uint32_t      i      = 0u;
+
+    (*notes_count_ptr) = 0u;
+
+    // 16 regions per iteration, equal chunks are skipped with a single check
+    for (; (i + 16u) <= regions_count; i += 16u)
+    {
+        __m256i equal[4];
+
+        for (uint32_t j = 0u; j < 4u; j++)
+        {
+            equal[j] = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *) (reference_ptr + i + j * 4u)),
+                                          _mm256_loadu_si256((const __m256i *) (second_ptr + i + j * 4u)));
+        }
+
+        const __m256i all_equal = _mm256_and_si256(_mm256_and_si256(equal[0], equal[1]),
+                                                   _mm256_and_si256(equal[2], equal[3]));
+
+        if (-1 == _mm256_movemask_epi8(all_equal))
+        {
+            continue;
+        }
+
+        for (uint32_t j = 0u; j < 4u; j++)
+        {
+            const uint32_t mismatch_mask = ~(uint32_t) _mm256_movemask_pd(_mm256_castsi256_pd(equal[j])) & 0xFu;
+
+            status = dmlc_own_write_delta_notes(reference_ptr + i + j * 4u,
+                                                first_offset + i + j * 4u,
+                                                mismatch_mask,
+                                                delta_record_ptr,
+                                                note_size,
+                                                delta_note_count,
+                                                notes_count_ptr);
+
+            if (DML_STATUS_OK != status)
+            {
+                return status;
+            }
+        }
+    }
+
+    // Tail
+    uint32_t mismatch_mask = 0u;
+    const uint32_t tail_offset = i;
+
+    for (; i < regions_count; i++)
+    {
+        mismatch_mask |= (uint32_t) (reference_ptr[i] != second_ptr[i]) << (i - tail_offset);
+    }
+
+    return dmlc_own_write_delta_notes(reference_ptr + tail_offset,
+                                      first_offset + tail_offset,
+                                      mismatch_mask,
+                                      delta_record_ptr,
+                                      note_size,
+                                      delta_note_count,
+                                      notes_count_ptr);
+}
@@ -15,7 +15,7 @@
  */
 
 /**
- * @brief Contain default implementation of the follow functions:
+ * @brief Contain AVX2 implementation of the follow functions:
  *      - @ref dmlc_fill_with_pattern_8u()
  *
  * @date 10/29/2020
@@ -31,8 +31,32 @@ DML_CORE_OWN_INLINE(dmlc_status_t, opt_fill_with_pattern_8u, ( uint64_t        p
 {
     DML_CORE_CHECK_NULL_POINTER(memory_region_ptr)
 
+    const __m256i pattern_256 = _mm256_set1_epi64x((long long) pattern);
+
+    // Pattern repeats every 8 bytes from the region start, so each 32-byte block gets the same vector
+    uint8_t *current_ptr = memory_region_ptr;
+
+    while (128u <= bytes_to_process)
+    {
+        _mm256_storeu_si256((__m256i *) current_ptr, pattern_256);
+        _mm256_storeu_si256((__m256i *) (current_ptr + 32u), pattern_256);
+        _mm256_storeu_si256((__m256i *) (current_ptr + 64u), pattern_256);
+        _mm256_storeu_si256((__m256i *) (current_ptr + 96u), pattern_256);
+
+        current_ptr += 128u;
+        bytes_to_process -= 128u;
+    }
+
+    while (32u <= bytes_to_process)
+    {
+        _mm256_storeu_si256((__m256i *) current_ptr, pattern_256);
+
+        current_ptr += 32u;
+        bytes_to_process -= 32u;
+    }
+
     // Current position in memory region 64u
-    uint64_t *memory_region_current_64u_ptr = (uint64_t *)memory_region_ptr;
+    uint64_t *memory_region_current_64u_ptr = (uint64_t *)current_ptr;
 
     // Current pattern 64u to fill with
     const uint64_t *pattern_current_64u_ptr = (const uint64_t *)(&pattern);
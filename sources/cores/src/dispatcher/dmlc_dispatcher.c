@@ -0,0 +1,267 @@
+/*
+ * Copyright 2020-2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @brief Contain implementation of the kernels dispatcher:
+ *      - @ref dmlc_get_active_arch()
+ *      - @ref dmlc_get_arch_name()
+ *      - public core functions forwarding to the selected kernel set
+ *
+ * @date 10/18/2026
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "core_api.h"
+
+/**
+ * @brief Environment variable that forces a kernel set
+ */
+#define OWN_ARCH_ENVIRONMENT_VARIABLE "DML_CORE_ARCH"
+
+/**
+ * @brief List of dispatched functions: return type, name, arguments declaration, arguments forwarding
+ *
+ * @note A kernel added to the public headers must be added here too, otherwise it is not linked.
+ */
+#define OWN_DISPATCHED_FUNCTIONS(DISPATCH)                                                                      \
+    DISPATCH(dmlc_status_t, copy_8u,                                                                            \
+             (const uint8_t *const source_ptr, uint8_t *const destination_ptr, uint32_t bytes_to_process),      \
+             (source_ptr, destination_ptr, bytes_to_process))                                                   \
+    DISPATCH(dmlc_status_t, move_8u,                                                                            \
+             (const uint8_t *const source_ptr, uint8_t *const destination_ptr, uint32_t bytes_to_process),      \
+             (source_ptr, destination_ptr, bytes_to_process))                                                   \
+    DISPATCH(dmlc_status_t, dualcast_copy_8u,                                                                   \
+             (const uint8_t *const source_ptr,                                                                  \
+              uint8_t *const first_destination_ptr,                                                             \
+              uint8_t *const second_destination_ptr,                                                            \
+              uint32_t bytes_to_process),                                                                       \
+             (source_ptr, first_destination_ptr, second_destination_ptr, bytes_to_process))                     \
+    DISPATCH(dmlc_status_t, fill_with_pattern_8u,                                                               \
+             (uint64_t pattern, uint8_t *const memory_region_ptr, uint32_t bytes_to_process),                   \
+             (pattern, memory_region_ptr, bytes_to_process))                                                    \
+    DISPATCH(dmlc_status_t, compare_8u,                                                                         \
+             (const uint8_t *first_vector_ptr,                                                                  \
+              const uint8_t *second_vector_ptr,                                                                 \
+              const uint32_t size,                                                                              \
+              uint32_t *const mismatch_offset_ptr),                                                             \
+             (first_vector_ptr, second_vector_ptr, size, mismatch_offset_ptr))                                  \
+    DISPATCH(dmlc_status_t, compare_with_pattern_8u,                                                            \
+             (const uint8_t *memory_region_ptr,                                                                 \
+              const pattern_t pattern,                                                                          \
+              const uint32_t size,                                                                              \
+              uint32_t *const mismatch_offset_ptr),                                                             \
+             (memory_region_ptr, pattern, size, mismatch_offset_ptr))                                           \
+    DISPATCH(dmlc_status_t, create_delta_record_8u,                                                             \
+             (const uint8_t *reference_vector_ptr,                                                              \
+              const uint8_t *second_vector_ptr,                                                                 \
+              const uint32_t compared_bytes,                                                                    \
+              const uint32_t delta_record_max_size,                                                             \
+              uint8_t *delta_record_ptr,                                                                        \
+              uint32_t *const record_size_ptr),                                                                 \
+             (reference_vector_ptr,                                                                             \
+              second_vector_ptr,                                                                                \
+              compared_bytes,                                                                                   \
+              delta_record_max_size,                                                                            \
+              delta_record_ptr,                                                                                 \
+              record_size_ptr))                                                                                 \
+    DISPATCH(dmlc_status_t, apply_delta_record_8u,                                                              \
+             (uint8_t *memory_region_ptr,                                                                       \
+              const uint8_t *delta_record_ptr,                                                                  \
+              const uint32_t memory_region_size,                                                                \
+              const uint32_t delta_record_size),                                                                \
+             (memory_region_ptr, delta_record_ptr, memory_region_size, delta_record_size))                      \
+    DISPATCH(dmlc_status_t, create_wide_delta_record_8u,                                                        \
+             (const uint8_t *reference_vector_ptr,                                                              \
+              const uint8_t *second_vector_ptr,                                                                 \
+              const uint32_t compared_bytes,                                                                    \
+              const uint64_t first_offset,                                                                      \
+              const uint32_t delta_record_max_size,                                                             \
+              uint8_t *delta_record_ptr,                                                                        \
+              uint32_t *const record_size_ptr),                                                                 \
+             (reference_vector_ptr,                                                                             \
+              second_vector_ptr,                                                                                \
+              compared_bytes,                                                                                   \
+              first_offset,                                                                                     \
+              delta_record_max_size,                                                                            \
+              delta_record_ptr,                                                                                 \
+              record_size_ptr))                                                                                 \
+    DISPATCH(dmlc_status_t, apply_wide_delta_record_8u,                                                         \
+             (uint8_t *memory_region_ptr,                                                                       \
+              const uint8_t *delta_record_ptr,                                                                  \
+              const uint64_t memory_region_size,                                                                \
+              const uint32_t delta_record_size),                                                                \
+             (memory_region_ptr, delta_record_ptr, memory_region_size, delta_record_size))                      \
+    DISPATCH(dmlc_status_t, calculate_crc_16u,                                                                  \
+             (const uint8_t *const memory_region_ptr,                                                           \
+              uint32_t bytes_to_hash,                                                                           \
+              uint16_t *const crc_ptr,                                                                          \
+              uint16_t polynomial),                                                                             \
+             (memory_region_ptr, bytes_to_hash, crc_ptr, polynomial))                                           \
+    DISPATCH(dmlc_status_t, calculate_crc_16u_blocks,                                                           \
+             (const uint8_t *const memory_region_ptr,                                                           \
+              uint32_t block_size,                                                                              \
+              uint32_t block_stride,                                                                            \
+              uint32_t block_count,                                                                             \
+              uint16_t *const crc_ptr,                                                                          \
+              uint16_t polynomial),                                                                             \
+             (memory_region_ptr, block_size, block_stride, block_count, crc_ptr, polynomial))                   \
+    DISPATCH(dmlc_status_t, calculate_crc_32u,                                                                  \
+             (const uint8_t *const memory_region_ptr,                                                           \
+              uint32_t bytes_to_hash,                                                                           \
+              uint32_t *const crc_ptr,                                                                          \
+              uint32_t polynomial),                                                                             \
+             (memory_region_ptr, bytes_to_hash, crc_ptr, polynomial))                                           \
+    DISPATCH(dmlc_status_t, calculate_crc_reflected_32u,                                                        \
+             (const uint8_t *const memory_region_ptr,                                                           \
+              uint32_t bytes_to_hash,                                                                           \
+              uint32_t *const crc_ptr,                                                                          \
+              uint32_t polynomial),                                                                             \
+             (memory_region_ptr, bytes_to_hash, crc_ptr, polynomial))                                           \
+    DISPATCH(dmlc_status_t, copy_with_crc_32u,                                                                  \
+             (const uint8_t *const source_ptr,                                                                  \
+              uint8_t *const destination_ptr,                                                                   \
+              uint32_t bytes_to_process,                                                                        \
+              uint32_t *const crc_ptr,                                                                          \
+              uint32_t polynomial),                                                                             \
+             (source_ptr, destination_ptr, bytes_to_process, crc_ptr, polynomial))                              \
+    DISPATCH(dmlc_status_t, copy_with_crc_reflected_32u,                                                        \
+             (const uint8_t *const source_ptr,                                                                  \
+              uint8_t *const destination_ptr,                                                                   \
+              uint32_t bytes_to_process,                                                                        \
+              uint32_t *const crc_ptr,                                                                          \
+              uint32_t polynomial),                                                                             \
+             (source_ptr, destination_ptr, bytes_to_process, crc_ptr, polynomial))                              \
+    DISPATCH(dmlc_status_t, crc32_combine,                                                                      \
+             (uint32_t *const crc_ptr, uint32_t second_crc, uint64_t second_size, uint32_t polynomial),         \
+             (crc_ptr, second_crc, second_size, polynomial))                                                    \
+    DISPATCH(dmlc_status_t, crc16_combine,                                                                      \
+             (uint16_t *const crc_ptr, uint16_t second_crc, uint64_t second_size, uint16_t polynomial),         \
+             (crc_ptr, second_crc, second_size, polynomial))                                                    \
+    DISPATCH(dmlc_status_t, move_cache_to_memory_8u,                                                            \
+             (const uint8_t *memory_region_ptr, const uint32_t bytes_to_flush),                                 \
+             (memory_region_ptr, bytes_to_flush))                                                               \
+    DISPATCH(dmlc_status_t, copy_cache_to_memory_8u,                                                            \
+             (const uint8_t *memory_region_ptr, const uint32_t bytes_to_flush),                                 \
+             (memory_region_ptr, bytes_to_flush))
+
+/* ------ Kernel sets ------ */
+
+#define OWN_DECLARE_KERNELS(type, name, arguments, forward) \
+    type DML_CORE_STDCALL dmlc_px_##name arguments;         \
+    type DML_CORE_STDCALL dmlc_k0_##name arguments;
+
+OWN_DISPATCHED_FUNCTIONS(OWN_DECLARE_KERNELS)
+
+/**
+ * @brief Table of kernels the public functions forward to
+ */
+typedef struct
+{
+#define OWN_TABLE_ENTRY(type, name, arguments, forward) type (DML_CORE_STDCALL *name) arguments;
+    OWN_DISPATCHED_FUNCTIONS(OWN_TABLE_ENTRY)
+#undef OWN_TABLE_ENTRY
+} own_kernels_table_t;
+
+#define OWN_PX_ENTRY(type, name, arguments, forward) dmlc_px_##name,
+#define OWN_K0_ENTRY(type, name, arguments, forward) dmlc_k0_##name,
+
+static const own_kernels_table_t own_px_kernels = { OWN_DISPATCHED_FUNCTIONS(OWN_PX_ENTRY) };
+static const own_kernels_table_t own_k0_kernels = { OWN_DISPATCHED_FUNCTIONS(OWN_K0_ENTRY) };
+
+/* ------ Selection ------ */
+
+/**
+ * @brief Selected kernel set, NULL until the first initialization
+ */
+static const own_kernels_table_t *own_active_kernels = NULL;
+static dmlc_arch_t                own_active_arch    = DMLC_ARCH_PX;
+
+/**
+ * @brief Chooses the best supported kernel set, unless environment asks for another one
+ *
+ * @note Races are harmless here: every caller computes the same values.
+ */
+static void own_init_kernels(void)
+{
+    dmlc_arch_t arch = dmlc_own_is_avx512_supported() ? DMLC_ARCH_AVX512 : DMLC_ARCH_PX;
+
+    const char *forced_arch = getenv(OWN_ARCH_ENVIRONMENT_VARIABLE);
+
+    if (NULL != forced_arch)
+    {
+        if (0 == strcmp(forced_arch, dmlc_get_arch_name(DMLC_ARCH_PX)))
+        {
+            arch = DMLC_ARCH_PX;
+        }
+        // AVX-512 can't be forced on a CPU without it: SIGILL is not a benchmark result
+    }
+
+    own_active_arch    = arch;
+    own_active_kernels = (DMLC_ARCH_AVX512 == arch) ? &own_k0_kernels : &own_px_kernels;
+}
+
+#if defined(__GNUC__)
+/**
+ * @brief Fills the table at library load, so calls never pay for the check below
+ */
+__attribute__((constructor)) static void own_init_kernels_on_load(void)
+{
+    own_init_kernels();
+}
+#endif
+
+static inline const own_kernels_table_t *own_get_kernels(void)
+{
+    if (NULL == own_active_kernels)
+    {
+        own_init_kernels();
+    }
+
+    return own_active_kernels;
+}
+
+/* ------ Public functions ------ */
+
+#define OWN_DEFINE_DISPATCHER(type, name, arguments, forward) \
+    DML_CORE_API(type, name, arguments)                       \
+    {                                                         \
+        return own_get_kernels()->name forward;               \
+    }
+
+OWN_DISPATCHED_FUNCTIONS(OWN_DEFINE_DISPATCHER)
+
+DML_CORE_API(dmlc_arch_t, get_active_arch, (void))
+{
+    own_get_kernels();
+
+    return own_active_arch;
+}
+
+DML_CORE_API(const char *, get_arch_name, (dmlc_arch_t arch))
+{
+    switch (arch)
+    {
+        case DMLC_ARCH_PX:
+            return "px";
+        case DMLC_ARCH_AVX512:
+            return "avx512";
+        default:
+            return "unknown";
+    }
+}
@@ -17,8 +17,13 @@
 /**
  * @brief Contain implementation of the follow functions:
  *      - @ref dmlc_calculate_crc_16u()
+ *      - @ref dmlc_calculate_crc_16u_blocks()
  *      - @ref dmlc_calculate_crc_32u()
  *      - @ref dmlc_calculate_crc_reflected_32u()
+ *      - @ref dmlc_copy_with_crc_32u()
+ *      - @ref dmlc_copy_with_crc_reflected_32u()
+ *      - @ref dmlc_crc32_combine()
+ *      - @ref dmlc_crc16_combine()
  *
  * @date 2/5/2020
  *
@@ -26,9 +31,12 @@
 
 
 #include "core_hash_functions.h"
+#include "core_cpu_features.h"
 #include "own_dmlc_definitions.h"
 #include "own_dmlc_crc_16u_32u.cxx"
+#include "own_dmlc_crc_fold.cxx"
 #include "own_dmlc_byte_op.cxx"
+#include "own_dmlc_crc_combine.cxx"
 
 #if defined(AVX512)
 #include "avx512/dmlc_crc_16u_32u_k0.cxx"
@@ -47,18 +55,22 @@ DML_CORE_API(dmlc_status_t, calculate_crc_16u, (const uint8_t  *const memory_reg
     DML_CORE_CHECK_NULL_POINTER(memory_region_ptr)
     DML_CORE_CHECK_NULL_POINTER(crc_ptr)
 
-    // Current crc value
-    uint16_t current_crc = (*crc_ptr);
+    return dmlc_own_calculate_crc_16u(memory_region_ptr, bytes_to_hash, crc_ptr, polynomial);
+}
+
 
-    // Through all bytes
-    for(uint32_t i = 0u; i < bytes_to_hash; ++i)
-    {
-        // Calculate crc for current byte
-        current_crc  = dmlc_own_crc_byte_16u(current_crc, memory_region_ptr[i], polynomial);
-    }
+DML_CORE_API(dmlc_status_t, calculate_crc_16u_blocks, (const uint8_t  *const memory_region_ptr,
+                                                             uint32_t block_size,
+                                                             uint32_t block_stride,
+                                                             uint32_t block_count,
+                                                             uint16_t *const crc_ptr,
+                                                             uint16_t polynomial))
+{
+    // Check input arguments
+    DML_CORE_CHECK_NULL_POINTER(memory_region_ptr)
+    DML_CORE_CHECK_NULL_POINTER(crc_ptr)
 
-    // Store result
-    (*crc_ptr) = current_crc;
+    dmlc_own_calculate_crc_16u_blocks(memory_region_ptr, block_size, block_stride, block_count, crc_ptr, polynomial);
 
     return DML_STATUS_OK;
 }
@@ -92,27 +104,89 @@ DML_CORE_API(dmlc_status_t, calculate_crc_reflected_32u, (const uint8_t  *const
     DML_CORE_CHECK_NULL_POINTER(memory_region_ptr)
     DML_CORE_CHECK_NULL_POINTER(crc_ptr)
 
-    // Current crc value
-    uint32_t current_crc = (*crc_ptr);
+    return dmlc_own_calculate_crc_reflected_32u(memory_region_ptr, bytes_to_hash, crc_ptr, polynomial);
+}
+
+
+DML_CORE_API(dmlc_status_t, copy_with_crc_32u, (const uint8_t *const source_ptr,
+                                                uint8_t *const destination_ptr,
+                                                uint32_t bytes_to_process,
+                                                uint32_t *const crc_ptr,
+                                                uint32_t polynomial))
+{
+    // Check input arguments
+    DML_CORE_CHECK_NULL_POINTER(source_ptr)
+    DML_CORE_CHECK_NULL_POINTER(destination_ptr)
+    DML_CORE_CHECK_NULL_POINTER(crc_ptr)
+
+    (*crc_ptr) = dmlc_own_copy_with_crc_32u(source_ptr, destination_ptr, bytes_to_process, (*crc_ptr), polynomial, OWN_BOOL_FALSE);
+
+    return DML_STATUS_OK;
+}
+
+
+DML_CORE_API(dmlc_status_t, copy_with_crc_reflected_32u, (const uint8_t *const source_ptr,
+                                                          uint8_t *const destination_ptr,
+                                                          uint32_t bytes_to_process,
+                                                          uint32_t *const crc_ptr,
+                                                          uint32_t polynomial))
+{
+    // Check input arguments
+    DML_CORE_CHECK_NULL_POINTER(source_ptr)
+    DML_CORE_CHECK_NULL_POINTER(destination_ptr)
+    DML_CORE_CHECK_NULL_POINTER(crc_ptr)
+
+    // CRC over bit-reversed bytes equals to bit-reversed LSB-first CRC with bit-reversed state and polynomial
+    const uint32_t reflected_crc = dmlc_own_copy_with_crc_32u(source_ptr,
+                                                              destination_ptr,
+                                                              bytes_to_process,
+                                                              dmlc_own_reverse_32u(*crc_ptr),
+                                                              polynomial,
+                                                              OWN_BOOL_TRUE);
+
+    (*crc_ptr) = dmlc_own_reverse_32u(reflected_crc);
+
+    return DML_STATUS_OK;
+}
+
+
+DML_CORE_API(dmlc_status_t, crc32_combine, (uint32_t *const crc_ptr,
+                                            uint32_t second_crc,
+                                            uint64_t second_size,
+                                            uint32_t polynomial))
+{
+    // Check input arguments
+    DML_CORE_CHECK_NULL_POINTER(crc_ptr)
+
+    static OWN_THREAD_LOCAL own_crc_combine_table_t cache;
+
+    own_crc_combine_table_t *table_ptr = dmlc_own_get_crc_combine_table(&cache, polynomial, 32u);
+
+    (*crc_ptr) = dmlc_own_crc_multiply_modulo(*crc_ptr,
+                                              dmlc_own_get_crc_shift_operator(table_ptr, second_size),
+                                              polynomial,
+                                              32u) ^ second_crc;
+
+    return DML_STATUS_OK;
+}
 
-    // Temporary storage for reversed value
-    uint8_t  reversed_value;
 
-    // Through all bytes
-    for(uint32_t i = 0u; i < bytes_to_hash; ++i)
-    {
-        // Get current byte
-        reversed_value = memory_region_ptr[i];
+DML_CORE_API(dmlc_status_t, crc16_combine, (uint16_t *const crc_ptr,
+                                            uint16_t second_crc,
+                                            uint64_t second_size,
+                                            uint16_t polynomial))
+{
+    // Check input arguments
+    DML_CORE_CHECK_NULL_POINTER(crc_ptr)
 
-        // Reverse bits
-        reversed_value = dmlc_own_reverse_8u(reversed_value);
+    static OWN_THREAD_LOCAL own_crc_combine_table_t cache;
 
-        // Calculate crc for current reversed byte
-        current_crc = dmlc_own_crc_byte_32u(current_crc, reversed_value, polynomial);
-    }
+    own_crc_combine_table_t *table_ptr = dmlc_own_get_crc_combine_table(&cache, polynomial, 16u);
 
-    // Store result
-    (*crc_ptr) = current_crc;
+    (*crc_ptr) = (uint16_t) (dmlc_own_crc_multiply_modulo(*crc_ptr,
+                                                          dmlc_own_get_crc_shift_operator(table_ptr, second_size),
+                                                          polynomial,
+                                                          16u) ^ second_crc);
 
     return DML_STATUS_OK;
 }
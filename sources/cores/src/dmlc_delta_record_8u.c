@@ -17,6 +17,9 @@
 /**
  * @details Contain implementation for Delta Record feature:
  *       - @ref dmlc_create_delta_record_8u
+ *       - @ref dmlc_apply_delta_record_8u
+ *       - @ref dmlc_create_wide_delta_record_8u
+ *       - @ref dmlc_apply_wide_delta_record_8u
  *
  * @date 2/17/2020
  *
@@ -65,8 +68,51 @@ typedef uint16_t  offset_t;            /**< Redefinition to make more abstract o
     region_t reference_data;  /**< Contain delta between standard vector and compared*/
 } own_delta_note_t;           /**< Presents a single element of Delta Record stream */
 
+#if defined(_MSC_VER)
+    #pragma pack()
+#endif
+
+typedef struct
+{
+    uint64_t offset;          /**< Offset of mismatched region, not limited by the compared size */
+    region_t reference_data;  /**< Contain delta between standard vector and compared*/
+} own_wide_delta_note_t;      /**< Presents a single element of Wide Delta Record stream */
+
+/**
+ * @brief Writes a note of the format specified by the note size
+ *
+ * @note The note size is a constant at every call site, so the check is resolved at compile time.
+ */
+DML_CORE_OWN_INLINE(void, store_delta_note, (uint8_t *delta_record_ptr,
+                                             uint32_t note_size,
+                                             uint32_t note_index,
+                                             uint64_t offset,
+                                             region_t reference_data))
+{
+    if (DML_WIDE_DELTA_NOTE_SIZE == note_size)
+    {
+        own_wide_delta_note_t *const note_ptr = (own_wide_delta_note_t *) delta_record_ptr + note_index;
+
+        note_ptr->offset         = offset;
+        note_ptr->reference_data = reference_data;
+    }
+    else
+    {
+        own_delta_note_t *const note_ptr = (own_delta_note_t *) delta_record_ptr + note_index;
+
+        note_ptr->offset         = (offset_t) offset;
+        note_ptr->reference_data = reference_data;
+    }
+}
+
 /** @} */
 
+#if defined(AVX512)
+#include "avx512/dmlc_delta_record_8u_k0.cxx"
+#else
+#include "default/dmlc_delta_record_8u_px.cxx"
+#endif
+
 /* ------ DELTA RECORD PUBLIC FUNCTIONS IMPLEMENTATION ------ */
 
 DML_CORE_API(dmlc_status_t, create_delta_record_8u, (const uint8_t *reference_vector_ptr,
@@ -91,38 +137,23 @@ DML_CORE_API(dmlc_status_t, create_delta_record_8u, (const uint8_t *reference_ve
     DML_CORE_CHECK_OUTPUT_SIZE(0u == delta_record_max_size, DML_STATUS_DELTA_INPUT_SIZE_ERROR)
 
     // Delta Record
-    const uint32_t delta_note_count           = delta_record_max_size / DELTA_NOTE_SIZE;
-    const offset_t regions_count              = (offset_t)(compared_bytes / DELTA_NOTE_REGION_FIELD_SIZE);
-    own_delta_note_t* current_delta_notes_ptr = (own_delta_note_t*) delta_record_ptr;
-    own_delta_note_t* end_delta_notes_ptr     = current_delta_notes_ptr + delta_note_count;
+    const uint32_t delta_note_count = delta_record_max_size / DELTA_NOTE_SIZE;
+    const uint32_t regions_count    = compared_bytes / DELTA_NOTE_REGION_FIELD_SIZE;
+    uint32_t       notes_count      = 0u;
 
     // Create delta
-    for (offset_t i = 0u; i < regions_count; i++)
-    {
-        const uint64_t base_region   = *(uint64_t *) reference_vector_ptr;
-        const uint64_t vector_region = *(uint64_t *) second_vector_ptr;
+    const dmlc_status_t status = dmlc_own_create_delta_record_8u((const region_t *) reference_vector_ptr,
+                                                                 (const region_t *) second_vector_ptr,
+                                                                 regions_count,
+                                                                 0u,
+                                                                 delta_record_ptr,
+                                                                 DELTA_NOTE_SIZE,
+                                                                 delta_note_count,
+                                                                 &notes_count);
 
-        reference_vector_ptr += DELTA_NOTE_REGION_FIELD_SIZE;
-        second_vector_ptr    += DELTA_NOTE_REGION_FIELD_SIZE;
+    (*record_size_ptr) = notes_count * DELTA_NOTE_SIZE;
 
-        // Write delta note into delta record in case:
-        if (base_region != vector_region)
-        {
-            if(current_delta_notes_ptr < end_delta_notes_ptr)
-            {
-                current_delta_notes_ptr->reference_data = base_region;
-                current_delta_notes_ptr->offset         = i;
-                current_delta_notes_ptr++;
-                (*record_size_ptr) += DELTA_NOTE_SIZE;
-            }
-            else
-            {
-                return DML_STATUS_DELTA_RECORD_SIZE_ERROR;
-            }
-        }
-    }
-
-    return DML_STATUS_OK;
+    return status;
 }
 
 
@@ -164,3 +195,78 @@ DML_CORE_API(dmlc_status_t, apply_delta_record_8u, (uint8_t * memory_region_ptr,
 
     return DML_STATUS_OK;
 }
+
+
+DML_CORE_API(dmlc_status_t, create_wide_delta_record_8u, (const uint8_t *reference_vector_ptr,
+                                                         const uint8_t *second_vector_ptr,
+                                                         const uint32_t compared_bytes,
+                                                         const uint64_t first_offset,
+                                                         const uint32_t delta_record_max_size,
+                                                         uint8_t *delta_record_ptr,
+                                                         uint32_t *const record_size_ptr))
+{
+    DML_CORE_CHECK_NULL_POINTER(reference_vector_ptr)
+    DML_CORE_CHECK_NULL_POINTER(second_vector_ptr)
+    DML_CORE_CHECK_NULL_POINTER(delta_record_ptr)
+    DML_CORE_CHECK_NULL_POINTER(record_size_ptr)
+    OWN_DELTA_CHECK_PTR_ALIGNMENT(reference_vector_ptr)
+    OWN_DELTA_CHECK_PTR_ALIGNMENT(second_vector_ptr)
+
+    (*record_size_ptr) = 0u;
+
+    DML_CORE_CHECK_INPUT_SIZE(compared_bytes % DELTA_NOTE_REGION_FIELD_SIZE, DML_STATUS_DELTA_ALIGN_ERROR)
+    DML_CORE_CHECK_OUTPUT_SIZE(delta_record_max_size % DML_WIDE_DELTA_NOTE_SIZE, DML_STATUS_DELTA_INPUT_SIZE_ERROR)
+    DML_CORE_CHECK_OUTPUT_SIZE(0u == delta_record_max_size, DML_STATUS_DELTA_INPUT_SIZE_ERROR)
+
+    const uint32_t delta_note_count = delta_record_max_size / DML_WIDE_DELTA_NOTE_SIZE;
+    const uint32_t regions_count    = compared_bytes / DELTA_NOTE_REGION_FIELD_SIZE;
+    uint32_t       notes_count      = 0u;
+
+    const dmlc_status_t status = dmlc_own_create_delta_record_8u((const region_t *) reference_vector_ptr,
+                                                                 (const region_t *) second_vector_ptr,
+                                                                 regions_count,
+                                                                 first_offset,
+                                                                 delta_record_ptr,
+                                                                 DML_WIDE_DELTA_NOTE_SIZE,
+                                                                 delta_note_count,
+                                                                 &notes_count);
+
+    (*record_size_ptr) = notes_count * DML_WIDE_DELTA_NOTE_SIZE;
+
+    return status;
+}
+
+
+DML_CORE_API(dmlc_status_t, apply_wide_delta_record_8u, (uint8_t *memory_region_ptr,
+                                                        const uint8_t *delta_record_ptr,
+                                                        const uint64_t memory_region_size,
+                                                        const uint32_t delta_record_size))
+{
+    DML_CORE_CHECK_NULL_POINTER(memory_region_ptr)
+    DML_CORE_CHECK_NULL_POINTER(delta_record_ptr)
+    OWN_DELTA_CHECK_PTR_ALIGNMENT(memory_region_ptr)
+    DML_CORE_CHECK_INPUT_SIZE(memory_region_size % DELTA_NOTE_REGION_FIELD_SIZE, DML_STATUS_DELTA_ALIGN_ERROR)
+    DML_CORE_CHECK_INPUT_SIZE(delta_record_size % DML_WIDE_DELTA_NOTE_SIZE, DML_STATUS_DELTA_RECORD_SIZE_ERROR)
+    DML_CORE_CHECK_OVERLAPPING_FORWARD(delta_record_ptr, memory_region_ptr, memory_region_size)
+    DML_CORE_CHECK_OVERLAPPING_FORWARD(memory_region_ptr, delta_record_ptr, delta_record_size)
+
+    const uint32_t delta_notes_count = delta_record_size / DML_WIDE_DELTA_NOTE_SIZE;
+    const uint64_t regions_count     = memory_region_size / DELTA_NOTE_REGION_FIELD_SIZE;
+
+    const own_wide_delta_note_t *delta_note_ptr = (const own_wide_delta_note_t *) delta_record_ptr;
+    region_t *regions_ptr                       = (region_t *) memory_region_ptr;
+
+    for (uint32_t i = 0u; i < delta_notes_count; i++)
+    {
+        const uint64_t region_offset = delta_note_ptr[i].offset;
+
+        if (region_offset >= regions_count)
+        {
+            return DML_STATUS_MEMORY_OVERFLOW_ERROR;
+        }
+
+        regions_ptr[region_offset] = delta_note_ptr[i].reference_data;
+    }
+
+    return DML_STATUS_OK;
+}
@@ -61,6 +61,12 @@ extern "C" {
 #define OWN_HIGH_BIT_MASK_16U ( 0x8000u )     /**< Mask for checking high bit in uint16 value */
 #define OWN_HIGH_BIT_MASK_32U ( 0x80000000u ) /**< Mask for checking high bit in uint16 value */
 
+#if defined(_MSC_VER)
+#define OWN_THREAD_LOCAL __declspec(thread)   /**< Thread storage duration for cached tables */
+#else
+#define OWN_THREAD_LOCAL _Thread_local        /**< Thread storage duration for cached tables */
+#endif
+
 /* ------ Enumerations ------ */
 
 /**
@@ -18,6 +18,14 @@
  * @brief Contain implementation of the follow functions:
  *      - @ref dmlc_own_crc_byte_16u()
  *      - @ref dmlc_own_crc_byte_32u()
+ *      - @ref dmlc_own_get_crc16_slice_table()
+ *      - @ref dmlc_own_crc_16u_slice_8()
+ *      - @ref dmlc_own_reverse_32u()
+ *      - @ref dmlc_own_get_crc32_reflected_slice_table()
+ *      - @ref dmlc_own_crc_reflected_32u_slice_16()
+ *      - @ref dmlc_own_get_crc32_slice_table()
+ *      - @ref dmlc_own_crc_32u_slice_16()
+ *      - @ref dmlc_own_crc_32u_barrett_quotient()
  *
  * @date 2/24/2020
  *
@@ -65,3 +73,323 @@ DML_CORE_OWN_INLINE(uint32_t, crc_byte_32u, ( uint32_t init_crc,
 
     return current_crc;
 }
+
+
+#define OWN_CRC16_SLICE_COUNT 8u   /**< Number of bytes processed by one slicing step */
+
+/**
+ * @brief Lookup tables for slicing-by-8 CRC16 calculation with a given polynomial
+ *
+ * @details table[k][b] is CRC of byte b followed by k zero bytes, with zero initial value.
+ */
+typedef struct
+{
+    uint16_t polynomial;                            /**< Polynomial the tables are generated for */
+    uint8_t  is_ready;                              /**< Tables are generated */
+    uint16_t table[OWN_CRC16_SLICE_COUNT][256u];    /**< Lookup tables */
+} own_crc16_slice_table_t;
+
+
+/**
+ * @brief Returns slicing-by-8 tables for a polynomial, tables are regenerated when the polynomial changes
+ *
+ * @note The cache is per thread, so no synchronization is needed.
+ */
+static inline const own_crc16_slice_table_t *dmlc_own_get_crc16_slice_table(uint16_t polynomial)
+{
+    static OWN_THREAD_LOCAL own_crc16_slice_table_t cache;
+
+    if (cache.is_ready && (cache.polynomial == polynomial))
+    {
+        return &cache;
+    }
+
+    for (uint32_t byte = 0u; byte < 256u; ++byte)
+    {
+        cache.table[0][byte] = dmlc_own_crc_byte_16u(0u, (uint8_t) byte, polynomial);
+    }
+
+    for (uint32_t slice = 1u; slice < OWN_CRC16_SLICE_COUNT; ++slice)
+    {
+        for (uint32_t byte = 0u; byte < 256u; ++byte)
+        {
+            const uint16_t previous = cache.table[slice - 1u][byte];
+
+            cache.table[slice][byte] = (uint16_t) (previous << OWN_CRC16_BYTE_SHIFT) ^ cache.table[0][previous >> OWN_CRC16_BYTE_SHIFT];
+        }
+    }
+
+    cache.polynomial = polynomial;
+    cache.is_ready   = OWN_BOOL_TRUE;
+
+    return &cache;
+}
+
+
+DML_CORE_OWN_INLINE(uint16_t, crc_16u_slice_8, ( const uint8_t *memory_region_ptr,
+                                                uint32_t       bytes_to_hash,
+                                                uint16_t       init_crc,
+                                                uint16_t       polynomial ) )
+{
+    const own_crc16_slice_table_t *tables = dmlc_own_get_crc16_slice_table(polynomial);
+    const uint16_t (*table)[256u]         = tables->table;
+
+    uint16_t current_crc = init_crc;
+
+    // 8 bytes per step, CRC is XOR-ed into the first two of them
+    for (; bytes_to_hash >= OWN_CRC16_SLICE_COUNT; bytes_to_hash -= OWN_CRC16_SLICE_COUNT)
+    {
+        const uint8_t *bytes = memory_region_ptr;
+
+        current_crc = table[7][bytes[0] ^ (current_crc >> OWN_CRC16_BYTE_SHIFT)] ^
+                      table[6][bytes[1] ^ (current_crc & 0xFFu)] ^
+                      table[5][bytes[2]] ^
+                      table[4][bytes[3]] ^
+                      table[3][bytes[4]] ^
+                      table[2][bytes[5]] ^
+                      table[1][bytes[6]] ^
+                      table[0][bytes[7]];
+
+        memory_region_ptr += OWN_CRC16_SLICE_COUNT;
+    }
+
+    // Tail byte by byte
+    for (; bytes_to_hash > 0u; --bytes_to_hash)
+    {
+        current_crc = (uint16_t) (current_crc << OWN_CRC16_BYTE_SHIFT) ^
+                      table[0][(current_crc >> OWN_CRC16_BYTE_SHIFT) ^ *memory_region_ptr];
+
+        ++memory_region_ptr;
+    }
+
+    return current_crc;
+}
+
+
+#define OWN_CRC32_SLICE_COUNT 16u   /**< Number of bytes processed by one slicing step */
+
+DML_CORE_OWN_INLINE(uint32_t, reverse_32u, ( uint32_t value ) )
+{
+    value = ((value & 0x55555555u) << 1u)  | ((value & 0xAAAAAAAAu) >> 1u);
+    value = ((value & 0x33333333u) << 2u)  | ((value & 0xCCCCCCCCu) >> 2u);
+    value = ((value & 0x0F0F0F0Fu) << 4u)  | ((value & 0xF0F0F0F0u) >> 4u);
+    value = ((value & 0x00FF00FFu) << 8u)  | ((value & 0xFF00FF00u) >> 8u);
+    value = ((value & 0x0000FFFFu) << 16u) | ((value & 0xFFFF0000u) >> 16u);
+
+    return value;
+}
+
+
+/**
+ * @brief Lookup tables for slicing-by-16 reflected (LSB-first) CRC32 calculation
+ *
+ * @details table[k][b] is reflected CRC of byte b followed by k zero bytes, with zero initial value.
+ */
+typedef struct
+{
+    uint32_t reflected_polynomial;                  /**< Bit-reversed polynomial the tables are generated for */
+    uint8_t  is_ready;                              /**< Tables are generated */
+    uint32_t table[OWN_CRC32_SLICE_COUNT][256u];    /**< Lookup tables */
+} own_crc32_reflected_slice_table_t;
+
+
+/**
+ * @brief Returns slicing-by-16 tables for a bit-reversed polynomial, tables are regenerated when it changes
+ *
+ * @note The cache is per thread, so no synchronization is needed.
+ */
+static inline const own_crc32_reflected_slice_table_t *dmlc_own_get_crc32_reflected_slice_table(uint32_t reflected_polynomial)
+{
+    static OWN_THREAD_LOCAL own_crc32_reflected_slice_table_t cache;
+
+    if (cache.is_ready && (cache.reflected_polynomial == reflected_polynomial))
+    {
+        return &cache;
+    }
+
+    for (uint32_t byte = 0u; byte < 256u; ++byte)
+    {
+        uint32_t current_crc = byte;
+
+        for (uint8_t bit = 0u; bit < OWN_BYTE_BIT_LENGTH; ++bit)
+        {
+            current_crc = (current_crc & 1u) ? ((current_crc >> 1u) ^ reflected_polynomial) : (current_crc >> 1u);
+        }
+
+        cache.table[0][byte] = current_crc;
+    }
+
+    for (uint32_t slice = 1u; slice < OWN_CRC32_SLICE_COUNT; ++slice)
+    {
+        for (uint32_t byte = 0u; byte < 256u; ++byte)
+        {
+            const uint32_t previous = cache.table[slice - 1u][byte];
+
+            cache.table[slice][byte] = (previous >> 8u) ^ cache.table[0][previous & 0xFFu];
+        }
+    }
+
+    cache.reflected_polynomial = reflected_polynomial;
+    cache.is_ready             = OWN_BOOL_TRUE;
+
+    return &cache;
+}
+
+
+/**
+ * @brief Calculates reflected CRC32: state, polynomial and result are bit-reversed, data is taken as is
+ */
+DML_CORE_OWN_INLINE(uint32_t, crc_reflected_32u_slice_16, ( const uint8_t *memory_region_ptr,
+                                                           uint32_t       bytes_to_hash,
+                                                           uint32_t       init_crc,
+                                                           uint32_t       reflected_polynomial ) )
+{
+    const own_crc32_reflected_slice_table_t *tables = dmlc_own_get_crc32_reflected_slice_table(reflected_polynomial);
+    const uint32_t (*table)[256u]                   = tables->table;
+
+    uint32_t current_crc = init_crc;
+
+    // 16 bytes per step, CRC is XOR-ed into the first four of them
+    for (; bytes_to_hash >= OWN_CRC32_SLICE_COUNT; bytes_to_hash -= OWN_CRC32_SLICE_COUNT)
+    {
+        const uint8_t *b = memory_region_ptr;
+
+        const uint32_t word = current_crc ^ ((uint32_t) b[0] | ((uint32_t) b[1] << 8u) |
+                                             ((uint32_t) b[2] << 16u) | ((uint32_t) b[3] << 24u));
+
+        current_crc = table[15][word & 0xFFu] ^
+                      table[14][(word >> 8u) & 0xFFu] ^
+                      table[13][(word >> 16u) & 0xFFu] ^
+                      table[12][word >> 24u] ^
+                      table[11][b[4]] ^ table[10][b[5]] ^ table[9][b[6]]  ^ table[8][b[7]] ^
+                      table[7][b[8]]  ^ table[6][b[9]]  ^ table[5][b[10]] ^ table[4][b[11]] ^
+                      table[3][b[12]] ^ table[2][b[13]] ^ table[1][b[14]] ^ table[0][b[15]];
+
+        memory_region_ptr += OWN_CRC32_SLICE_COUNT;
+    }
+
+    // Tail byte by byte
+    for (; bytes_to_hash > 0u; --bytes_to_hash)
+    {
+        current_crc = (current_crc >> 8u) ^ table[0][(current_crc ^ *memory_region_ptr) & 0xFFu];
+
+        ++memory_region_ptr;
+    }
+
+    return current_crc;
+}
+
+
+/**
+ * @brief Lookup tables for slicing-by-16 CRC32 calculation with a given polynomial
+ *
+ * @details table[k][b] is CRC of byte b followed by k zero bytes, with zero initial value.
+ */
+typedef struct
+{
+    uint32_t polynomial;                            /**< Polynomial the tables are generated for */
+    uint8_t  is_ready;                              /**< Tables are generated */
+    uint32_t table[OWN_CRC32_SLICE_COUNT][256u];    /**< Lookup tables */
+} own_crc32_slice_table_t;
+
+
+/**
+ * @brief Returns slicing-by-16 tables for a polynomial, tables are regenerated when the polynomial changes
+ *
+ * @note The cache is per thread, so no synchronization is needed.
+ */
+static inline const own_crc32_slice_table_t *dmlc_own_get_crc32_slice_table(uint32_t polynomial)
+{
+    static OWN_THREAD_LOCAL own_crc32_slice_table_t cache;
+
+    if (cache.is_ready && (cache.polynomial == polynomial))
+    {
+        return &cache;
+    }
+
+    for (uint32_t byte = 0u; byte < 256u; ++byte)
+    {
+        cache.table[0][byte] = dmlc_own_crc_byte_32u(0u, (uint8_t) byte, polynomial);
+    }
+
+    for (uint32_t slice = 1u; slice < OWN_CRC32_SLICE_COUNT; ++slice)
+    {
+        for (uint32_t byte = 0u; byte < 256u; ++byte)
+        {
+            const uint32_t previous = cache.table[slice - 1u][byte];
+
+            cache.table[slice][byte] = (previous << 8u) ^ cache.table[0][previous >> 24u];
+        }
+    }
+
+    cache.polynomial = polynomial;
+    cache.is_ready   = OWN_BOOL_TRUE;
+
+    return &cache;
+}
+
+
+DML_CORE_OWN_INLINE(uint32_t, crc_32u_slice_16, ( const uint8_t *memory_region_ptr,
+                                                 uint32_t       bytes_to_hash,
+                                                 uint32_t       init_crc,
+                                                 uint32_t       polynomial ) )
+{
+    const own_crc32_slice_table_t *tables = dmlc_own_get_crc32_slice_table(polynomial);
+    const uint32_t (*table)[256u]         = tables->table;
+
+    uint32_t current_crc = init_crc;
+
+    // 16 bytes per step, CRC is XOR-ed into the first four of them
+    for (; bytes_to_hash >= OWN_CRC32_SLICE_COUNT; bytes_to_hash -= OWN_CRC32_SLICE_COUNT)
+    {
+        const uint8_t *b = memory_region_ptr;
+
+        const uint32_t word = current_crc ^ (((uint32_t) b[0] << 24u) | ((uint32_t) b[1] << 16u) |
+                                             ((uint32_t) b[2] << 8u) | (uint32_t) b[3]);
+
+        current_crc = table[15][word >> 24u] ^
+                      table[14][(word >> 16u) & 0xFFu] ^
+                      table[13][(word >> 8u) & 0xFFu] ^
+                      table[12][word & 0xFFu] ^
+                      table[11][b[4]] ^ table[10][b[5]] ^ table[9][b[6]]  ^ table[8][b[7]] ^
+                      table[7][b[8]]  ^ table[6][b[9]]  ^ table[5][b[10]] ^ table[4][b[11]] ^
+                      table[3][b[12]] ^ table[2][b[13]] ^ table[1][b[14]] ^ table[0][b[15]];
+
+        memory_region_ptr += OWN_CRC32_SLICE_COUNT;
+    }
+
+    // Tail byte by byte
+    for (; bytes_to_hash > 0u; --bytes_to_hash)
+    {
+        current_crc = (current_crc << 8u) ^ table[0][(current_crc >> 24u) ^ *memory_region_ptr];
+
+        ++memory_region_ptr;
+    }
+
+    return current_crc;
+}
+
+
+/**
+ * @brief Returns floor(x^64 / P) for the full 33-bit polynomial, the constant of Barrett reduction
+ */
+DML_CORE_OWN_INLINE(uint64_t, crc_32u_barrett_quotient, ( uint32_t polynomial ) )
+{
+    const uint64_t full_polynomial = ((uint64_t) 1u << 32u) | polynomial;
+    uint64_t       window          = (uint64_t) 1u << 32u; // x^64, window bit 32 stands for x^(32 + degree)
+    uint64_t       quotient        = 0u;
+
+    // Long division bit by bit
+    for (int32_t degree = 32; degree >= 0; --degree)
+    {
+        if (window & ((uint64_t) 1u << 32u))
+        {
+            window ^= full_polynomial;
+            quotient |= (uint64_t) 1u << (uint32_t) degree;
+        }
+
+        window <<= 1u;
+    }
+
+    return quotient;
+}
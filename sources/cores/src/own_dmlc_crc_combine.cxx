@@ -0,0 +1,144 @@
+/*
+ * Copyright 2020-2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @brief Contain combination of CRC values of adjacent memory regions:
+ *      - @ref dmlc_own_crc_multiply_modulo()
+ *      - @ref dmlc_own_get_crc_combine_table()
+ *      - @ref dmlc_own_get_crc_shift_operator()
+ *
+ * @details CRC is linear: CRC(A || B) with seed S is CRC(A) * x^(8 * |B|) mod P xor CRC(B) with zero seed.
+ * The factor is a product of x^(8 * 2^k) mod P for the set bits of |B|, so it takes O(log |B|) multiplications.
+ * CRC values are MSB-first remainders of the given width, the way @ref dmlc_calculate_crc_32u() keeps them.
+ *
+ * @date 10/18/2026
+ *
+ */
+
+#define OWN_CRC_COMBINE_POWERS_COUNT 64u    /**< Number of x^(8 * 2^k) mod P values, enough for any 64-bit size */
+#define OWN_CRC_COMBINE_CACHE_SIZE   16u    /**< Number of cached operators of recently combined sizes */
+
+/**
+ * @brief Operators of CRC combination, generated for a polynomial of a width
+ *
+ * @details Chunks of a split operation are mostly of the same size,
+ * so operators of recently combined sizes are kept and reused without multiplications.
+ */
+typedef struct
+{
+    uint32_t polynomial;                                    /**< Polynomial the operators are generated for */
+    uint32_t width;                                         /**< Width of the polynomial, 16 or 32 */
+    uint32_t is_ready;                                      /**< Operators are generated */
+    uint32_t powers[OWN_CRC_COMBINE_POWERS_COUNT];          /**< powers[k] is x^(8 * 2^k) mod P */
+    uint64_t cached_sizes[OWN_CRC_COMBINE_CACHE_SIZE];      /**< Sizes of the cached operators */
+    uint32_t cached_operators[OWN_CRC_COMBINE_CACHE_SIZE];  /**< x^(8 * size) mod P for the cached sizes */
+} own_crc_combine_table_t;
+
+/**
+ * @brief Multiplies two remainders modulo a polynomial of a width, bit order is MSB-first
+ */
+static inline uint32_t dmlc_own_crc_multiply_modulo(uint32_t first,
+                                                    uint32_t second,
+                                                    uint32_t polynomial,
+                                                    uint32_t width)
+{
+    const uint32_t high_bit = 1u << (width - 1u);
+    const uint32_t mask     = (high_bit - 1u) | high_bit;
+    uint32_t       product  = 0u;
+
+    // Horner's scheme from the highest coefficient of the first multiplier
+    for (uint32_t bit = high_bit; 0u != bit; bit >>= 1u)
+    {
+        product = ((product << 1u) ^ ((product & high_bit) ? polynomial : 0u)) & mask;
+
+        if (first & bit)
+        {
+            product ^= second;
+        }
+    }
+
+    return product;
+}
+
+/**
+ * @brief Returns combination operators for a polynomial, they are regenerated when the polynomial changes
+ *
+ * @note The cache is per thread, so no synchronization is needed.
+ */
+static inline own_crc_combine_table_t *dmlc_own_get_crc_combine_table(own_crc_combine_table_t *cache_ptr,
+                                                                      uint32_t polynomial,
+                                                                      uint32_t width)
+{
+    if (cache_ptr->is_ready && (cache_ptr->polynomial == polynomial))
+    {
+        return cache_ptr;
+    }
+
+    // x^8 is a remainder already for both widths
+    uint32_t power = 1u << 8u;
+
+    for (uint32_t k = 0u; k < OWN_CRC_COMBINE_POWERS_COUNT; ++k)
+    {
+        cache_ptr->powers[k] = power;
+        power                = dmlc_own_crc_multiply_modulo(power, power, polynomial, width);
+    }
+
+    // Zero size is combined with x^0
+    for (uint32_t i = 0u; i < OWN_CRC_COMBINE_CACHE_SIZE; ++i)
+    {
+        cache_ptr->cached_sizes[i]     = 0u;
+        cache_ptr->cached_operators[i] = 1u;
+    }
+
+    cache_ptr->polynomial = polynomial;
+    cache_ptr->width      = width;
+    cache_ptr->is_ready   = OWN_BOOL_TRUE;
+
+    return cache_ptr;
+}
+
+/**
+ * @brief Returns x^(8 * bytes) mod P, the operator that shifts a CRC value over the bytes
+ */
+static inline uint32_t dmlc_own_get_crc_shift_operator(own_crc_combine_table_t *table_ptr, uint64_t bytes)
+{
+    // Fibonacci hashing spreads sizes that are multiples of big powers of two
+    const uint32_t slot = (uint32_t) ((bytes * 0x9E3779B97F4A7C15ull) >> 60u);
+
+    if (table_ptr->cached_sizes[slot] == bytes)
+    {
+        return table_ptr->cached_operators[slot];
+    }
+
+    uint32_t shift_operator = 1u;
+    uint32_t k              = 0u;
+
+    for (uint64_t rest = bytes; 0u != rest; rest >>= 1u, ++k)
+    {
+        if (rest & 1u)
+        {
+            shift_operator = dmlc_own_crc_multiply_modulo(table_ptr->powers[k],
+                                                          shift_operator,
+                                                          table_ptr->polynomial,
+                                                          table_ptr->width);
+        }
+    }
+
+    table_ptr->cached_sizes[slot]     = bytes;
+    table_ptr->cached_operators[slot] = shift_operator;
+
+    return shift_operator;
+}
@@ -0,0 +1,600 @@
+/*
+ * Copyright 2020-2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @brief Contain carry-less multiplication folding used by both kernel sets:
+ *      - @ref dmlc_own_crc_32u_fold()
+ *      - @ref dmlc_own_crc_reflected_32u_fold()
+ *      - @ref dmlc_own_copy_with_crc_32u()
+ *      - @ref dmlc_own_calculate_crc_16u_blocks()
+ *
+ * @details Both kernels take 16-byte blocks and may store every loaded block to a destination,
+ * so a copy and a CRC are done with a single pass over the source.
+ * Only SSE4.1 and PCLMULQDQ are required.
+ *
+ * @date 10/18/2026
+ *
+ */
+
+/**
+ * @brief Minimal length for the folding kernels, shorter buffers are hashed with lookup tables
+ */
+#define OWN_CRC_FOLD_MIN_LENGTH 256u
+
+/**
+ * @brief Tells if the folding kernels can be used, CPUID is asked once
+ *
+ * @note Races are harmless here: every caller computes the same value.
+ */
+static inline int dmlc_own_is_crc_fold_available(void)
+{
+    static int32_t is_available = -1;
+
+    if (is_available < 0)
+    {
+        is_available = dmlc_own_is_pclmul_supported() ? 1 : 0;
+    }
+
+    return is_available;
+}
+
+/**
+ * @brief Bit-reverses the lowest `bits` bits of a value
+ */
+static inline uint64_t dmlc_own_reflect_bits(uint64_t value, uint32_t bits)
+{
+    uint64_t result = 0u;
+
+    for (uint32_t i = 0u; i < bits; ++i)
+    {
+        result = (result << 1u) | ((value >> i) & 1u);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Constants for MSB-first folding, generated for a polynomial
+ *
+ * @details k(n) stands for x^n mod P. Folding a 128-bit lane over d bits multiplies
+ * its high quadword by k(d + 64) and its low quadword by k(d).
+ */
+typedef struct
+{
+    uint32_t polynomial;        /**< Polynomial the constants are generated for */
+    uint32_t is_ready;          /**< Constants are generated */
+    uint64_t fold_8x128[2];     /**< k(1024), k(1024 + 64): main loop, 8 lanes at a time */
+    uint64_t fold_lane[7][2];   /**< Folds lane i into lane 7, distance (7 - i) * 128 */
+    uint64_t fold_96;           /**< k(96): 128 to 96 bits reduction */
+    uint64_t fold_64;           /**< k(64): 96 to 64 bits reduction */
+    uint64_t full_polynomial;   /**< 33-bit polynomial */
+    uint64_t mu;                /**< floor(x^64 / P) */
+} own_crc32_fold_t;
+
+static inline void dmlc_own_gen_crc_fold(uint32_t polynomial, own_crc32_fold_t *fold_ptr)
+{
+    // x^n mod P for every n up to 1088, only multiples of 32 are needed
+    uint64_t k[1088u / 32u + 1u];
+    uint32_t remainder = 1u;
+
+    for (uint32_t n = 0u; n <= 1088u; ++n)
+    {
+        if (0u == (n % 32u))
+        {
+            k[n / 32u] = remainder;
+        }
+
+        remainder = (remainder << 1u) ^ ((remainder & OWN_HIGH_BIT_MASK_32U) ? polynomial : 0u);
+    }
+
+    fold_ptr->fold_8x128[0] = k[1024u / 32u];
+    fold_ptr->fold_8x128[1] = k[(1024u + 64u) / 32u];
+
+    for (uint32_t lane = 0u; lane < 7u; ++lane)
+    {
+        const uint32_t distance = (7u - lane) * 128u;
+
+        fold_ptr->fold_lane[lane][0] = k[distance / 32u];
+        fold_ptr->fold_lane[lane][1] = k[(distance + 64u) / 32u];
+    }
+
+    fold_ptr->fold_96         = k[96u / 32u];
+    fold_ptr->fold_64         = k[64u / 32u];
+    fold_ptr->full_polynomial = ((uint64_t) 1u << 32u) | polynomial;
+    fold_ptr->mu              = dmlc_own_crc_32u_barrett_quotient(polynomial);
+    fold_ptr->polynomial      = polynomial;
+    fold_ptr->is_ready        = OWN_BOOL_TRUE;
+}
+
+/**
+ * @brief Returns folding constants for a polynomial, constants are regenerated when it changes
+ *
+ * @note The cache is per thread, so no synchronization is needed.
+ */
+static inline const own_crc32_fold_t *dmlc_own_get_crc_fold(uint32_t polynomial)
+{
+    static OWN_THREAD_LOCAL own_crc32_fold_t cache;
+
+    if (!cache.is_ready || (cache.polynomial != polynomial))
+    {
+        dmlc_own_gen_crc_fold(polynomial, &cache);
+    }
+
+    return &cache;
+}
+
+/**
+ * @brief Constants for reflected (LSB-first) folding, generated for a polynomial
+ *
+ * @details k(n) stands for bit-reversed (x^n mod P) shifted left by 1. Folding a 128-bit lane
+ * over d bits multiplies its low quadword by k(d + 32) and its high quadword by k(d - 32).
+ */
+typedef struct
+{
+    uint32_t polynomial;        /**< Polynomial in normal form the constants are generated for */
+    uint32_t is_ready;          /**< Constants are generated */
+    uint64_t fold_8x128[2];     /**< k(1024 + 32), k(1024 - 32): main loop, 8 lanes at a time */
+    uint64_t fold_lane[7][2];   /**< Folds lane i into lane 7, distance (7 - i) * 128 */
+    uint64_t fold_64;           /**< k(64): 64 to 32 bits reduction */
+    uint64_t poly_reflected;    /**< Bit-reversed 33-bit polynomial */
+    uint64_t mu_reflected;      /**< Bit-reversed floor(x^64 / P) */
+} own_crc32_reflected_fold_t;
+
+static inline void dmlc_own_gen_crc_reflected_fold(uint32_t polynomial, own_crc32_reflected_fold_t *fold_ptr)
+{
+    // x^n mod P for every n up to 1056, only multiples of 32 are needed
+    uint64_t k[1056u / 32u + 1u];
+    uint32_t remainder = 1u;
+
+    for (uint32_t n = 0u; n <= 1056u; ++n)
+    {
+        if (0u == (n % 32u))
+        {
+            k[n / 32u] = dmlc_own_reflect_bits(remainder, 32u) << 1u;
+        }
+
+        remainder = (remainder << 1u) ^ ((remainder & OWN_HIGH_BIT_MASK_32U) ? polynomial : 0u);
+    }
+
+    fold_ptr->fold_8x128[0] = k[(1024u + 32u) / 32u];
+    fold_ptr->fold_8x128[1] = k[(1024u - 32u) / 32u];
+
+    for (uint32_t lane = 0u; lane < 7u; ++lane)
+    {
+        const uint32_t distance = (7u - lane) * 128u;
+
+        fold_ptr->fold_lane[lane][0] = k[(distance + 32u) / 32u];
+        fold_ptr->fold_lane[lane][1] = k[(distance - 32u) / 32u];
+    }
+
+    fold_ptr->fold_64 = k[64u / 32u];
+
+    const uint64_t full_polynomial = ((uint64_t) 1u << 32u) | polynomial;
+
+    fold_ptr->poly_reflected = dmlc_own_reflect_bits(full_polynomial, 33u);
+    fold_ptr->mu_reflected   = dmlc_own_reflect_bits(dmlc_own_crc_32u_barrett_quotient(polynomial), 33u);
+    fold_ptr->polynomial     = polynomial;
+    fold_ptr->is_ready       = OWN_BOOL_TRUE;
+}
+
+/**
+ * @brief Returns reflected folding constants for a polynomial, constants are regenerated when it changes
+ *
+ * @note The cache is per thread, so no synchronization is needed.
+ */
+static inline const own_crc32_reflected_fold_t *dmlc_own_get_crc_reflected_fold(uint32_t polynomial)
+{
+    static OWN_THREAD_LOCAL own_crc32_reflected_fold_t cache;
+
+    if (!cache.is_ready || (cache.polynomial != polynomial))
+    {
+        dmlc_own_gen_crc_reflected_fold(polynomial, &cache);
+    }
+
+    return &cache;
+}
+
+/**
+ * @brief Loads a 16-byte block, also stores it to the destination when there is one
+ */
+static inline __m128i dmlc_own_fold_load_128(const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t offset)
+{
+    const __m128i block = _mm_loadu_si128((const __m128i *) (src_ptr + offset));
+
+    if (NULL != dst_ptr)
+    {
+        _mm_storeu_si128((__m128i *) (dst_ptr + offset), block);
+    }
+
+    return block;
+}
+
+/**
+ * @brief Reverses bytes of a block, so that the first byte in memory becomes the highest one
+ */
+static inline __m128i dmlc_own_reverse_bytes_128(__m128i block)
+{
+    const __m128i reverse_mask = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+    return _mm_shuffle_epi8(block, reverse_mask);
+}
+
+/**
+ * @brief Folds a 128-bit lane over the distance encoded in the constant and adds the result to the target
+ */
+static inline __m128i dmlc_own_fold_128(__m128i lane, __m128i constant, __m128i target)
+{
+    const __m128i low  = _mm_clmulepi64_si128(lane, constant, 0x00);
+    const __m128i high = _mm_clmulepi64_si128(lane, constant, 0x11);
+
+    return _mm_xor_si128(target, _mm_xor_si128(low, high));
+}
+
+/**
+ * @brief Reduces a folded 128-bit lane to CRC32
+ *
+ * @param[in]  accumulator  lane with the data already folded into it
+ * @param[in]  fold_ptr     constants for the polynomial
+ *
+ * @return CRC value
+ */
+static inline uint32_t dmlc_own_crc_32u_fold_reduce(__m128i accumulator, const own_crc32_fold_t *fold_ptr)
+{
+    // CRC is A * x^32 mod P. A * x^32 = H * x^96 + L * x^32 is reduced to 96 bits first
+    const __m128i constants = _mm_set_epi64x((long long) fold_ptr->fold_96, (long long) fold_ptr->fold_64);
+
+    __m128i temp = _mm_clmulepi64_si128(accumulator, constants, 0x11);
+    accumulator  = _mm_xor_si128(temp, _mm_slli_si128(_mm_move_epi64(accumulator), 4));
+
+    // Then bits 64..95 are folded down to 64 bits
+    temp = _mm_clmulepi64_si128(_mm_srli_si128(accumulator, 8), constants, 0x00);
+    const uint64_t remainder = (uint64_t) _mm_cvtsi128_si64(_mm_xor_si128(_mm_move_epi64(accumulator), temp));
+
+    // Barrett reduction of the 64-bit remainder
+    const __m128i barrett = _mm_set_epi64x((long long) fold_ptr->full_polynomial, (long long) fold_ptr->mu);
+
+    temp = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long) (remainder >> 32u)), barrett, 0x00);
+    temp = _mm_clmulepi64_si128(_mm_srli_epi64(temp, 32), barrett, 0x10);
+
+    return (uint32_t) (remainder ^ (uint64_t) _mm_cvtsi128_si64(temp));
+}
+
+/**
+ * @brief CRC32 of whole 16-byte blocks, at least 128 bytes are required
+ *
+ * @param[in]  src_ptr       source blocks
+ * @param[out] dst_ptr       destination the source is copied to, NULL for hashing only
+ * @param[in]  blocks_count  number of 16-byte blocks, 8 at least
+ * @param[in]  init_crc      CRC seed
+ * @param[in]  fold_ptr      constants for the polynomial
+ *
+ * @return CRC value
+ */
+static inline uint32_t dmlc_own_crc_32u_fold(const uint8_t          *src_ptr,
+                                             uint8_t                *dst_ptr,
+                                             uint32_t                blocks_count,
+                                             uint32_t                init_crc,
+                                             const own_crc32_fold_t *fold_ptr)
+{
+    __m128i x[8];
+
+    for (uint32_t i = 0u; i < 8u; ++i)
+    {
+        x[i] = dmlc_own_reverse_bytes_128(dmlc_own_fold_load_128(src_ptr, dst_ptr, 16u * i));
+    }
+
+    // CRC goes to the highest 32 bits, they hold the first 4 bytes
+    x[0] = _mm_xor_si128(x[0], _mm_set_epi32((int) init_crc, 0, 0, 0));
+
+    uint32_t offset = 128u;
+    blocks_count -= 8u;
+
+    // Fold 128 bytes at a time, 8 independent chains hide carry-less multiplication latency
+    const __m128i fold_8x128 = _mm_loadu_si128((const __m128i *) fold_ptr->fold_8x128);
+
+    for (; blocks_count >= 8u; blocks_count -= 8u)
+    {
+        for (uint32_t i = 0u; i < 8u; ++i)
+        {
+            const __m128i block = dmlc_own_fold_load_128(src_ptr, dst_ptr, offset + 16u * i);
+
+            x[i] = dmlc_own_fold_128(x[i], fold_8x128, dmlc_own_reverse_bytes_128(block));
+        }
+
+        offset += 128u;
+    }
+
+    // Reduce 8 lanes into the last one
+    __m128i accumulator = x[7];
+
+    for (uint32_t i = 0u; i < 7u; ++i)
+    {
+        accumulator = dmlc_own_fold_128(x[i], _mm_loadu_si128((const __m128i *) fold_ptr->fold_lane[i]), accumulator);
+    }
+
+    // Remaining blocks are folded one by one, distance is 128 bits
+    const __m128i fold_1x128 = _mm_loadu_si128((const __m128i *) fold_ptr->fold_lane[6]);
+
+    for (; blocks_count > 0u; --blocks_count)
+    {
+        const __m128i block = dmlc_own_fold_load_128(src_ptr, dst_ptr, offset);
+
+        accumulator = dmlc_own_fold_128(accumulator, fold_1x128, dmlc_own_reverse_bytes_128(block));
+        offset += 16u;
+    }
+
+    return dmlc_own_crc_32u_fold_reduce(accumulator, fold_ptr);
+}
+
+/**
+ * @brief Reflected CRC32 of whole 16-byte blocks, at least 128 bytes are required
+ *
+ * @param[in]  src_ptr        source blocks
+ * @param[out] dst_ptr        destination the source is copied to, NULL for hashing only
+ * @param[in]  blocks_count   number of 16-byte blocks, 8 at least
+ * @param[in]  reflected_crc  bit-reversed CRC seed
+ * @param[in]  fold_ptr       constants for the polynomial
+ *
+ * @return Bit-reversed CRC value
+ */
+static inline uint32_t dmlc_own_crc_reflected_32u_fold(const uint8_t                    *src_ptr,
+                                                       uint8_t                          *dst_ptr,
+                                                       uint32_t                          blocks_count,
+                                                       uint32_t                          reflected_crc,
+                                                       const own_crc32_reflected_fold_t *fold_ptr)
+{
+    const __m128i mask32 = _mm_set_epi32(0, 0, 0, -1);
+
+    __m128i x[8];
+
+    for (uint32_t i = 0u; i < 8u; ++i)
+    {
+        x[i] = dmlc_own_fold_load_128(src_ptr, dst_ptr, 16u * i);
+    }
+
+    x[0] = _mm_xor_si128(x[0], _mm_cvtsi32_si128((int) reflected_crc));
+
+    uint32_t offset = 128u;
+    blocks_count -= 8u;
+
+    // Fold 128 bytes at a time, 8 independent chains hide carry-less multiplication latency
+    const __m128i fold_8x128 = _mm_loadu_si128((const __m128i *) fold_ptr->fold_8x128);
+
+    for (; blocks_count >= 8u; blocks_count -= 8u)
+    {
+        for (uint32_t i = 0u; i < 8u; ++i)
+        {
+            x[i] = dmlc_own_fold_128(x[i], fold_8x128, dmlc_own_fold_load_128(src_ptr, dst_ptr, offset + 16u * i));
+        }
+
+        offset += 128u;
+    }
+
+    // Reduce 8 lanes into the last one
+    __m128i accumulator = x[7];
+
+    for (uint32_t i = 0u; i < 7u; ++i)
+    {
+        accumulator = dmlc_own_fold_128(x[i], _mm_loadu_si128((const __m128i *) fold_ptr->fold_lane[i]), accumulator);
+    }
+
+    // Remaining blocks are folded one by one, distance is 128 bits
+    const __m128i fold_1x128 = _mm_loadu_si128((const __m128i *) fold_ptr->fold_lane[6]);
+
+    for (; blocks_count > 0u; --blocks_count)
+    {
+        accumulator = dmlc_own_fold_128(accumulator, fold_1x128, dmlc_own_fold_load_128(src_ptr, dst_ptr, offset));
+        offset += 16u;
+    }
+
+    // 128 to 64 bits: low quadword is folded with k(96)
+    __m128i temp = _mm_clmulepi64_si128(accumulator, fold_1x128, 0x10);
+    accumulator  = _mm_xor_si128(_mm_srli_si128(accumulator, 8), temp);
+
+    // 64 to 32 bits
+    const __m128i fold_64 = _mm_cvtsi64_si128((long long) fold_ptr->fold_64);
+    temp        = _mm_clmulepi64_si128(_mm_and_si128(accumulator, mask32), fold_64, 0x00);
+    accumulator = _mm_xor_si128(_mm_srli_si128(accumulator, 4), temp);
+
+    // Barrett reduction
+    const __m128i barrett = _mm_set_epi64x((long long) fold_ptr->mu_reflected, (long long) fold_ptr->poly_reflected);
+    temp        = _mm_clmulepi64_si128(_mm_and_si128(accumulator, mask32), barrett, 0x10);
+    temp        = _mm_clmulepi64_si128(_mm_and_si128(temp, mask32), barrett, 0x00);
+    accumulator = _mm_xor_si128(accumulator, temp);
+
+    return (uint32_t) _mm_extract_epi32(accumulator, 1);
+}
+
+/**
+ * @brief Size of the chunks copied and hashed without folding, the chunk stays in L1 between the two steps
+ */
+#define OWN_COPY_CRC_CHUNK_SIZE 4096u
+
+/**
+ * @brief Copies a memory region and calculates CRC32 of it with one read of the source
+ *
+ * @param[in]  source_ptr        source memory region
+ * @param[out] destination_ptr   destination memory region
+ * @param[in]  bytes_to_process  memory regions size, in bytes
+ * @param[in]  init_crc          CRC seed, bit-reversed for the reflected mode
+ * @param[in]  polynomial        polynomial in normal form
+ * @param[in]  is_reflected      calculate reflected (LSB-first) CRC
+ *
+ * @return CRC value, bit-reversed for the reflected mode
+ */
+static inline uint32_t dmlc_own_copy_with_crc_32u(const uint8_t *source_ptr,
+                                                  uint8_t       *destination_ptr,
+                                                  uint32_t       bytes_to_process,
+                                                  uint32_t       init_crc,
+                                                  uint32_t       polynomial,
+                                                  uint8_t        is_reflected)
+{
+    uint32_t current_crc = init_crc;
+
+    if ((bytes_to_process >= OWN_CRC_FOLD_MIN_LENGTH) && dmlc_own_is_crc_fold_available())
+    {
+        const uint32_t blocks_count = bytes_to_process / 16u;
+
+        current_crc = (is_reflected)
+                      ? dmlc_own_crc_reflected_32u_fold(source_ptr,
+                                                        destination_ptr,
+                                                        blocks_count,
+                                                        current_crc,
+                                                        dmlc_own_get_crc_reflected_fold(polynomial))
+                      : dmlc_own_crc_32u_fold(source_ptr,
+                                              destination_ptr,
+                                              blocks_count,
+                                              current_crc,
+                                              dmlc_own_get_crc_fold(polynomial));
+
+        source_ptr       += blocks_count * 16u;
+        destination_ptr  += blocks_count * 16u;
+        bytes_to_process -= blocks_count * 16u;
+    }
+
+    // Short buffers, tails and CPUs without PCLMULQDQ: hash a chunk, then copy it while it is still cached
+    while (0u < bytes_to_process)
+    {
+        const uint32_t chunk_size = (bytes_to_process < OWN_COPY_CRC_CHUNK_SIZE) ? bytes_to_process : OWN_COPY_CRC_CHUNK_SIZE;
+
+        current_crc = (is_reflected)
+                      ? dmlc_own_crc_reflected_32u_slice_16(source_ptr, chunk_size, current_crc, dmlc_own_reverse_32u(polynomial))
+                      : dmlc_own_crc_32u_slice_16(source_ptr, chunk_size, current_crc, polynomial);
+
+        for (uint32_t i = 0u; i < chunk_size; ++i)
+        {
+            destination_ptr[i] = source_ptr[i];
+        }
+
+        source_ptr       += chunk_size;
+        destination_ptr  += chunk_size;
+        bytes_to_process -= chunk_size;
+    }
+
+    return current_crc;
+}
+
+/**
+ * @brief Number of blocks hashed at once by @ref dmlc_own_calculate_crc_16u_blocks()
+ */
+#define OWN_CRC_MULTI_BUFFER_LANES 8u
+
+/**
+ * @brief Minimal block size for multi-buffer folding, smaller blocks are hashed with lookup tables
+ */
+#define OWN_CRC_MULTI_BUFFER_MIN_LENGTH 64u
+
+/**
+ * @brief CRC32 of whole 16-byte blocks for several buffers at once
+ *
+ * @details Every buffer is folded by a single lane, 128 bits at a time. A single buffer would wait for
+ * carry-less multiplication latency on every step, interleaved lanes keep the multiplier busy instead.
+ *
+ * @param[in]     src_ptrs      buffers, @ref OWN_CRC_MULTI_BUFFER_LANES of them
+ * @param[in]     blocks_count  number of 16-byte blocks in every buffer, 1 at least
+ * @param[in,out] crc_ptr       CRC seeds / results for every buffer
+ * @param[in]     fold_ptr      constants for the polynomial
+ */
+static inline void dmlc_own_crc_32u_multi_fold(const uint8_t *const   *src_ptrs,
+                                               uint32_t                blocks_count,
+                                               uint32_t               *crc_ptr,
+                                               const own_crc32_fold_t *fold_ptr)
+{
+    const __m128i fold_1x128 = _mm_loadu_si128((const __m128i *) fold_ptr->fold_lane[6]);
+    __m128i       x[OWN_CRC_MULTI_BUFFER_LANES];
+
+    for (uint32_t lane = 0u; lane < OWN_CRC_MULTI_BUFFER_LANES; ++lane)
+    {
+        x[lane] = dmlc_own_reverse_bytes_128(_mm_loadu_si128((const __m128i *) src_ptrs[lane]));
+        x[lane] = _mm_xor_si128(x[lane], _mm_set_epi32((int) crc_ptr[lane], 0, 0, 0));
+    }
+
+    for (uint32_t offset = 16u; offset < blocks_count * 16u; offset += 16u)
+    {
+        for (uint32_t lane = 0u; lane < OWN_CRC_MULTI_BUFFER_LANES; ++lane)
+        {
+            const __m128i block = _mm_loadu_si128((const __m128i *) (src_ptrs[lane] + offset));
+
+            x[lane] = dmlc_own_fold_128(x[lane], fold_1x128, dmlc_own_reverse_bytes_128(block));
+        }
+    }
+
+    for (uint32_t lane = 0u; lane < OWN_CRC_MULTI_BUFFER_LANES; ++lane)
+    {
+        crc_ptr[lane] = dmlc_own_crc_32u_fold_reduce(x[lane], fold_ptr);
+    }
+}
+
+/**
+ * @brief Calculates CRC16 for a series of equally sized blocks
+ *
+ * @param[in]     memory_region_ptr  first block
+ * @param[in]     block_size         size of every block, in bytes
+ * @param[in]     block_stride       distance between starts of neighbouring blocks, in bytes
+ * @param[in]     block_count        number of blocks
+ * @param[in,out] crc_ptr            CRC seeds / results, one per block
+ * @param[in]     polynomial         polynomial in normal form
+ */
+static inline void dmlc_own_calculate_crc_16u_blocks(const uint8_t *memory_region_ptr,
+                                                     uint32_t       block_size,
+                                                     uint32_t       block_stride,
+                                                     uint32_t       block_count,
+                                                     uint16_t      *crc_ptr,
+                                                     uint16_t       polynomial)
+{
+    if ((block_size < OWN_CRC_MULTI_BUFFER_MIN_LENGTH) || !dmlc_own_is_crc_fold_available())
+    {
+        for (uint32_t block = 0u; block < block_count; ++block)
+        {
+            crc_ptr[block] = dmlc_own_crc_16u_slice_8(memory_region_ptr + block * block_stride,
+                                                      block_size,
+                                                      crc_ptr[block],
+                                                      polynomial);
+        }
+
+        return;
+    }
+
+    // Non-reflected CRC16 equals to high half of CRC32 with the polynomial and the seed shifted by 16 bits
+    const own_crc32_fold_t *fold_ptr     = dmlc_own_get_crc_fold((uint32_t) polynomial << 16u);
+    const uint32_t          blocks_count = block_size / 16u;
+    const uint32_t          tail_size    = block_size % 16u;
+
+    for (uint32_t first = 0u; first < block_count; first += OWN_CRC_MULTI_BUFFER_LANES)
+    {
+        const uint8_t *src_ptrs[OWN_CRC_MULTI_BUFFER_LANES];
+        uint32_t       crc[OWN_CRC_MULTI_BUFFER_LANES];
+
+        // The last group repeats its last block in the unused lanes, their results are dropped
+        for (uint32_t lane = 0u; lane < OWN_CRC_MULTI_BUFFER_LANES; ++lane)
+        {
+            const uint32_t block = ((first + lane) < block_count) ? (first + lane) : (block_count - 1u);
+
+            src_ptrs[lane] = memory_region_ptr + block * block_stride;
+            crc[lane]      = (uint32_t) crc_ptr[block] << 16u;
+        }
+
+        dmlc_own_crc_32u_multi_fold(src_ptrs, blocks_count, crc, fold_ptr);
+
+        for (uint32_t lane = 0u; (lane < OWN_CRC_MULTI_BUFFER_LANES) && ((first + lane) < block_count); ++lane)
+        {
+            crc_ptr[first + lane] = dmlc_own_crc_16u_slice_8(src_ptrs[lane] + blocks_count * 16u,
+                                                             tail_size,
+                                                             (uint16_t) (crc[lane] >> 16u),
+                                                             polynomial);
+        }
+    }
+}
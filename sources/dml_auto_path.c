@@ -0,0 +1,277 @@
+/*
+ * Copyright 2020-2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @brief Contains an implementation of @ref DML_PATH_AUTO policy and functions to tune and monitor it:
+ *      - @ref dml_set_auto_path_threshold()
+ *      - @ref dml_get_auto_path_statistics()
+ * @date 10/18/2026
+ *
+ */
+#if defined(DML_HW)
+    #include "hardware_api.h"
+#endif
+#include "own_dml_api.h"
+#include "own_dml_internal_state.h"
+
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define OWN_ATOMIC_INCREMENT(counter)  _InterlockedIncrement64((volatile int64_t *) &(counter))
+    #define OWN_ATOMIC_LOAD(value)         (value)
+    #define OWN_ATOMIC_STORE(value, x)     ((value) = (x))
+    #define OWN_ATOMIC_CAS(value, expected, desired)                                         \
+        ((long) (expected) == _InterlockedCompareExchange((volatile long *) &(value),    \
+                                                          (long) (desired), (long) (expected)))
+#else
+    #define OWN_ATOMIC_INCREMENT(counter)  __atomic_fetch_add(&(counter), 1u, __ATOMIC_RELAXED)
+    #define OWN_ATOMIC_LOAD(value)         __atomic_load_n(&(value), __ATOMIC_RELAXED)
+    #define OWN_ATOMIC_STORE(value, x)     __atomic_store_n(&(value), (x), __ATOMIC_RELAXED)
+    #define OWN_ATOMIC_CAS(value, expected, desired) \
+        __atomic_compare_exchange_n(&(value), &(expected), (desired), 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#endif
+
+#define OWN_OPERATIONS_COUNT        (DML_OP_CACHE_FLUSH + 1u) /**< Size of the table indexed by @ref dml_operation_t */
+#define OWN_NEVER_ON_HARDWARE       UINT32_MAX                /**< Threshold of operations not worth a submission */
+#define OWN_CACHE_LINE_MASK         63u
+
+#define OWN_BUSY_SCORE_REJECTION    32u   /**< Busy score increment for a rejected submission         */
+#define OWN_BUSY_SCORE_THRESHOLD    128u  /**< Device is considered busy starting from this score     */
+#define OWN_BUSY_SCORE_MAX          1024u /**< Limits the time jobs stay on CPU after a rejection burst */
+
+
+/**
+ * @brief Transfer size, starting from which hardware is faster than CPU, for every operation
+ *
+ * @note Read-only operations have higher thresholds as CPU handles them at the read bandwidth
+ */
+static uint32_t own_thresholds[OWN_OPERATIONS_COUNT] = {
+        [DML_OP_NOP]             = OWN_NEVER_ON_HARDWARE,
+        [DML_OP_BATCH]           = 0u,
+        [DML_OP_DRAIN]           = OWN_NEVER_ON_HARDWARE,
+        [DML_OP_MEM_MOVE]        = 16u * 1024u,
+        [DML_OP_FILL]            = 16u * 1024u,
+        [DML_OP_COMPARE]         = 32u * 1024u,
+        [DML_OP_COMPARE_PATTERN] = 32u * 1024u,
+        [DML_OP_DELTA_CREATE]    = 4u * 1024u,
+        [DML_OP_DELTA_APPLY]     = 4u * 1024u,
+        [DML_OP_DUALCAST]        = 16u * 1024u,
+        [DML_OP_CRC]             = 32u * 1024u,
+        [DML_OP_COPY_CRC]        = 16u * 1024u,
+        [DML_OP_DIF_CHECK]       = 4u * 1024u,
+        [DML_OP_DIF_INSERT]      = 4u * 1024u,
+        [DML_OP_DIF_STRIP]       = 4u * 1024u,
+        [DML_OP_DIF_UPDATE]      = 4u * 1024u,
+        [DML_OP_CACHE_FLUSH]     = 4u * 1024u
+};
+
+/**
+ * @brief Decisions counters
+ */
+static dml_auto_path_statistics_t own_statistics = {0u};
+
+/**
+ * @brief Grows with rejected submissions and decays with accepted ones and with jobs kept on CPU
+ */
+static uint32_t own_busy_score = 0u;
+
+
+static inline uint32_t own_are_overlapped(const uint8_t *first_ptr, const uint8_t *second_ptr, uint64_t length)
+{
+    return (first_ptr < second_ptr + length) && (second_ptr < first_ptr + length);
+}
+
+
+OWN_FUN(uint8_t *, auto_get_hw_context, ())
+{
+#if defined(DML_HW)
+    static uint8_t  *hw_context_ptr = NULL;
+    static uint32_t is_looked_for   = 0u;
+
+    // Races are harmless: every thread gets the same context
+    if (!OWN_ATOMIC_LOAD(is_looked_for))
+    {
+        dsahw_context_t *context_ptr = NULL;
+
+        if (DML_STATUS_OK == dsa_get_context(&context_ptr))
+        {
+            hw_context_ptr = (uint8_t *) context_ptr;
+        }
+
+        OWN_ATOMIC_STORE(is_looked_for, 1u);
+    }
+
+    return hw_context_ptr;
+#else
+    return NULL;
+#endif
+}
+
+
+OWN_FUN(dml_path_t, auto_select_path, (const dml_job_t *const dml_job_ptr, const uint8_t *const hw_state_ptr))
+{
+#if defined(DML_HW)
+    const dml_operation_t operation = dml_job_ptr->operation;
+
+    if (NULL == hw_state_ptr)
+    {
+        OWN_ATOMIC_INCREMENT(own_statistics.software_no_device);
+        return DML_PATH_SW;
+    }
+
+    const dsahw_context_t *context_ptr = (const dsahw_context_t *) hw_state_ptr;
+
+    if ((uint32_t) operation >= OWN_OPERATIONS_COUNT ||
+        OWN_NEVER_ON_HARDWARE == own_thresholds[operation] ||
+        dml_job_ptr->source_length > context_ptr->gen_cap.max_transfer_size ||
+        ((DML_OP_FILL == operation || DML_OP_CACHE_FLUSH == operation) &&
+         dml_job_ptr->destination_length > context_ptr->gen_cap.max_transfer_size) ||
+        ((DML_OP_DELTA_CREATE == operation || DML_OP_DELTA_APPLY == operation) &&
+         (DML_FLAG_DELTA_WIDE_RECORD & dml_job_ptr->flags)) ||
+        (DML_OP_DUALCAST == operation &&
+         ((((uintptr_t) dml_job_ptr->destination_first_ptr) ^ ((uintptr_t) dml_job_ptr->destination_second_ptr)) & 0xFFFu)) ||
+        (DML_OP_MEM_MOVE == operation &&
+         !context_ptr->gen_cap.overlapping_copy_support &&
+         own_are_overlapped(dml_job_ptr->source_first_ptr, dml_job_ptr->destination_first_ptr, dml_job_ptr->source_length)))
+    {
+        OWN_ATOMIC_INCREMENT(own_statistics.software_by_operation);
+        return DML_PATH_SW;
+    }
+
+    // Partial cache line writes make the device read the line first, so it pays off later
+    uint64_t threshold = OWN_ATOMIC_LOAD(own_thresholds[operation]);
+
+    if (((uintptr_t) dml_job_ptr->destination_first_ptr) & OWN_CACHE_LINE_MASK)
+    {
+        threshold *= 2u;
+    }
+
+    // Fill and Cache Flush have no source, their size is the destination length
+    const uint64_t transfer_size = (DML_OP_FILL == operation || DML_OP_CACHE_FLUSH == operation)
+                                   ? dml_job_ptr->destination_length
+                                   : dml_job_ptr->source_length;
+
+    if (transfer_size < threshold)
+    {
+        OWN_ATOMIC_INCREMENT(own_statistics.software_by_threshold);
+        return DML_PATH_SW;
+    }
+
+    uint32_t busy_score = OWN_ATOMIC_LOAD(own_busy_score);
+
+    while (busy_score >= OWN_BUSY_SCORE_THRESHOLD)
+    {
+        // Every job kept on CPU brings the next probe of the device closer
+        if (OWN_ATOMIC_CAS(own_busy_score, busy_score, busy_score - 1u))
+        {
+            OWN_ATOMIC_INCREMENT(own_statistics.software_busy_device);
+            return DML_PATH_SW;
+        }
+
+        busy_score = OWN_ATOMIC_LOAD(own_busy_score);
+    }
+
+    OWN_ATOMIC_INCREMENT(own_statistics.hardware);
+    return DML_PATH_HW;
+#else
+    (void) dml_job_ptr;
+    (void) hw_state_ptr;
+
+    OWN_ATOMIC_INCREMENT(own_statistics.software_no_device);
+    return DML_PATH_SW;
+#endif
+}
+
+
+OWN_FUN(void, auto_count_submission, (const dml_status_t status))
+{
+    uint32_t busy_score = OWN_ATOMIC_LOAD(own_busy_score);
+    uint32_t new_score  = 0u;
+
+    // Concurrent submissions update the score too, so the new one is only stored over the value it comes from
+    for (;;)
+    {
+        if (DML_STATUS_OK == status)
+        {
+            new_score = busy_score - (busy_score >> 3u);
+        }
+        else
+        {
+            new_score = busy_score + OWN_BUSY_SCORE_REJECTION;
+            new_score = (new_score > OWN_BUSY_SCORE_MAX) ? OWN_BUSY_SCORE_MAX : new_score;
+        }
+
+        if (new_score == busy_score || OWN_ATOMIC_CAS(own_busy_score, busy_score, new_score))
+        {
+            break;
+        }
+
+        busy_score = OWN_ATOMIC_LOAD(own_busy_score);
+    }
+
+    if (DML_STATUS_OK != status)
+    {
+        OWN_ATOMIC_INCREMENT(own_statistics.fallback_on_submit);
+    }
+}
+
+
+OWN_FUN(uint32_t, auto_fallback_on_error, (const dml_job_t *const dml_job_ptr, const dml_status_t status))
+{
+    // Other statuses are results of the operation itself, CPU would report the same
+    if (DML_STATUS_PAGE_FAULT_ERROR != status && DML_STATUS_INTERNAL_ERROR != status)
+    {
+        return 0u;
+    }
+
+    // Re-execution from the beginning is safe only if the operation hasn't changed own source
+    if (DML_OP_BATCH == dml_job_ptr->operation ||
+        (DML_OP_MEM_MOVE == dml_job_ptr->operation &&
+         own_are_overlapped(dml_job_ptr->source_first_ptr, dml_job_ptr->destination_first_ptr, dml_job_ptr->source_length)))
+    {
+        return 0u;
+    }
+
+    OWN_ATOMIC_INCREMENT(own_statistics.fallback_on_error);
+
+    return 1u;
+}
+
+
+DML_FUN(dml_status_t, dml_set_auto_path_threshold, (const dml_operation_t operation, const uint32_t threshold))
+{
+    DML_BAD_ARGUMENT_RETURN((uint32_t) operation >= OWN_OPERATIONS_COUNT, DML_STATUS_JOB_OPERATION_ERROR)
+
+    OWN_ATOMIC_STORE(own_thresholds[operation], threshold);
+
+    return DML_STATUS_OK;
+}
+
+
+DML_FUN(dml_status_t, dml_get_auto_path_statistics, (dml_auto_path_statistics_t *const statistics_ptr))
+{
+    DML_BAD_ARGUMENT_NULL_POINTER(statistics_ptr)
+
+    statistics_ptr->hardware              = OWN_ATOMIC_LOAD(own_statistics.hardware);
+    statistics_ptr->software_by_threshold = OWN_ATOMIC_LOAD(own_statistics.software_by_threshold);
+    statistics_ptr->software_by_operation = OWN_ATOMIC_LOAD(own_statistics.software_by_operation);
+    statistics_ptr->software_no_device    = OWN_ATOMIC_LOAD(own_statistics.software_no_device);
+    statistics_ptr->software_busy_device  = OWN_ATOMIC_LOAD(own_statistics.software_busy_device);
+    statistics_ptr->fallback_on_submit    = OWN_ATOMIC_LOAD(own_statistics.fallback_on_submit);
+    statistics_ptr->fallback_on_error     = OWN_ATOMIC_LOAD(own_statistics.fallback_on_error);
+
+    return DML_STATUS_OK;
+}
@@ -74,7 +74,7 @@ DML_FUN(dml_status_t, dml_batch_set_mem_move_by_index, (dml_job_t * dml_job_ptr,
                                                         uint32_t task_index,
                                                         uint8_t *source_ptr,
                                                         uint8_t *destination_ptr,
-                                                        uint32_t byte_length,
+                                                        uint64_t byte_length,
                                                         dml_operation_flags_t flags))
 {
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr)
@@ -102,7 +102,7 @@ DML_FUN(dml_status_t, dml_batch_set_dualcast_by_index, (dml_job_t * dml_job_ptr,
                                                         uint8_t *source_ptr,
                                                         uint8_t *destination_first_ptr,
                                                         uint8_t *destination_second_ptr,
-                                                        uint32_t byte_length,
+                                                        uint64_t byte_length,
                                                         dml_operation_flags_t flags))
 {
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr)
@@ -130,7 +130,7 @@ DML_FUN(dml_status_t, dml_batch_set_compare_by_index, (dml_job_t * dml_job_ptr,
                                                        uint32_t task_index,
                                                        uint8_t *source_first_ptr,
                                                        uint8_t *source_second_ptr,
-                                                       uint32_t byte_length,
+                                                       uint64_t byte_length,
                                                        dml_meta_result_t expected_result,
                                                        dml_operation_flags_t flags))
 {
@@ -158,7 +158,7 @@ DML_FUN(dml_status_t, dml_batch_set_compare_pattern_by_index, (dml_job_t * dml_j
                                                                uint32_t task_index,
                                                                uint8_t *source_ptr,
                                                                uint8_t *pattern_ptr,
-                                                               uint32_t byte_length,
+                                                               uint64_t byte_length,
                                                                dml_meta_result_t expected_result,
                                                                dml_operation_flags_t flags))
 {
@@ -190,7 +190,7 @@ DML_FUN(dml_status_t, dml_batch_set_compare_pattern_by_index, (dml_job_t * dml_j
 DML_FUN(dml_status_t, dml_batch_set_crc_by_index, (dml_job_t * dml_job_ptr,
                                                    uint32_t task_index,
                                                    uint8_t *source_ptr,
-                                                   uint32_t byte_length,
+                                                   uint64_t byte_length,
                                                    uint32_t *crc_seed_ptr,
                                                    dml_operation_flags_t flags))
 {
@@ -216,7 +216,7 @@ DML_FUN(dml_status_t, dml_batch_set_crc_by_index, (dml_job_t * dml_job_ptr,
 DML_FUN(dml_status_t, dml_batch_set_copy_crc_by_index, (dml_job_t * dml_job_ptr,
                                                         uint32_t task_index,
                                                         uint8_t *source_ptr,
-                                                        uint32_t byte_length,
+                                                        uint64_t byte_length,
                                                         uint32_t *crc_seed_ptr,
                                                         uint8_t *destination_ptr,
                                                         dml_operation_flags_t flags))
@@ -246,7 +246,7 @@ DML_FUN(dml_status_t, dml_batch_set_fill_by_index, (dml_job_t * dml_job_ptr,
                                                     uint32_t task_index,
                                                     const uint8_t *pattern_ptr,
                                                     uint8_t *destination_ptr,
-                                                    uint32_t byte_length,
+                                                    uint64_t byte_length,
                                                     dml_operation_flags_t flags))
 {
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr)
@@ -276,7 +276,7 @@ DML_FUN(dml_status_t, dml_batch_set_fill_by_index, (dml_job_t * dml_job_ptr,
 DML_FUN(dml_status_t, dml_batch_set_cache_flush_by_index, (dml_job_t * dml_job_ptr,
                                                            uint32_t task_index,
                                                            uint8_t *destination_ptr,
-                                                           uint32_t byte_length,
+                                                           uint64_t byte_length,
                                                            dml_operation_flags_t flags))
 {
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr)
@@ -300,9 +300,9 @@ DML_FUN(dml_status_t, dml_batch_set_delta_create_by_index, (dml_job_t * dml_job_
                                                             uint32_t task_index,
                                                             uint8_t *source_ptr,
                                                             uint8_t *reference_ptr,
-                                                            uint32_t compare_length,
+                                                            uint64_t compare_length,
                                                             uint8_t *delta_record_ptr,
-                                                            uint32_t delta_record_length,
+                                                            uint64_t delta_record_length,
                                                             dml_meta_result_t expected_result,
                                                             dml_operation_flags_t flags))
 {
@@ -332,9 +332,9 @@ DML_FUN(dml_status_t, dml_batch_set_delta_create_by_index, (dml_job_t * dml_job_
 DML_FUN(dml_status_t, dml_batch_set_delta_apply_by_index, (dml_job_t * dml_job_ptr,
                                                            uint32_t task_index,
                                                            uint8_t *delta_record_ptr,
-                                                           uint32_t delta_record_length,
+                                                           uint64_t delta_record_length,
                                                            uint8_t *destination_ptr,
-                                                           uint32_t destination_length,
+                                                           uint64_t destination_length,
                                                            dml_operation_flags_t flags))
 {
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr)
@@ -360,7 +360,7 @@ DML_FUN(dml_status_t, dml_batch_set_delta_apply_by_index, (dml_job_t * dml_job_p
 DML_FUN(dml_status_t, dml_batch_set_dif_check_by_index, (dml_job_t * dml_job_ptr,
                                                          uint32_t task_index,
                                                          uint8_t *source_ptr,
-                                                         uint32_t source_length,
+                                                         uint64_t source_length,
                                                          const dml_dif_config_t *dif_config_ptr,
                                                          dml_operation_flags_t flags))
 {
@@ -386,10 +386,10 @@ DML_FUN(dml_status_t, dml_batch_set_dif_check_by_index, (dml_job_t * dml_job_ptr
 DML_FUN(dml_status_t, dml_batch_set_dif_update_by_index, (dml_job_t * dml_job_ptr,
                                                           uint32_t task_index,
                                                           uint8_t *source_ptr,
-                                                          uint32_t source_length,
+                                                          uint64_t source_length,
                                                           const dml_dif_config_t *dif_config_ptr,
                                                           uint8_t *destination_ptr,
-                                                          uint32_t destination_length,
+                                                          uint64_t destination_length,
                                                           dml_operation_flags_t flags))
 {
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr)
@@ -417,10 +417,10 @@ DML_FUN(dml_status_t, dml_batch_set_dif_update_by_index, (dml_job_t * dml_job_pt
 DML_FUN(dml_status_t, dml_batch_set_dif_insert_by_index, (dml_job_t * dml_job_ptr,
                                                           uint32_t task_index,
                                                           uint8_t *source_ptr,
-                                                          uint32_t source_length,
+                                                          uint64_t source_length,
                                                           const dml_dif_config_t *dif_config_ptr,
                                                           uint8_t *destination_ptr,
-                                                          uint32_t destination_length,
+                                                          uint64_t destination_length,
                                                           dml_operation_flags_t flags))
 {
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr)
@@ -448,10 +448,10 @@ DML_FUN(dml_status_t, dml_batch_set_dif_insert_by_index, (dml_job_t * dml_job_pt
 DML_FUN(dml_status_t, dml_batch_set_dif_strip_by_index, (dml_job_t * dml_job_ptr,
                                                          uint32_t task_index,
                                                          uint8_t *source_ptr,
-                                                         uint32_t source_length,
+                                                         uint64_t source_length,
                                                          const dml_dif_config_t *dif_config_ptr,
                                                          uint8_t *destination_ptr,
-                                                         uint32_t destination_length,
+                                                         uint64_t destination_length,
                                                          dml_operation_flags_t flags))
 {
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr)
@@ -15,10 +15,11 @@
  */
 
 /**
- * @brief Contains an implementation of @ref dml_check_job
+ * @brief Contains an implementation of @ref dml_check_job and @ref dml_get_page_fault_statistics
  * @date 3/20/2020
  *
  */
+#include <string.h>
 #include "dml.h"
 #include "own_dml_api.h"
 #include "own_dml_batch.h"
@@ -29,6 +30,114 @@
 #endif
 
 
+#if defined(DML_HW)
+#define OWN_MAX_PAGE_FAULT_RESUMES 16u /**< The rest of a job is submitted with Block On Fault after this number of resumes */
+#define OWN_TRANSFER_SIZE_OFFSET   32u /**< Offset of the transfer size in a descriptor */
+
+/**
+ * @brief Resubmits the rest of a descriptor partially completed due to a page fault
+ *
+ * @note The completion record is left untouched on failure, so the caller reports the page fault as is
+ *
+ * @return @ref DML_STATUS_OK if the rest of the job is submitted
+ */
+OWN_FUN_INLINE(dml_status_t, hw_resume_job, (dml_job_t *const dml_job_ptr, own_dml_state_t *const state_ptr))
+{
+    dsahw_completion_record_t *result_ptr = state_ptr->hw_operation.result_ptr;
+    dsahw_descriptor_t *descriptor_ptr    = state_ptr->hw_operation.descriptor_ptr;
+    const dsahw_descriptor_t descriptor   = *descriptor_ptr;
+    const uint8_t record_status           = result_ptr->status;
+    uint32_t bytes_completed              = 0u;
+
+    dml_status_t status = dsa_resume_descriptor(descriptor_ptr,
+                                                result_ptr,
+                                                state_ptr->hw_resume_count + 1u >= OWN_MAX_PAGE_FAULT_RESUMES,
+                                                &bytes_completed);
+
+    if (DML_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    result_ptr->status = 0u;
+    status             = dsa_submit((dsahw_context_t *)state_ptr->hw_state_ptr, descriptor_ptr, dml_job_ptr->flags);
+
+    if (DML_STATUS_OK != status)
+    {
+        // Job is left as it was completed by hardware, so the next check makes the same attempt
+        *descriptor_ptr    = descriptor;
+        result_ptr->status = record_status;
+        return status;
+    }
+
+    state_ptr->hw_resumed_bytes += bytes_completed;
+    state_ptr->hw_resume_count++;
+    dsa_count_page_fault_resume(0u);
+
+    return DML_STATUS_OK;
+}
+
+/**
+ * @brief Submits the next part of a job split by @ref dml_submit_job after the current part is completed
+ *
+ * @return The following statuses:
+ *      - @ref DML_STATUS_OK if the next part is submitted;
+ *      - @ref DML_STATUS_BEING_PROCESSED if the device didn't accept it, the next check retries;
+ *      - other status if the job is over: no parts are left, or the current one failed or found a mismatch.
+ */
+OWN_FUN_INLINE(dml_status_t, hw_continue_job, (dml_job_t *const dml_job_ptr, own_dml_state_t *const state_ptr))
+{
+    dsahw_completion_record_t *result_ptr  = state_ptr->hw_operation.result_ptr;
+    dsahw_descriptor_t *descriptor_ptr     = state_ptr->hw_operation.descriptor_ptr;
+    const dsahw_descriptor_t descriptor    = *descriptor_ptr;
+    const dsahw_completion_record_t record = *result_ptr;
+    const dsahw_context_t *context_ptr     = (const dsahw_context_t *) state_ptr->hw_state_ptr;
+    uint32_t completed_bytes               = 0u;
+
+    if (0u == state_ptr->hw_left_bytes)
+    {
+        return DML_STATUS_JOB_LENGTH_ERROR;
+    }
+
+    memcpy(&completed_bytes, &descriptor.bytes[OWN_TRANSFER_SIZE_OFFSET], sizeof(completed_bytes));
+
+    const uint32_t part_max_length = context_ptr->gen_cap.max_transfer_size & ~(uint32_t) OWN_HW_PART_ALIGNMENT_MASK;
+    const uint32_t part_length     = (state_ptr->hw_left_bytes < part_max_length)
+                                     ? (uint32_t) state_ptr->hw_left_bytes
+                                     : part_max_length;
+
+    dml_status_t status = dsa_continue_descriptor(descriptor_ptr, result_ptr, part_length);
+
+    if (DML_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    // The record is cleared the same way as it's done by the descriptor initialization
+    for (uint32_t i = 0u; i < DSA_HW_COMPLETION_RECORD_SIZE; ++i)
+    {
+        ((uint8_t *) result_ptr)[i] = 0u;
+    }
+
+    status = dsa_submit((dsahw_context_t *)state_ptr->hw_state_ptr, descriptor_ptr, dml_job_ptr->flags);
+
+    if (DML_STATUS_OK != status)
+    {
+        // Job is left as the part was completed, so the next check makes the same attempt
+        *descriptor_ptr = descriptor;
+        *result_ptr     = record;
+        return DML_STATUS_BEING_PROCESSED;
+    }
+
+    state_ptr->hw_resumed_bytes += completed_bytes;
+    state_ptr->hw_left_bytes    -= part_length;
+    state_ptr->hw_resume_count   = 0u;
+
+    return DML_STATUS_OK;
+}
+#endif
+
+
 DML_FUN(dml_status_t, dml_check_job, (dml_job_t *const dml_job_ptr))
 {
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr)
@@ -37,16 +146,61 @@ DML_FUN(dml_status_t, dml_check_job, (dml_job_t *const dml_job_ptr))
     dml_status_t status        = DML_STATUS_OK;
 
 #if defined(DML_HW)
-    if (DML_PATH_HW == state_ptr->active_path)
+    if (DML_PATH_HW == state_ptr->submitted_path)
     {
         if (0u == state_ptr->hw_operation.result_ptr->status)
         {
             return DML_STATUS_BEING_PROCESSED;
         }
 
-        return idml_hw_get_operation_result(state_ptr->hw_operation.result_ptr, state_ptr->hw_batch_buffers.results_ptr, dml_job_ptr);
+        if (DML_STATUS_OK == idml_hw_resume_job(dml_job_ptr, state_ptr))
+        {
+            return DML_STATUS_BEING_PROCESSED;
+        }
+
+        status = idml_hw_continue_job(dml_job_ptr, state_ptr);
+
+        if (DML_STATUS_OK == status || DML_STATUS_BEING_PROCESSED == status)
+        {
+            return DML_STATUS_BEING_PROCESSED;
+        }
+
+        status = idml_hw_get_operation_result(state_ptr->hw_operation.result_ptr, state_ptr->hw_batch_buffers.results_ptr, dml_job_ptr);
+
+        // Offsets reported by hardware are relative to the resumed descriptor
+        if ((DML_STATUS_OK != status && DML_STATUS_FALSE_PREDICATE_OK != status) ||
+            ((DML_OP_COMPARE == dml_job_ptr->operation || DML_OP_COMPARE_PATTERN == dml_job_ptr->operation) &&
+             0u != dml_job_ptr->result))
+        {
+            dml_job_ptr->offset += state_ptr->hw_resumed_bytes;
+        }
+
+        if (DML_PATH_AUTO == state_ptr->active_path && idml_auto_fallback_on_error(dml_job_ptr, status))
+        {
+            // Hardware results are dropped, software path reports own ones
+            dml_job_ptr->offset       = 0u;
+            dml_job_ptr->result       = 0u;
+            state_ptr->submitted_path = DML_PATH_SW;
+
+            status = idml_sw_submit_job(dml_job_ptr);
+        }
     }
 #endif
 
     return status;
 }
+
+
+DML_FUN(dml_status_t, dml_get_page_fault_statistics, (dml_page_fault_statistics_t *const statistics_ptr))
+{
+    DML_BAD_ARGUMENT_NULL_POINTER(statistics_ptr)
+
+#if defined(DML_HW)
+    dsa_get_page_fault_statistics(statistics_ptr);
+#else
+    statistics_ptr->resumed_on_hardware = 0u;
+    statistics_ptr->completed_on_cpu    = 0u;
+#endif
+
+    return DML_STATUS_OK;
+}
@@ -0,0 +1,255 @@
+/*
+ * Copyright 2020-2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @brief Contains an implementation of the completion queue functions:
+ *      - @ref dml_get_completion_queue_size()
+ *      - @ref dml_init_completion_queue()
+ *      - @ref dml_register_job()
+ *      - @ref dml_poll_completion_queue()
+ *      - @ref dml_wait_completion_queue()
+ * @date 10/18/2026
+ *
+ */
+#include <time.h>
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#else
+    #include <x86intrin.h>
+#endif
+
+#include "dml.h"
+#include "own_dml_api.h"
+#include "own_dml_align.h"
+#include "own_dml_internal_state.h"
+
+
+#define OWN_PREFETCH_DISTANCE   8u              /**< Number of entries the record prefetch goes ahead of the scan */
+#define OWN_NANOSECONDS_IN_SEC  1000000000ull
+
+
+/**
+ * @brief Registered job, it's read for finished jobs only
+ */
+typedef struct
+{
+    dml_job_t                 *job_ptr;       /**< Registered job                      */
+    dml_completion_callback_t callback;       /**< Function called for the finished job */
+    void                      *user_data_ptr; /**< Pointer reported with the job        */
+} own_completion_entry_t;
+
+
+/**
+ * @brief Status byte of jobs executed by the software path, it reads as finished
+ */
+static const volatile uint8_t own_finished_status = 1u;
+
+
+/**
+ * @brief Layout of the queue internal memory: status pointers are scanned by poll, so they are kept apart
+ */
+static inline const volatile uint8_t **own_get_status_ptrs(const dml_completion_queue_t *const queue_ptr)
+{
+    return (const volatile uint8_t **) queue_ptr->internal_data_ptr;
+}
+
+static inline own_completion_entry_t *own_get_entries(const dml_completion_queue_t *const queue_ptr)
+{
+    return (own_completion_entry_t *) (queue_ptr->internal_data_ptr +
+                                       DML_ALIGNED_SIZE(queue_ptr->capacity * sizeof(uint8_t *), DML_DEFAULT_ALIGNMENT));
+}
+
+/**
+ * @brief Callbacks of the jobs reported by a poll, they are called after the queue is compacted
+ */
+static inline dml_completion_callback_t *own_get_callbacks(const dml_completion_queue_t *const queue_ptr)
+{
+    return (dml_completion_callback_t *) (((uint8_t *) own_get_entries(queue_ptr)) +
+                                          DML_ALIGNED_SIZE(queue_ptr->capacity * sizeof(own_completion_entry_t),
+                                                           DML_DEFAULT_ALIGNMENT));
+}
+
+
+static inline uint64_t own_get_time_ns(void)
+{
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+
+    return (uint64_t) now.tv_sec * OWN_NANOSECONDS_IN_SEC + (uint64_t) now.tv_nsec;
+}
+
+
+DML_FUN(dml_status_t, dml_get_completion_queue_size, (const uint32_t capacity, uint32_t *const size_ptr))
+{
+    DML_BAD_ARGUMENT_NULL_POINTER(size_ptr)
+
+    uint32_t queue_size = 0u;
+
+    queue_size += DML_ALIGNED_SIZE(sizeof(dml_completion_queue_t), DML_DEFAULT_ALIGNMENT) + DML_DEFAULT_ALIGNMENT;
+    queue_size += DML_ALIGNED_SIZE(capacity * sizeof(uint8_t *), DML_DEFAULT_ALIGNMENT);
+    queue_size += DML_ALIGNED_SIZE(capacity * sizeof(own_completion_entry_t), DML_DEFAULT_ALIGNMENT);
+    queue_size += DML_ALIGNED_SIZE(capacity * sizeof(dml_completion_callback_t), DML_DEFAULT_ALIGNMENT);
+
+    *size_ptr = queue_size;
+
+    return DML_STATUS_OK;
+}
+
+
+DML_FUN(dml_status_t, dml_init_completion_queue, (const uint32_t capacity, dml_completion_queue_t *const queue_ptr))
+{
+    DML_BAD_ARGUMENT_NULL_POINTER(queue_ptr)
+
+    // Need to consider internal_data_ptr offset
+    const uint32_t unused_space = DML_BYTES_TO_ALIGN(((uint8_t *) queue_ptr) + sizeof(dml_completion_queue_t),
+                                                     DML_DEFAULT_ALIGNMENT);
+
+    queue_ptr->capacity          = capacity;
+    queue_ptr->count             = 0u;
+    queue_ptr->internal_data_ptr = ((uint8_t *) queue_ptr) + sizeof(dml_completion_queue_t) + unused_space;
+
+    return DML_STATUS_OK;
+}
+
+
+DML_FUN(dml_status_t, dml_register_job, (dml_completion_queue_t *const queue_ptr,
+                                         dml_job_t *const dml_job_ptr,
+                                         dml_completion_callback_t callback,
+                                         void *user_data_ptr))
+{
+    DML_BAD_ARGUMENT_NULL_POINTER(queue_ptr)
+    DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr)
+    DML_BAD_ARGUMENT_RETURN(queue_ptr->count >= queue_ptr->capacity, DML_STATUS_COMPLETION_QUEUE_FULL)
+
+    const volatile uint8_t *status_ptr = &own_finished_status;
+
+#if defined(DML_HW)
+    own_dml_state_t *state_ptr = OWN_GET_JOB_STATE_PTR(dml_job_ptr);
+
+    if (DML_PATH_HW == state_ptr->submitted_path)
+    {
+        status_ptr = &state_ptr->hw_operation.result_ptr->status;
+    }
+#endif
+
+    own_completion_entry_t *entry_ptr = &own_get_entries(queue_ptr)[queue_ptr->count];
+
+    entry_ptr->job_ptr       = dml_job_ptr;
+    entry_ptr->callback      = callback;
+    entry_ptr->user_data_ptr = user_data_ptr;
+
+    own_get_status_ptrs(queue_ptr)[queue_ptr->count] = status_ptr;
+    queue_ptr->count++;
+
+    return DML_STATUS_OK;
+}
+
+
+DML_FUN(dml_status_t, dml_poll_completion_queue, (dml_completion_queue_t *const queue_ptr,
+                                                  dml_completion_t *const completions_ptr,
+                                                  const uint32_t max_count,
+                                                  uint32_t *const count_ptr))
+{
+    DML_BAD_ARGUMENT_NULL_POINTER(queue_ptr)
+    DML_BAD_ARGUMENT_NULL_POINTER(completions_ptr)
+    DML_BAD_ARGUMENT_NULL_POINTER(count_ptr)
+
+    const volatile uint8_t **status_ptrs = own_get_status_ptrs(queue_ptr);
+    own_completion_entry_t *entries_ptr  = own_get_entries(queue_ptr);
+    dml_completion_callback_t *callbacks = own_get_callbacks(queue_ptr);
+    const uint32_t count                 = queue_ptr->count;
+    uint32_t reported                    = 0u;
+    uint32_t kept                        = 0u;
+
+    for (uint32_t i = 0u; i < count; ++i)
+    {
+        if (i + OWN_PREFETCH_DISTANCE < count)
+        {
+            _mm_prefetch((const char *) status_ptrs[i + OWN_PREFETCH_DISTANCE], _MM_HINT_T0);
+        }
+
+        // The job is checked only when the device has written its record, resumed jobs stay in the queue
+        if (reported < max_count && 0u != *status_ptrs[i])
+        {
+            const dml_status_t status = dml_check_job(entries_ptr[i].job_ptr);
+
+            if (DML_STATUS_BEING_PROCESSED != status)
+            {
+                dml_completion_t *completion_ptr = &completions_ptr[reported];
+
+                completion_ptr->job_ptr       = entries_ptr[i].job_ptr;
+                completion_ptr->user_data_ptr = entries_ptr[i].user_data_ptr;
+                completion_ptr->status        = status;
+                callbacks[reported++]         = entries_ptr[i].callback;
+
+                continue;
+            }
+        }
+
+        // Unfinished jobs are moved to the front, keeping their order
+        if (kept != i)
+        {
+            status_ptrs[kept] = status_ptrs[i];
+            entries_ptr[kept] = entries_ptr[i];
+        }
+
+        kept++;
+    }
+
+    // Places of the reported jobs are freed before the callbacks, so they can register new jobs in a full queue
+    queue_ptr->count = kept;
+    *count_ptr       = reported;
+
+    for (uint32_t i = 0u; i < reported; ++i)
+    {
+        if (NULL != callbacks[i])
+        {
+            callbacks[i](&completions_ptr[i]);
+        }
+    }
+
+    return DML_STATUS_OK;
+}
+
+
+DML_FUN(dml_status_t, dml_wait_completion_queue, (dml_completion_queue_t *const queue_ptr,
+                                                  dml_completion_t *const completions_ptr,
+                                                  const uint32_t max_count,
+                                                  uint32_t *const count_ptr,
+                                                  const uint64_t timeout_ns))
+{
+    DML_BAD_ARGUMENT_NULL_POINTER(queue_ptr)
+    DML_BAD_ARGUMENT_NULL_POINTER(count_ptr)
+
+    const uint64_t start_ns = own_get_time_ns();
+
+    while (1)
+    {
+        const dml_status_t status = dml_poll_completion_queue(queue_ptr, completions_ptr, max_count, count_ptr);
+
+        if (DML_STATUS_OK != status || 0u != *count_ptr || 0u == queue_ptr->count || 0u == max_count)
+        {
+            return status;
+        }
+
+        if (own_get_time_ns() - start_ns >= timeout_ns)
+        {
+            return DML_STATUS_BEING_PROCESSED;
+        }
+
+        _mm_pause();
+    }
+}
@@ -31,7 +31,7 @@ DML_FUN(dml_status_t, dml_execute_job, (dml_job_t *const dml_job_ptr))
     DML_RETURN_IN_CASE_OF_ERROR(status)
 
 #if defined(DML_HW)
-    if (DML_PATH_HW == OWN_GET_JOB_STATE_PTR(dml_job_ptr)->active_path)
+    if (DML_PATH_HW == OWN_GET_JOB_STATE_PTR(dml_job_ptr)->submitted_path)
     {
         status = dml_wait_job(dml_job_ptr);
     }
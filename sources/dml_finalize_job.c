@@ -36,7 +36,7 @@ DML_FUN(dml_status_t, dml_finalize_job, (dml_job_t *const dml_job_ptr))
 
     // Free resources in case if hardware path used
 #if defined(DML_HW)
-    if (DML_PATH_SW != state->active_path)
+    if (DML_PATH_SW != state->active_path && NULL != state->hw_state_ptr)
     {
         status = dsa_finalize((dsahw_context_t *)&(state->hw_state_ptr));
     }
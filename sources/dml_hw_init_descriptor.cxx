@@ -28,6 +28,7 @@
  * @param[out] descriptor_ptr  pointer to @ref dsa_descriptor_t
  *
  * @return The following statuses:
+ *      - @ref DML_STATUS_JOB_LENGTH_ERROR if a length doesn't fit the descriptor
  * @todo add return statuses
  *
  */
@@ -36,6 +37,18 @@ OWN_FUN_INLINE(dml_status_t, hw_init_descriptor, (dml_job_t *dml_job_ptr,
                                                   own_dml_hw_batch_buffer_t *batch_bundle_ptr,
                                                   dsahw_descriptor_t *descriptor_ptr))
 {
+    // Descriptors have 32-bit sizes, longer jobs are executed by the software path
+    const uint32_t is_destination_sized = (DML_OP_FILL == dml_job_ptr->operation) ||
+                                          (DML_OP_CACHE_FLUSH == dml_job_ptr->operation) ||
+                                          (DML_OP_DELTA_CREATE == dml_job_ptr->operation) ||
+                                          (DML_OP_DELTA_APPLY == dml_job_ptr->operation);
+
+    if ((UINT32_MAX < dml_job_ptr->source_length) ||
+        (is_destination_sized && (UINT32_MAX < dml_job_ptr->destination_length)))
+    {
+        return DML_STATUS_JOB_LENGTH_ERROR;
+    }
+
     switch (dml_job_ptr->operation)
     {
         case DML_OP_MEM_MOVE:
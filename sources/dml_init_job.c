@@ -58,7 +58,7 @@ DML_FUN(dml_status_t, dml_init_job, (const dml_path_t path, dml_job_t *const dml
                                     + ((path != DML_PATH_HW) ? software_state_size : 0u)
                                     + ((path != DML_PATH_SW) ? hardware_state_size : 0u)
 #if defined (DML_HW)
-                                    + (DML_PATH_HW == path) ? (OWN_HW_INTERNAL_BUFFERS_SIZE) : (0u)
+                                    + ((path != DML_PATH_SW) ? OWN_HW_INTERNAL_BUFFERS_SIZE : 0u)
 #endif
 ;
 
@@ -84,7 +84,8 @@ DML_FUN(dml_status_t, dml_init_job, (const dml_path_t path, dml_job_t *const dml
 #endif
 
     // Save active path
-    state_ptr->active_path  = path;
+    state_ptr->active_path    = path;
+    state_ptr->submitted_path = (DML_PATH_HW == path) ? DML_PATH_HW : DML_PATH_SW;
 
     // Init for internal path states only
     switch (path)
@@ -94,8 +95,13 @@ DML_FUN(dml_status_t, dml_init_job, (const dml_path_t path, dml_job_t *const dml
             status = dsa_get_context((dsahw_context_t **)&(state_ptr->hw_state_ptr));
             break;
 
-        case DML_PATH_SW:
         case DML_PATH_AUTO:
+            // Hardware is optional here, jobs are executed on CPU without it
+            state_ptr->hw_state_ptr = idml_auto_get_hw_context();
+            status                  = idml_sw_init(state_ptr->sw_state_ptr);
+            break;
+
+        case DML_PATH_SW:
 #endif
         default:
             status = idml_sw_init(state_ptr->sw_state_ptr);
@@ -28,6 +28,96 @@
 #endif
 
 
+#if defined(DML_HW)
+/**
+ * @brief Limits a job to the first part a descriptor accepts, the rest is submitted by @ref dml_check_job
+ *
+ * @param[in,out] part_ptr   copy of the job, its length is reduced to the first part
+ * @param[in]     state_ptr  state of the job
+ *
+ * @return Number of bytes left for the next parts, 0 if the job isn't split
+ */
+OWN_FUN_INLINE(uint64_t, hw_split_job, (dml_job_t *const part_ptr, const own_dml_state_t *const state_ptr))
+{
+    const dsahw_context_t *context_ptr = (const dsahw_context_t *) state_ptr->hw_state_ptr;
+    uint64_t *length_ptr               = &part_ptr->source_length;
+
+    switch (part_ptr->operation)
+    {
+        case DML_OP_FILL:
+        case DML_OP_CACHE_FLUSH:
+            length_ptr = &part_ptr->destination_length;
+            break;
+
+        case DML_OP_MEM_MOVE:
+            // Forward parts would overwrite the source of the next ones
+            if ((part_ptr->destination_first_ptr > part_ptr->source_first_ptr) &&
+                (part_ptr->destination_first_ptr < part_ptr->source_first_ptr + part_ptr->source_length))
+            {
+                return 0u;
+            }
+            break;
+
+        case DML_OP_COMPARE:
+        case DML_OP_COMPARE_PATTERN:
+        case DML_OP_DUALCAST:
+        case DML_OP_CRC:
+        case DML_OP_COPY_CRC:
+            break;
+
+        default:
+            return 0u;
+    }
+
+    const uint64_t part_length = context_ptr->gen_cap.max_transfer_size & ~(uint64_t) OWN_HW_PART_ALIGNMENT_MASK;
+
+    if ((0u == part_length) || (*length_ptr <= part_length))
+    {
+        return 0u;
+    }
+
+    const uint64_t remaining_bytes = *length_ptr - part_length;
+    *length_ptr                    = part_length;
+
+    return remaining_bytes;
+}
+
+/**
+ * @brief Builds hardware descriptor for the job and submits it
+ *
+ * Jobs longer than the device maximal transfer size are split into parts, which are submitted one by one
+ */
+OWN_FUN_INLINE(dml_status_t, hw_submit_job, (dml_job_t *const dml_job_ptr, own_dml_state_t *const state_ptr))
+{
+    dml_status_t status                         = DML_STATUS_OK;
+    dsahw_completion_record_t *result_ptr       = state_ptr->hw_operation.result_ptr;
+    dsahw_descriptor_t *descriptor_ptr          = state_ptr->hw_operation.descriptor_ptr;
+    own_dml_hw_batch_buffer_t *batch_buffer_ptr = &state_ptr->hw_batch_buffers;
+    dml_job_t first_part                        = *dml_job_ptr;
+
+    const uint64_t remaining_bytes = idml_hw_split_job(&first_part, state_ptr);
+
+    status = idml_hw_init_descriptor(&first_part,
+                                     result_ptr,
+                                     batch_buffer_ptr,
+                                     descriptor_ptr);
+
+    if (DML_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    // Page faults are resolved by dml_check_job, so the device isn't blocked while the page is brought in
+    dsa_allow_page_faults(descriptor_ptr);
+    state_ptr->hw_resumed_bytes = 0u;
+    state_ptr->hw_resume_count  = 0u;
+    state_ptr->hw_left_bytes    = remaining_bytes;
+
+    return dsa_submit((dsahw_context_t *)state_ptr->hw_state_ptr, descriptor_ptr, dml_job_ptr->flags);
+}
+#endif
+
+
 DML_FUN(dml_status_t, dml_submit_job, (dml_job_t *const dml_job_ptr))
 {
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr)
@@ -36,30 +126,34 @@ DML_FUN(dml_status_t, dml_submit_job, (dml_job_t *const dml_job_ptr))
 
     switch (state_ptr->active_path)
     {
-    #if defined(DML_HW)
-        case DML_PATH_HW:
+        case DML_PATH_AUTO:
         {
-            dml_status_t status                         = DML_STATUS_OK;
-            dsahw_completion_record_t *result_ptr       = state_ptr->hw_operation.result_ptr;
-            dsahw_descriptor_t *descriptor_ptr          = state_ptr->hw_operation.descriptor_ptr;
-            own_dml_hw_batch_buffer_t *batch_buffer_ptr = &state_ptr->hw_batch_buffers;
+            if (DML_PATH_HW == idml_auto_select_path(dml_job_ptr, state_ptr->hw_state_ptr))
+            {
+    #if defined(DML_HW)
+                const dml_status_t status = idml_hw_submit_job(dml_job_ptr, state_ptr);
 
-            status = idml_hw_init_descriptor(dml_job_ptr,
-                                             result_ptr,
-                                             batch_buffer_ptr,
-                                             descriptor_ptr);
+                idml_auto_count_submission(status);
 
-            if (DML_STATUS_OK != status)
-            {
-                return status;
+                if (DML_STATUS_OK == status)
+                {
+                    state_ptr->submitted_path = DML_PATH_HW;
+                    return status;
+                }
+    #endif
             }
 
-            return dsa_submit((dsahw_context_t *)state_ptr->hw_state_ptr, descriptor_ptr, dml_job_ptr->flags);
+            // Rejected by hardware jobs go here too
+            state_ptr->submitted_path = DML_PATH_SW;
+            return idml_sw_submit_job(dml_job_ptr);
         }
 
-        case DML_PATH_SW:
-        case DML_PATH_AUTO:
+    #if defined(DML_HW)
+        case DML_PATH_HW:
+            return idml_hw_submit_job(dml_job_ptr, state_ptr);
     #endif
+
+        case DML_PATH_SW:
         default:
             return idml_sw_submit_job(dml_job_ptr);
     }
@@ -32,7 +32,7 @@ DML_FUN(dml_status_t, dml_wait_job, (dml_job_t *const dml_job_ptr))
     dml_status_t status = DML_STATUS_OK;
 
 #if defined(DML_HW)
-    if (DML_PATH_HW == OWN_GET_JOB_STATE_PTR(dml_job_ptr)->active_path)
+    if (DML_PATH_HW == OWN_GET_JOB_STATE_PTR(dml_job_ptr)->submitted_path)
     {
         do
         {
@@ -83,6 +83,24 @@ dml_status_t DML_HW_API(finalize)(dsahw_context_t *hw_context_ptr);
 int DML_HW_API(get_overlapping_copy_support)(dsahw_context_t *hw_context_ptr);
 
 
+/**
+ * @brief Counts a descriptor resumed after a page fault
+ *
+ * @param[in] on_cpu    non-zero if the rest of the job was completed with software path
+ *
+ */
+void DML_HW_API(count_page_fault_resume)(uint32_t on_cpu);
+
+
+/**
+ * @brief Returns counters of descriptors resumed after page faults
+ *
+ * @param[out] statistics_ptr    pointer to @ref dml_page_fault_statistics_t to fill
+ *
+ */
+void DML_HW_API(get_page_fault_statistics)(dml_page_fault_statistics_t *statistics_ptr);
+
+
 #ifdef __cplusplus
 }
 #endif
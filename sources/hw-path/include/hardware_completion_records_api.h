@@ -51,7 +51,7 @@ extern "C" {
  */
 dsahw_status_t DML_HW_API(get_mem_move_result)(const dsahw_completion_record_t *completion_record_ptr,
                                                dml_meta_result_t *result_ptr,
-                                               uint32_t *elements_processed_ptr);
+                                               uint64_t *elements_processed_ptr);
 
 
 /**
@@ -68,7 +68,7 @@ dsahw_status_t DML_HW_API(get_mem_move_result)(const dsahw_completion_record_t *
  *
  */
 dsahw_status_t DML_HW_API(get_fill_result)(const dsahw_completion_record_t *completion_record_ptr,
-                                           uint32_t *elements_processed_ptr);
+                                           uint64_t *elements_processed_ptr);
 
 
 /**
@@ -89,7 +89,7 @@ dsahw_status_t DML_HW_API(get_fill_result)(const dsahw_completion_record_t *comp
  */
 dsahw_status_t DML_HW_API(get_compare_result)(const dsahw_completion_record_t *completion_record_ptr,
                                               dml_meta_result_t *result_ptr,
-                                              uint32_t *elements_processed_ptr);
+                                              uint64_t *elements_processed_ptr);
 
 
 /**
@@ -114,9 +114,9 @@ dsahw_status_t DML_HW_API(get_compare_result)(const dsahw_completion_record_t *c
  */
 dsahw_status_t DML_HW_API(get_delta_create_result)(const dsahw_completion_record_t *completion_record_ptr,
                                                    const uint8_t *destination_ptr,
-                                                   uint32_t *delta_record_length_ptr,
+                                                   uint64_t *delta_record_length_ptr,
                                                    dml_meta_result_t *result_ptr,
-                                                   uint32_t *elements_processed_ptr);
+                                                   uint64_t *elements_processed_ptr);
 
 
 /**
@@ -136,7 +136,7 @@ dsahw_status_t DML_HW_API(get_delta_create_result)(const dsahw_completion_record
  *
  */
 dsahw_status_t DML_HW_API(get_delta_apply_result)(const dsahw_completion_record_t *completion_record_ptr,
-                                                  uint32_t *elements_processed_ptr);
+                                                  uint64_t *elements_processed_ptr);
 
 
 /**
@@ -155,7 +155,7 @@ dsahw_status_t DML_HW_API(get_delta_apply_result)(const dsahw_completion_record_
  *
  */
 dsahw_status_t DML_HW_API(get_dualcast_result)(const dsahw_completion_record_t *completion_record_ptr,
-                                               uint32_t *elements_processed_ptr);
+                                               uint64_t *elements_processed_ptr);
 
 
 /**
@@ -175,7 +175,7 @@ dsahw_status_t DML_HW_API(get_dualcast_result)(const dsahw_completion_record_t *
  */
 dsahw_status_t DML_HW_API(get_crc_result)(const dsahw_completion_record_t *completion_record_ptr,
                                           uint32_t *crc_result_ptr,
-                                          uint32_t *elements_processed_ptr);
+                                          uint64_t *elements_processed_ptr);
 
 
 /**
@@ -196,7 +196,7 @@ dsahw_status_t DML_HW_API(get_crc_result)(const dsahw_completion_record_t *compl
  */
 dsahw_status_t DML_HW_API(get_crc_copy_result)(const dsahw_completion_record_t *completion_record_ptr,
                                                uint32_t *crc_result_ptr,
-                                               uint32_t *elements_processed_ptr);
+                                               uint64_t *elements_processed_ptr);
 
 
 /**
@@ -213,7 +213,7 @@ dsahw_status_t DML_HW_API(get_crc_copy_result)(const dsahw_completion_record_t *
  *
  */
 dsahw_status_t DML_HW_API(get_cache_flush_result)(const dsahw_completion_record_t *completion_record_ptr,
-                                                  uint32_t *elements_processed_ptr);
+                                                  uint64_t *elements_processed_ptr);
 
 
 /**
@@ -235,7 +235,7 @@ dsahw_status_t DML_HW_API(get_cache_flush_result)(const dsahw_completion_record_
 dsahw_status_t DML_HW_API(get_check_dif_result)(const dsahw_completion_record_t *completion_record_ptr,
                                                 dml_meta_result_t *result_ptr,
                                                 dml_dif_config_t *dif_config_ptr,
-                                                uint32_t *elements_processed_ptr);
+                                                uint64_t *elements_processed_ptr);
 
 /**
  * @brief Extracts operation results from @ref dsahw_completion_record_t
@@ -255,7 +255,7 @@ dsahw_status_t DML_HW_API(get_check_dif_result)(const dsahw_completion_record_t
  */
 dsahw_status_t DML_HW_API(get_insert_dif_result)(const dsahw_completion_record_t *completion_record_ptr,
                                                  dml_dif_config_t *dif_config_ptr,
-                                                 uint32_t *elements_processed_ptr);
+                                                 uint64_t *elements_processed_ptr);
 
 
 /**
@@ -276,7 +276,7 @@ dsahw_status_t DML_HW_API(get_insert_dif_result)(const dsahw_completion_record_t
  */
 dsahw_status_t DML_HW_API(get_strip_dif_result)(const dsahw_completion_record_t *completion_record_ptr,
                                                 dml_dif_config_t *dif_config_ptr,
-                                                uint32_t *elements_processed_ptr);
+                                                uint64_t *elements_processed_ptr);
 
 
 /**
@@ -299,7 +299,7 @@ dsahw_status_t DML_HW_API(get_strip_dif_result)(const dsahw_completion_record_t
 dsahw_status_t DML_HW_API(get_update_dif_result)(const dsahw_completion_record_t *completion_record_ptr,
                                                  dml_dif_config_t *dif_config_ptr,
                                                  dml_meta_result_t *result_ptr,
-                                                 uint32_t *elements_processed_ptr);
+                                                 uint64_t *elements_processed_ptr);
 
 
 /**
@@ -330,7 +330,7 @@ dsahw_status_t DML_HW_API(get_nop_result)(const dsahw_completion_record_t *compl
  *
  */
 dsahw_status_t DML_HW_API(get_batch_result)(const dsahw_completion_record_t *completion_record_ptr,
-                                            uint32_t *descriptors_processed_ptr);
+                                            uint64_t *descriptors_processed_ptr);
 
 
 /**
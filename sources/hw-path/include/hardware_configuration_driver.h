@@ -61,6 +61,17 @@ dsahw_status_t DML_HW_API(initialize_accelerator_driver)(hw_driver_t *driver_ptr
 
 void DML_HW_API(finalize_accelerator_driver)(hw_driver_t *driver_ptr);
 
+#if defined(DML_HW_EMULATOR)
+/**
+ * @brief Returns emulated implementation of accelerator configuration library function
+ *
+ * @param[in] function_name name of the function in the library
+ *
+ * @return function address or NULL if the function is not emulated
+ */
+library_function DML_HW_API(emulator_get_function)(const char *function_name);
+#endif
+
 int32_t DML_HW_API(driver_new_context)(struct accfg_ctx **ctx);
 
 struct accfg_device *DML_HW_API(context_get_first_device)(struct accfg_ctx *ctx);
@@ -91,6 +102,8 @@ enum accfg_wq_state DML_HW_API(work_queue_get_state)(struct accfg_wq *wq);
 
 enum accfg_wq_mode DML_HW_API(work_queue_get_mode)(struct accfg_wq *wq);
 
+uint32_t DML_HW_API(work_queue_get_size)(struct accfg_wq *wq);
+
 struct accfg_group *DML_HW_API(group_get_first)(struct accfg_device *device);
 
 struct accfg_group *DML_HW_API(group_get_next)(struct accfg_group *group);
@@ -416,6 +416,82 @@ dsahw_status_t DML_HW_API(init_drain_descriptor)(dsahw_descriptor_t *descriptor_
                                                  dml_operation_flags_t flags,
                                                  dsahw_completion_record_t *result_ptr);
 
+/**
+ * @brief Checks if a descriptor can be resumed after partial completion caused by a page fault
+ *
+ * @param[in] descriptor_ptr  pointer to @ref dsahw_descriptor_t
+ *
+ * @return Non-zero for Memory Move, Fill, Compare, Compare Pattern, Dualcast, CRC, Copy with CRC and Cache Flush
+ */
+int DML_HW_API(is_resumable_descriptor)(const dsahw_descriptor_t *descriptor_ptr);
+
+/**
+ * @brief Clears Block On Fault flag of a resumable descriptor, other descriptors are left as is
+ *
+ * @note Hardware reports a page fault as partial completion then, see @ref dsa_resume_descriptor()
+ *
+ * @param[in,out] descriptor_ptr  pointer to @ref dsahw_descriptor_t
+ */
+void DML_HW_API(allow_page_faults)(dsahw_descriptor_t *descriptor_ptr);
+
+/**
+ * @brief Turns a resumable descriptor into the descriptor for its part starting at the given offset
+ *
+ * @details Addresses are advanced and patterns are rotated by the number of skipped bytes,
+ *          transfer size is reduced by it. CRC seed fields are left as is.
+ *
+ * @param[in,out] descriptor_ptr  pointer to a resumable @ref dsahw_descriptor_t
+ * @param[in]     bytes           number of bytes to skip, not greater than the transfer size
+ *
+ * @return The following statuses:
+ *      - @ref DML_STATUS_OK;
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR;
+ *      - @ref DML_STATUS_PAGE_FAULT_ERROR if the descriptor isn't resumable or bytes exceed the transfer size.
+ */
+dsahw_status_t DML_HW_API(advance_descriptor)(dsahw_descriptor_t *descriptor_ptr, uint32_t bytes);
+
+/**
+ * @brief Turns a descriptor partially completed due to a page fault into the descriptor for the rest of the job
+ *
+ * @details Addresses are advanced and transfer size is reduced by the number of completed bytes,
+ *          CRC seed is replaced with the CRC of the processed part. The faulted page is touched,
+ *          so the resubmitted descriptor normally doesn't stop on it again.
+ *
+ * @param[in,out] descriptor_ptr         pointer to the executed @ref dsahw_descriptor_t
+ * @param[in]     completion_record_ptr  pointer to its completion record
+ * @param[in]     block_on_fault         non-zero to set Block On Fault flag for the rest of the job
+ * @param[out]    bytes_completed_ptr    number of bytes processed before the fault
+ *
+ * @return The following statuses:
+ *      - @ref DML_STATUS_OK;
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR;
+ *      - @ref DML_STATUS_PAGE_FAULT_ERROR if the record doesn't report partial completion or descriptor isn't resumable.
+ */
+dsahw_status_t DML_HW_API(resume_descriptor)(dsahw_descriptor_t *descriptor_ptr,
+                                             const dsahw_completion_record_t *completion_record_ptr,
+                                             uint32_t block_on_fault,
+                                             uint32_t *bytes_completed_ptr);
+
+/**
+ * @brief Turns a successfully completed descriptor into the descriptor for the next part of a longer job
+ *
+ * @details Addresses are advanced by the transfer size of the completed descriptor, patterns are rotated,
+ *          CRC seed is replaced with the CRC of the processed part. Page faults are allowed again.
+ *
+ * @param[in,out] descriptor_ptr         pointer to the executed resumable @ref dsahw_descriptor_t
+ * @param[in]     completion_record_ptr  pointer to its completion record
+ * @param[in]     transfer_size          number of bytes in the next part
+ *
+ * @return The following statuses:
+ *      - @ref DML_STATUS_OK;
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR;
+ *      - @ref DML_STATUS_JOB_LENGTH_ERROR if the record reports an error, a mismatch or a backward copy,
+ *        or the descriptor isn't resumable.
+ */
+dsahw_status_t DML_HW_API(continue_descriptor)(dsahw_descriptor_t *descriptor_ptr,
+                                               const dsahw_completion_record_t *completion_record_ptr,
+                                               uint32_t transfer_size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -45,7 +45,7 @@ static_assert(sizeof(own_cache_flush_completion_record_t) == DSA_HW_COMPLETION_R
 
 
 dsahw_status_t DML_HW_API(get_cache_flush_result)(const dsahw_completion_record_t *completion_record_ptr,
-                                                  uint32_t *elements_processed_ptr)
+                                                  uint64_t *elements_processed_ptr)
 {
     own_cache_flush_completion_record_t *hw_result_ptr = (own_cache_flush_completion_record_t *) completion_record_ptr;
 
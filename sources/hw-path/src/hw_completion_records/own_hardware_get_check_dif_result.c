@@ -60,7 +60,7 @@ static_assert(sizeof(own_check_dif_completion_record_t) == DSA_HW_COMPLETION_REC
 dsahw_status_t DML_HW_API(get_check_dif_result)(const dsahw_completion_record_t *completion_record_ptr,
                                                 dml_meta_result_t *result_ptr,
                                                 dml_dif_config_t *dif_config_ptr,
-                                                uint32_t *elements_processed_ptr)
+                                                uint64_t *elements_processed_ptr)
 {
     own_check_dif_completion_record_t *hw_result_ptr = (own_check_dif_completion_record_t *) completion_record_ptr;
 
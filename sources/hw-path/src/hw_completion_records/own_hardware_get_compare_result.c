@@ -46,7 +46,7 @@ static_assert(sizeof(own_compare_completion_record_t) == DSA_HW_COMPLETION_RECOR
 
 dsahw_status_t DML_HW_API(get_compare_result)(const dsahw_completion_record_t *completion_record_ptr,
                                               dml_meta_result_t *result_ptr,
-                                              uint32_t *elements_processed_ptr)
+                                              uint64_t *elements_processed_ptr)
 {
     own_compare_completion_record_t *hw_result_ptr = (own_compare_completion_record_t *) completion_record_ptr;
 
@@ -47,7 +47,7 @@ static_assert(sizeof(own_crc_completion_record_t) == DSA_HW_COMPLETION_RECORD_SI
 
 dsahw_status_t DML_HW_API(get_crc_copy_result)(const dsahw_completion_record_t *completion_record_ptr,
                                                uint32_t *crc_result_ptr,
-                                               uint32_t *elements_processed_ptr)
+                                               uint64_t *elements_processed_ptr)
 {
     const own_crc_completion_record_t *hw_result_ptr = (const own_crc_completion_record_t *)completion_record_ptr;
 
@@ -47,9 +47,9 @@ static_assert(sizeof(own_delta_create_completion_record_t) == DSA_HW_COMPLETION_
 
 dsahw_status_t DML_HW_API(get_delta_create_result)(const dsahw_completion_record_t *completion_record_ptr,
                                                    const uint8_t *destination_ptr,
-                                                   uint32_t *delta_record_length_ptr,
+                                                   uint64_t *delta_record_length_ptr,
                                                    dml_meta_result_t *result_ptr,
-                                                   uint32_t *elements_processed_ptr)
+                                                   uint64_t *elements_processed_ptr)
 {
     const own_delta_create_completion_record_t *hw_result_ptr = (const own_delta_create_completion_record_t *)completion_record_ptr;
 
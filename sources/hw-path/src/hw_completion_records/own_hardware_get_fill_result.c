@@ -45,7 +45,7 @@ static_assert(sizeof(own_fill_completion_record_t) == DSA_HW_COMPLETION_RECORD_S
 
 
 dsahw_status_t DML_HW_API(get_fill_result)(const dsahw_completion_record_t *completion_record_ptr,
-                                           uint32_t *elements_processed_ptr)
+                                           uint64_t *elements_processed_ptr)
 {
     own_fill_completion_record_t *hw_result_ptr = (own_fill_completion_record_t *) completion_record_ptr;
 
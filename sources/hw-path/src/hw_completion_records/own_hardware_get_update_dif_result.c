@@ -60,7 +60,7 @@ static_assert(sizeof(own_update_dif_completion_record_t) == DSA_HW_COMPLETION_RE
 dsahw_status_t DML_HW_API(get_update_dif_result)(const dsahw_completion_record_t *completion_record_ptr,
                                                  dml_dif_config_t *dif_config_ptr,
                                                  dml_meta_result_t *result_ptr,
-                                                 uint32_t *elements_processed_ptr)
+                                                 uint64_t *elements_processed_ptr)
 {
     own_update_dif_completion_record_t *hw_result_ptr = (own_update_dif_completion_record_t *) completion_record_ptr;
 
@@ -64,6 +64,8 @@ typedef int (*accfg_wq_get_group_id_ptr)(struct accfg_wq *wq);
 
 typedef int (*accfg_group_get_id_ptr)(struct accfg_group *group);
 
+typedef unsigned long (*accfg_wq_get_size_ptr)(struct accfg_wq *wq);
+
 typedef int (*accfg_wq_get_user_dev_path_ptr)(struct accfg_wq *wq, char *buf, size_t size);
 
 /**
@@ -92,6 +94,7 @@ static dsa_desc_t functions_table[] = {
         {NULL, "accfg_wq_get_group"},
         {NULL, "accfg_wq_get_group_id"},
         {NULL, "accfg_group_get_id"},
+        {NULL, "accfg_wq_get_size"},
 #if defined(LIB_ACCEL_VERSION_3_2)
         {NULL, "accfg_wq_get_user_dev_path"},
 #endif
@@ -106,7 +109,20 @@ static inline bool own_load_configuration_functions(void *driver_instance_ptr);
 #endif
 
 dsahw_status_t DML_HW_API(initialize_accelerator_driver)(hw_driver_t *driver_ptr) {
-#if defined( linux )
+#if defined( linux ) && defined(DML_HW_EMULATOR)
+    // Emulated device doesn't need the library, its functions are linked in
+    driver_ptr->driver_instance_ptr = NULL;
+
+    for (uint32_t i = 0u; functions_table[i].function_name; ++i) {
+        functions_table[i].function = DML_HW_API(emulator_get_function)(functions_table[i].function_name);
+
+        if (!functions_table[i].function) {
+            return DML_STATUS_DRIVER_NOT_FOUND;
+        }
+    }
+
+    return DML_STATUS_OK;
+#elif defined( linux )
     // Variables
     driver_ptr->driver_instance_ptr = NULL;
 
@@ -318,9 +334,17 @@ int DML_HW_API(group_get_id)(struct accfg_group *group) {
 #endif
 }
 
+uint32_t DML_HW_API(work_queue_get_size)(struct accfg_wq *wq) {
+#if defined( linux )
+    return (uint32_t) ((accfg_wq_get_size_ptr) functions_table[22].function)(wq);
+#else
+    return 0u;
+#endif
+}
+
 int DML_HW_API(work_queue_get_device_path)(struct accfg_wq *wq, char *buf, size_t size) {
 #if defined( linux ) && defined(LIB_ACCEL_VERSION_3_2)
-    return ((accfg_wq_get_user_dev_path_ptr) functions_table[22].function)(wq, buf, size);
+    return ((accfg_wq_get_user_dev_path_ptr) functions_table[23].function)(wq, buf, size);
 #else
     return -1;
 #endif
@@ -0,0 +1,313 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @brief Contains a stand-in for accelerator configuration library used with the emulated device
+ *
+ * @details Topology is taken from the environment:
+ *      - DML_EMULATOR_DEVICES    - number of devices (1 by default);
+ *      - DML_EMULATOR_WQS        - number of work queues per device (1 by default);
+ *      - DML_EMULATOR_DEDICATED_WQS - number of dedicated work queues among them, the last ones (0 by default);
+ *      - DML_EMULATOR_WQ_SIZE    - size of a work queue (@ref OWN_EMULATOR_WQ_SIZE by default);
+ *      - DML_EMULATOR_NUMA_NODES - devices are spread round-robin over this number of nodes (1 by default);
+ *      - DML_EMULATOR_GEN_CAP    - value of General Capabilities Register (see @ref OWN_EMULATOR_GEN_CAP).
+ *
+ */
+
+#if defined(DML_HW_EMULATOR)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hardware_configuration_driver.h"
+#include "own_dsa_accel_constants.h"
+
+/**
+ * @brief Block on fault, overlapping copy, cache control, readback, 2GB transfers, 1K batches
+ */
+#define OWN_EMULATOR_GEN_CAP         0x40915f0107ull
+#define OWN_EMULATOR_WQ_PRIORITY     10
+#define OWN_EMULATOR_NAME_LENGTH     16u
+#define OWN_EMULATOR_WQ_SIZE         32u
+#define OWN_EMULATOR_MAX_WQ_SIZE     4096u
+
+struct accfg_group {
+    struct accfg_device *device_ptr;
+};
+
+struct accfg_wq {
+    struct accfg_device *device_ptr;
+    uint32_t            index;
+};
+
+struct accfg_device {
+    struct accfg_ctx   *ctx_ptr;
+    uint32_t           index;
+    int                numa_node;
+    uint64_t           gen_cap;
+    char               name[OWN_EMULATOR_NAME_LENGTH];
+    struct accfg_group group;
+    struct accfg_wq    *wqs_ptr;
+};
+
+struct accfg_ctx {
+    struct accfg_device *devices_ptr;
+    struct accfg_wq     *wqs_ptr;
+    uint32_t            device_count;
+    uint32_t            wq_count;
+    uint32_t            dedicated_wq_count;
+    uint32_t            wq_size;
+};
+
+static uint64_t own_get_environment_value(const char *name, uint64_t default_value, uint64_t max_value) {
+    const char *value_ptr = getenv(name);
+
+    if (NULL == value_ptr) {
+        return default_value;
+    }
+
+    char     *end_ptr = NULL;
+    uint64_t value    = strtoull(value_ptr, &end_ptr, 0);
+
+    if (end_ptr == value_ptr || 0u == value) {
+        return default_value;
+    }
+
+    return (value > max_value) ? max_value : value;
+}
+
+/* ------ Context ------ */
+
+static int own_emulated_new(struct accfg_ctx **ctx) {
+    const uint32_t device_count = (uint32_t) own_get_environment_value("DML_EMULATOR_DEVICES", 1u, MAX_DEVICE_COUNT);
+    const uint32_t wq_count     = (uint32_t) own_get_environment_value("DML_EMULATOR_WQS", 1u, MAX_WORK_QUEUE_COUNT);
+    const uint32_t numa_count   = (uint32_t) own_get_environment_value("DML_EMULATOR_NUMA_NODES", 1u, MAX_DEVICE_COUNT);
+    const uint64_t gen_cap      = own_get_environment_value("DML_EMULATOR_GEN_CAP", OWN_EMULATOR_GEN_CAP, UINT64_MAX);
+    const uint32_t dedicated    = (uint32_t) own_get_environment_value("DML_EMULATOR_DEDICATED_WQS", 0u, wq_count);
+    const uint32_t wq_size      = (uint32_t) own_get_environment_value("DML_EMULATOR_WQ_SIZE",
+                                                                       OWN_EMULATOR_WQ_SIZE,
+                                                                       OWN_EMULATOR_MAX_WQ_SIZE);
+
+    struct accfg_ctx *ctx_ptr = calloc(1u, sizeof(struct accfg_ctx));
+
+    if (NULL == ctx_ptr) {
+        return -1;
+    }
+
+    ctx_ptr->device_count       = device_count;
+    ctx_ptr->wq_count           = wq_count;
+    ctx_ptr->dedicated_wq_count = dedicated;
+    ctx_ptr->wq_size            = wq_size;
+    ctx_ptr->devices_ptr        = calloc(device_count, sizeof(struct accfg_device));
+    ctx_ptr->wqs_ptr            = calloc(device_count * wq_count, sizeof(struct accfg_wq));
+
+    if (NULL == ctx_ptr->devices_ptr || NULL == ctx_ptr->wqs_ptr) {
+        free(ctx_ptr->devices_ptr);
+        free(ctx_ptr->wqs_ptr);
+        free(ctx_ptr);
+
+        return -1;
+    }
+
+    for (uint32_t i = 0u; i < device_count; ++i) {
+        struct accfg_device *device_ptr = &ctx_ptr->devices_ptr[i];
+
+        device_ptr->ctx_ptr          = ctx_ptr;
+        device_ptr->index            = i;
+        device_ptr->numa_node        = (int) (i % numa_count);
+        device_ptr->gen_cap          = gen_cap;
+        device_ptr->group.device_ptr = device_ptr;
+        device_ptr->wqs_ptr          = &ctx_ptr->wqs_ptr[i * wq_count];
+        snprintf(device_ptr->name, sizeof(device_ptr->name), "dsa%u", i);
+
+        for (uint32_t j = 0u; j < wq_count; ++j) {
+            device_ptr->wqs_ptr[j].device_ptr = device_ptr;
+            device_ptr->wqs_ptr[j].index      = j;
+        }
+    }
+
+    *ctx = ctx_ptr;
+
+    return 0;
+}
+
+static struct accfg_ctx *own_emulated_unref(struct accfg_ctx *ctx) {
+    if (NULL != ctx) {
+        free(ctx->devices_ptr);
+        free(ctx->wqs_ptr);
+        free(ctx);
+    }
+
+    return NULL;
+}
+
+/* ------ Devices ------ */
+
+static struct accfg_device *own_emulated_device_get_first(struct accfg_ctx *ctx) {
+    return ctx->devices_ptr;
+}
+
+static struct accfg_device *own_emulated_device_get_next(struct accfg_device *device) {
+    const struct accfg_ctx *ctx_ptr = device->ctx_ptr;
+
+    return (device->index + 1u < ctx_ptr->device_count) ? device + 1u : NULL;
+}
+
+static const char *own_emulated_device_get_devname(struct accfg_device *device) {
+    return device->name;
+}
+
+static enum accfg_device_state own_emulated_device_get_state(struct accfg_device *device) {
+    (void) device;
+
+    return ACCFG_DEVICE_ENABLED;
+}
+
+static unsigned int own_emulated_device_get_cdev_major(struct accfg_device *device) {
+    (void) device;
+
+    return 0u;
+}
+
+static unsigned long own_emulated_device_get_gen_cap(struct accfg_device *device) {
+    return device->gen_cap;
+}
+
+// Called through the same pointer type as the gen_cap getter, so it returns the same type
+static unsigned long own_emulated_device_get_numa_node(struct accfg_device *device) {
+    return (unsigned long) device->numa_node;
+}
+
+/* ------ Work queues ------ */
+
+static struct accfg_wq *own_emulated_wq_get_first(struct accfg_device *device) {
+    return device->wqs_ptr;
+}
+
+static struct accfg_wq *own_emulated_wq_get_next(struct accfg_wq *wq) {
+    const struct accfg_ctx *ctx_ptr = wq->device_ptr->ctx_ptr;
+
+    return (wq->index + 1u < ctx_ptr->wq_count) ? wq + 1u : NULL;
+}
+
+static enum accfg_wq_state own_emulated_wq_get_state(struct accfg_wq *wq) {
+    (void) wq;
+
+    return ACCFG_WQ_ENABLED;
+}
+
+static enum accfg_wq_mode own_emulated_wq_get_mode(struct accfg_wq *wq) {
+    const struct accfg_ctx *ctx_ptr = wq->device_ptr->ctx_ptr;
+
+    return (wq->index + ctx_ptr->dedicated_wq_count >= ctx_ptr->wq_count) ? ACCFG_WQ_DEDICATED : ACCFG_WQ_SHARED;
+}
+
+static unsigned long own_emulated_wq_get_size(struct accfg_wq *wq) {
+    return wq->device_ptr->ctx_ptr->wq_size;
+}
+
+static int own_emulated_wq_get_cdev_minor(struct accfg_wq *wq) {
+    return (int) wq->index;
+}
+
+static int own_emulated_wq_get_priority(struct accfg_wq *wq) {
+    (void) wq;
+
+    return OWN_EMULATOR_WQ_PRIORITY;
+}
+
+static struct accfg_group *own_emulated_wq_get_group(struct accfg_wq *wq) {
+    return &wq->device_ptr->group;
+}
+
+static int own_emulated_wq_get_group_id(struct accfg_wq *wq) {
+    (void) wq;
+
+    return 0;
+}
+
+static int own_emulated_wq_get_user_dev_path(struct accfg_wq *wq, char *buf, size_t size) {
+    return snprintf(buf, size, "/dev/dsa/wq%u.%u", wq->device_ptr->index, wq->index);
+}
+
+/* ------ Groups ------ */
+
+static struct accfg_group *own_emulated_group_get_first(struct accfg_device *device) {
+    return &device->group;
+}
+
+static struct accfg_group *own_emulated_group_get_next(struct accfg_group *group) {
+    (void) group;
+
+    return NULL;
+}
+
+static int own_emulated_group_get_traffic_class(struct accfg_group *group) {
+    (void) group;
+
+    return 0;
+}
+
+static int own_emulated_group_get_id(struct accfg_group *group) {
+    (void) group;
+
+    return 0;
+}
+
+/**
+ * @brief Table with emulated functions, names are the same as in accelerator configuration library
+ */
+static const dsa_desc_t own_emulated_functions_table[] = {
+        {(library_function) own_emulated_new,                    "accfg_new"},
+        {(library_function) own_emulated_device_get_first,       "accfg_device_get_first"},
+        {(library_function) own_emulated_device_get_devname,     "accfg_device_get_devname"},
+        {(library_function) own_emulated_device_get_next,        "accfg_device_get_next"},
+        {(library_function) own_emulated_wq_get_first,           "accfg_wq_get_first"},
+        {(library_function) own_emulated_wq_get_next,            "accfg_wq_get_next"},
+        {(library_function) own_emulated_wq_get_state,           "accfg_wq_get_state"},
+        {(library_function) own_emulated_wq_get_mode,            "accfg_wq_get_mode"},
+        {(library_function) own_emulated_device_get_cdev_major,  "accfg_device_get_cdev_major"},
+        {(library_function) own_emulated_wq_get_cdev_minor,      "accfg_wq_get_cdev_minor"},
+        {(library_function) own_emulated_device_get_state,       "accfg_device_get_state"},
+        {(library_function) own_emulated_unref,                  "accfg_unref"},
+        {(library_function) own_emulated_device_get_gen_cap,     "accfg_device_get_gen_cap"},
+        {(library_function) own_emulated_device_get_numa_node,   "accfg_device_get_numa_node"},
+        {(library_function) own_emulated_wq_get_priority,        "accfg_wq_get_priority"},
+        {(library_function) own_emulated_group_get_first,        "accfg_group_get_first"},
+        {(library_function) own_emulated_group_get_next,         "accfg_group_get_next"},
+        {(library_function) own_emulated_group_get_traffic_class, "accfg_group_get_traffic_class_a"},
+        {(library_function) own_emulated_group_get_traffic_class, "accfg_group_get_traffic_class_b"},
+        {(library_function) own_emulated_wq_get_group,           "accfg_wq_get_group"},
+        {(library_function) own_emulated_wq_get_group_id,        "accfg_wq_get_group_id"},
+        {(library_function) own_emulated_group_get_id,           "accfg_group_get_id"},
+        {(library_function) own_emulated_wq_get_size,            "accfg_wq_get_size"},
+        {(library_function) own_emulated_wq_get_user_dev_path,   "accfg_wq_get_user_dev_path"},
+        // Terminate list
+        {NULL, NULL}
+};
+
+library_function DML_HW_API(emulator_get_function)(const char *function_name) {
+    for (uint32_t i = 0u; NULL != own_emulated_functions_table[i].function_name; ++i) {
+        if (0 == strcmp(own_emulated_functions_table[i].function_name, function_name)) {
+            return own_emulated_functions_table[i].function;
+        }
+    }
+
+    return NULL;
+}
+
+#endif
@@ -61,6 +61,7 @@ dsahw_status_t DML_HW_API(init_delta_apply_descriptor)(dsahw_descriptor_t *descr
 {
     DML_BAD_ARGUMENT_NULL_POINTER(delta_record_ptr);
     DML_BAD_ARGUMENT_NULL_POINTER(destination_ptr);
+    DML_BAD_ARGUMENT_RETURN(DML_FLAG_DELTA_WIDE_RECORD & flags, DML_STATUS_JOB_FLAGS_ERROR)
 
     // Redefine a descriptor to fill
     own_hw_delta_apply_descriptor_t *op_descriptor_ptr = (own_hw_delta_apply_descriptor_t *)descriptor_ptr;
@@ -71,6 +71,7 @@ dsahw_status_t DML_HW_API(init_delta_create_descriptor)(dsahw_descriptor_t *desc
     DML_BAD_ARGUMENT_NULL_POINTER(source_first_ptr);
     DML_BAD_ARGUMENT_NULL_POINTER(source_second_ptr);
     DML_BAD_ARGUMENT_NULL_POINTER(delta_record_ptr);
+    DML_BAD_ARGUMENT_RETURN(DML_FLAG_DELTA_WIDE_RECORD & flags, DML_STATUS_JOB_FLAGS_ERROR)
     DML_BAD_ARGUMENT_RETURN(delta_record_length % OWN_DELTA_NOTE_SIZE, DML_STATUS_DELTA_INPUT_SIZE_ERROR)
     DML_BAD_ARGUMENT_RETURN(source_length > OWN_MAX_AVAILABLE_INPUT_SIZE, DML_STATUS_DELTA_OFFSET_ERROR)
 
@@ -0,0 +1,367 @@
+/*
+ * Copyright 2020-2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+/**
+ * @brief Contains an implementation of descriptors resume after a page fault:
+ *      - @ref dsa_is_resumable_descriptor()
+ *      - @ref dsa_allow_page_faults()
+ *      - @ref dsa_advance_descriptor()
+ *      - @ref dsa_resume_descriptor()
+ *      - @ref dsa_continue_descriptor()
+ *      - @ref dsa_count_page_fault_resume()
+ *      - @ref dsa_get_page_fault_statistics()
+ * @date 10/18/2026
+ *
+ */
+#include <string.h>
+#include "own_hardware_status.h"
+#include "own_hardware_definitions.h"
+#include "hardware_descriptors_api.h"
+#include "hardware_api.h"
+
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define OWN_ATOMIC_INCREMENT(counter)  _InterlockedIncrement64((volatile int64_t *) &(counter))
+    #define OWN_ATOMIC_LOAD(value)         (value)
+#else
+    #define OWN_ATOMIC_INCREMENT(counter)  __atomic_fetch_add(&(counter), 1u, __ATOMIC_RELAXED)
+    #define OWN_ATOMIC_LOAD(value)         __atomic_load_n(&(value), __ATOMIC_RELAXED)
+#endif
+
+/*
+ * Descriptor fields, their offsets are the same for all operations
+ */
+#define OWN_GENERAL_FLAGS_OFFSET     4u
+#define OWN_OPERATION_FLAGS_OFFSET   6u
+#define OWN_OPERATION_TYPE_OFFSET    7u
+#define OWN_ADDRESS_1_OFFSET         16u  /**< Source, the first source for Compare, pattern for Fill          */
+#define OWN_ADDRESS_2_OFFSET         24u  /**< Destination, the second source for Compare, pattern for Compare
+                                               Pattern, region for Flush                                      */
+#define OWN_TRANSFER_SIZE_OFFSET     32u
+#define OWN_ADDRESS_3_OFFSET         40u  /**< The second destination of Dualcast                              */
+#define OWN_CRC_SEED_OFFSET          40u
+#define OWN_CRC_SEED_ADDRESS_OFFSET  48u
+
+#define OWN_CRC_READ_SEED_FLAG       (DML_FLAG_CRC_READ_SEED >> 16u)
+
+/*
+ * Completion record fields
+ */
+#define OWN_RESULT_OFFSET            1u
+#define OWN_BYTES_COMPLETED_OFFSET   4u
+#define OWN_FAULT_ADDRESS_OFFSET     8u
+#define OWN_CRC_VALUE_OFFSET         16u
+
+#define OWN_STATUS_MASK              0x3Fu /**< Bit 7 of the status is Read/Write indicator of the faulted access */
+#define OWN_STATUS_WRITE_FAULT       0x80u
+#define OWN_MEM_MOVE_BACKWARD        0x01u /**< Overlapping buffers are copied from the end */
+
+
+/**
+ * @brief Counters of resumed descriptors
+ */
+static dml_page_fault_statistics_t own_statistics = {0u};
+
+
+static inline uint32_t own_read_32u(const uint8_t *const field_ptr)
+{
+    uint32_t value = 0u;
+    memcpy(&value, field_ptr, sizeof(value));
+
+    return value;
+}
+
+static inline uint64_t own_read_64u(const uint8_t *const field_ptr)
+{
+    uint64_t value = 0u;
+    memcpy(&value, field_ptr, sizeof(value));
+
+    return value;
+}
+
+static inline void own_write_32u(uint8_t *const field_ptr, uint32_t value)
+{
+    memcpy(field_ptr, &value, sizeof(value));
+}
+
+static inline void own_write_64u(uint8_t *const field_ptr, uint64_t value)
+{
+    memcpy(field_ptr, &value, sizeof(value));
+}
+
+static inline void own_advance_address(uint8_t *const descriptor_bytes, uint32_t offset, uint32_t bytes)
+{
+    own_write_64u(&descriptor_bytes[offset], own_read_64u(&descriptor_bytes[offset]) + bytes);
+}
+
+/**
+ * @brief Rotates 8-byte pattern, so that the rest of the region starts with the byte of the pattern it had
+ */
+static inline void own_advance_pattern(uint8_t *const descriptor_bytes, uint32_t offset, uint32_t bytes)
+{
+    const uint32_t shift   = (bytes % sizeof(uint64_t)) * 8u;
+    const uint64_t pattern = own_read_64u(&descriptor_bytes[offset]);
+
+    if (0u != shift)
+    {
+        own_write_64u(&descriptor_bytes[offset], (pattern >> shift) | (pattern << (64u - shift)));
+    }
+}
+
+/**
+ * @brief Makes the faulted page present, so that the resubmitted descriptor doesn't stop on it again
+ *
+ * @note Write faults need a write access: a read maps the zero page for the anonymous memory.
+ *       Atomic add of zero keeps the data, the hardware doesn't touch this byte until the resubmission.
+ */
+static inline void own_touch_page(uint8_t *const address_ptr, uint32_t is_write_fault)
+{
+    if (NULL == address_ptr)
+    {
+        return;
+    }
+
+    if (is_write_fault)
+    {
+#if defined(_MSC_VER)
+        _InterlockedOr8((volatile char *) address_ptr, 0);
+#else
+        __atomic_fetch_add(address_ptr, 0u, __ATOMIC_RELAXED);
+#endif
+    }
+    else
+    {
+        (void) *(volatile uint8_t *) address_ptr;
+    }
+}
+
+
+/**
+ * @brief Makes CRC of the processed part the seed for the rest of a CRC or Copy with CRC descriptor
+ */
+static inline void own_chain_crc_seed(uint8_t *const descriptor_bytes, const uint8_t *const record_bytes)
+{
+    const uint8_t operation = descriptor_bytes[OWN_OPERATION_TYPE_OFFSET];
+
+    if (DML_OP_CRC == operation || DML_OP_COPY_CRC == operation)
+    {
+        own_write_32u(&descriptor_bytes[OWN_CRC_SEED_OFFSET], own_read_32u(&record_bytes[OWN_CRC_VALUE_OFFSET]));
+        own_write_64u(&descriptor_bytes[OWN_CRC_SEED_ADDRESS_OFFSET], 0u);
+        descriptor_bytes[OWN_OPERATION_FLAGS_OFFSET] &= (uint8_t) ~OWN_CRC_READ_SEED_FLAG;
+    }
+}
+
+
+int DML_HW_API(is_resumable_descriptor)(const dsahw_descriptor_t *descriptor_ptr)
+{
+    switch (descriptor_ptr->bytes[OWN_OPERATION_TYPE_OFFSET])
+    {
+        case DML_OP_MEM_MOVE:
+        case DML_OP_FILL:
+        case DML_OP_COMPARE:
+        case DML_OP_COMPARE_PATTERN:
+        case DML_OP_DUALCAST:
+        case DML_OP_CRC:
+        case DML_OP_COPY_CRC:
+        case DML_OP_CACHE_FLUSH:
+            return 1;
+
+        default:
+            return 0;
+    }
+}
+
+
+void DML_HW_API(allow_page_faults)(dsahw_descriptor_t *descriptor_ptr)
+{
+    if (!DML_HW_API(is_resumable_descriptor)(descriptor_ptr))
+    {
+        return;
+    }
+
+    uint16_t general_flags = 0u;
+    memcpy(&general_flags, &descriptor_ptr->bytes[OWN_GENERAL_FLAGS_OFFSET], sizeof(general_flags));
+
+    general_flags &= (uint16_t) ~HW_FLAG_BLOCK_ON_FAULT;
+    memcpy(&descriptor_ptr->bytes[OWN_GENERAL_FLAGS_OFFSET], &general_flags, sizeof(general_flags));
+}
+
+
+dsahw_status_t DML_HW_API(advance_descriptor)(dsahw_descriptor_t *descriptor_ptr, uint32_t bytes)
+{
+    DML_BAD_ARGUMENT_NULL_POINTER(descriptor_ptr)
+
+    uint8_t *descriptor_bytes    = descriptor_ptr->bytes;
+    const uint32_t transfer_size = own_read_32u(&descriptor_bytes[OWN_TRANSFER_SIZE_OFFSET]);
+
+    if (bytes > transfer_size)
+    {
+        return DML_STATUS_PAGE_FAULT_ERROR;
+    }
+
+    switch (descriptor_bytes[OWN_OPERATION_TYPE_OFFSET])
+    {
+        case DML_OP_MEM_MOVE:
+        case DML_OP_COMPARE:
+        case DML_OP_COPY_CRC:
+            own_advance_address(descriptor_bytes, OWN_ADDRESS_1_OFFSET, bytes);
+            own_advance_address(descriptor_bytes, OWN_ADDRESS_2_OFFSET, bytes);
+            break;
+
+        case DML_OP_COMPARE_PATTERN:
+            own_advance_address(descriptor_bytes, OWN_ADDRESS_1_OFFSET, bytes);
+            own_advance_pattern(descriptor_bytes, OWN_ADDRESS_2_OFFSET, bytes);
+            break;
+
+        case DML_OP_FILL:
+            own_advance_pattern(descriptor_bytes, OWN_ADDRESS_1_OFFSET, bytes);
+            own_advance_address(descriptor_bytes, OWN_ADDRESS_2_OFFSET, bytes);
+            break;
+
+        case DML_OP_CACHE_FLUSH:
+            own_advance_address(descriptor_bytes, OWN_ADDRESS_2_OFFSET, bytes);
+            break;
+
+        case DML_OP_DUALCAST:
+            own_advance_address(descriptor_bytes, OWN_ADDRESS_1_OFFSET, bytes);
+            own_advance_address(descriptor_bytes, OWN_ADDRESS_2_OFFSET, bytes);
+            own_advance_address(descriptor_bytes, OWN_ADDRESS_3_OFFSET, bytes);
+            break;
+
+        case DML_OP_CRC:
+            own_advance_address(descriptor_bytes, OWN_ADDRESS_1_OFFSET, bytes);
+            break;
+
+        default:
+            return DML_STATUS_PAGE_FAULT_ERROR;
+    }
+
+    own_write_32u(&descriptor_bytes[OWN_TRANSFER_SIZE_OFFSET], transfer_size - bytes);
+
+    return DML_STATUS_OK;
+}
+
+
+dsahw_status_t DML_HW_API(resume_descriptor)(dsahw_descriptor_t *descriptor_ptr,
+                                             const dsahw_completion_record_t *completion_record_ptr,
+                                             uint32_t block_on_fault,
+                                             uint32_t *bytes_completed_ptr)
+{
+    DML_BAD_ARGUMENT_NULL_POINTER(descriptor_ptr)
+    DML_BAD_ARGUMENT_NULL_POINTER(completion_record_ptr)
+    DML_BAD_ARGUMENT_NULL_POINTER(bytes_completed_ptr)
+
+    const uint8_t *record_bytes = (const uint8_t *) completion_record_ptr;
+    uint8_t *descriptor_bytes   = descriptor_ptr->bytes;
+
+    if (HW_STATUS_PAGE_FAULT_DURING_PROCESSING != (completion_record_ptr->status & OWN_STATUS_MASK) ||
+        !DML_HW_API(is_resumable_descriptor)(descriptor_ptr))
+    {
+        return DML_STATUS_PAGE_FAULT_ERROR;
+    }
+
+    const uint32_t transfer_size   = own_read_32u(&descriptor_bytes[OWN_TRANSFER_SIZE_OFFSET]);
+    const uint32_t bytes_completed = own_read_32u(&record_bytes[OWN_BYTES_COMPLETED_OFFSET]);
+    const uint8_t  operation       = descriptor_bytes[OWN_OPERATION_TYPE_OFFSET];
+
+    if (bytes_completed > transfer_size)
+    {
+        return DML_STATUS_PAGE_FAULT_ERROR;
+    }
+
+    if (DML_OP_MEM_MOVE == operation && (record_bytes[OWN_RESULT_OFFSET] & OWN_MEM_MOVE_BACKWARD))
+    {
+        // Backward copy completes the tail first, the rest starts at the same addresses
+        own_write_32u(&descriptor_bytes[OWN_TRANSFER_SIZE_OFFSET], transfer_size - bytes_completed);
+    }
+    else
+    {
+        DML_HW_API(advance_descriptor)(descriptor_ptr, bytes_completed);
+    }
+
+    own_chain_crc_seed(descriptor_bytes, record_bytes);
+
+    if (block_on_fault)
+    {
+        uint16_t general_flags = 0u;
+        memcpy(&general_flags, &descriptor_bytes[OWN_GENERAL_FLAGS_OFFSET], sizeof(general_flags));
+
+        general_flags |= HW_FLAG_BLOCK_ON_FAULT;
+        memcpy(&descriptor_bytes[OWN_GENERAL_FLAGS_OFFSET], &general_flags, sizeof(general_flags));
+    }
+
+    own_touch_page((uint8_t *) (uintptr_t) own_read_64u(&record_bytes[OWN_FAULT_ADDRESS_OFFSET]),
+                   completion_record_ptr->status & OWN_STATUS_WRITE_FAULT);
+
+    (*bytes_completed_ptr) = bytes_completed;
+
+    return DML_STATUS_OK;
+}
+
+
+dsahw_status_t DML_HW_API(continue_descriptor)(dsahw_descriptor_t *descriptor_ptr,
+                                               const dsahw_completion_record_t *completion_record_ptr,
+                                               uint32_t transfer_size)
+{
+    DML_BAD_ARGUMENT_NULL_POINTER(descriptor_ptr)
+    DML_BAD_ARGUMENT_NULL_POINTER(completion_record_ptr)
+
+    const uint8_t *record_bytes = (const uint8_t *) completion_record_ptr;
+    uint8_t *descriptor_bytes   = descriptor_ptr->bytes;
+    const uint8_t operation     = descriptor_bytes[OWN_OPERATION_TYPE_OFFSET];
+
+    // A mismatch ends comparisons, backward Memory Move can't be continued forward
+    if (HW_STATUS_SUCCESS != (completion_record_ptr->status & OWN_STATUS_MASK) ||
+        ((DML_OP_COMPARE == operation || DML_OP_COMPARE_PATTERN == operation || DML_OP_MEM_MOVE == operation) &&
+         0u != record_bytes[OWN_RESULT_OFFSET]))
+    {
+        return DML_STATUS_JOB_LENGTH_ERROR;
+    }
+
+    const dsahw_status_t status =
+        DML_HW_API(advance_descriptor)(descriptor_ptr, own_read_32u(&descriptor_bytes[OWN_TRANSFER_SIZE_OFFSET]));
+
+    if (DML_STATUS_OK != status)
+    {
+        return DML_STATUS_JOB_LENGTH_ERROR;
+    }
+
+    own_write_32u(&descriptor_bytes[OWN_TRANSFER_SIZE_OFFSET], transfer_size);
+    own_chain_crc_seed(descriptor_bytes, record_bytes);
+    DML_HW_API(allow_page_faults)(descriptor_ptr);
+
+    return DML_STATUS_OK;
+}
+
+
+void DML_HW_API(count_page_fault_resume)(uint32_t on_cpu)
+{
+    if (on_cpu)
+    {
+        OWN_ATOMIC_INCREMENT(own_statistics.completed_on_cpu);
+    }
+    else
+    {
+        OWN_ATOMIC_INCREMENT(own_statistics.resumed_on_hardware);
+    }
+}
+
+
+void DML_HW_API(get_page_fault_statistics)(dml_page_fault_statistics_t *statistics_ptr)
+{
+    statistics_ptr->resumed_on_hardware = OWN_ATOMIC_LOAD(own_statistics.resumed_on_hardware);
+    statistics_ptr->completed_on_cpu    = OWN_ATOMIC_LOAD(own_statistics.completed_on_cpu);
+}
@@ -58,6 +58,59 @@ OWN_API(uint32_t, sw_get_state_size, ())
 OWN_API(dml_status_t, sw_submit_job, (dml_job_t *const dml_job_ptr))
 
 
+/** @} */
+
+
+/**
+ * @addtogroup AUTO_PATH
+ * @{
+ * @brief Policy that chooses execution path for jobs initialized with @ref DML_PATH_AUTO.
+ *
+ */
+
+
+/**
+ * @brief Returns hardware context shared by all auto path jobs
+ *
+ * @note Hardware is looked for once, NULL is returned if it isn't available
+ *
+ */
+OWN_API(uint8_t *, auto_get_hw_context, ())
+
+
+/**
+ * @brief Chooses execution path for a job and counts the decision
+ *
+ * @param[in] dml_job_ptr      pointer on to job specified by user
+ * @param[in] hw_state_ptr     hardware context or NULL if hardware isn't available
+ *
+ * @return @ref DML_PATH_HW or @ref DML_PATH_SW
+ *
+ */
+OWN_API(dml_path_t, auto_select_path, (const dml_job_t *const dml_job_ptr, const uint8_t *const hw_state_ptr))
+
+
+/**
+ * @brief Counts result of a hardware submission, rejected ones make next jobs stay on CPU for a while
+ *
+ * @param[in] status    status returned by hardware submission
+ *
+ */
+OWN_API(void, auto_count_submission, (const dml_status_t status))
+
+
+/**
+ * @brief Checks if a job failed on hardware can be transparently re-executed on CPU, counts the fallback
+ *
+ * @param[in] dml_job_ptr    pointer on to job specified by user
+ * @param[in] status         status reported by hardware
+ *
+ * @return non-zero if the job should be re-executed with software path
+ *
+ */
+OWN_API(uint32_t, auto_fallback_on_error, (const dml_job_t *const dml_job_ptr, const dml_status_t status))
+
+
 /** @} */
 
 #endif //DML_OWN_DML_API_HPP__
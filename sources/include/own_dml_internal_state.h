@@ -61,6 +61,8 @@ typedef struct
 
 
 #if defined(DML_HW)
+#define OWN_HW_PART_ALIGNMENT_MASK 7u /**< Parts of a long job start with the first byte of Compare Pattern pattern */
+
 /**
  * @brief Hardware operation type
  */
@@ -87,10 +89,14 @@ typedef struct
 typedef struct
 {
     dml_path_t                active_path;      /**< Execution path, for which @ref dml_job_t was inited with @ref dml_init_job */
+    dml_path_t                submitted_path;   /**< Execution path, the last submitted operation was executed on               */
     own_dml_batch_info_t      batch_info;       /**< Information about Batch for current job                                    */
 #if defined(DML_HW)
     own_dml_hw_operation_t    hw_operation;     /**< Contains descriptor and completion record for an operation execution       */
     own_dml_hw_batch_buffer_t hw_batch_buffers; /**< Contains descriptors and completion records for the batch internal buffers */
+    uint64_t                  hw_resumed_bytes; /**< Bytes completed by the previous parts and before page faults in this one   */
+    uint64_t                  hw_left_bytes;    /**< Bytes of a long job left for the next parts, see @ref dml_check_job        */
+    uint32_t                  hw_resume_count;  /**< Times the current part was resumed after page faults                       */
 #endif
     uint8_t                   *sw_state_ptr;    /**< Specific information about @ref dml_job_t to execute with software path    */
     uint8_t                   *hw_state_ptr;    /**< Specific information about @ref dml_job_t to execute with hardware path    */
@@ -29,6 +29,13 @@
 #ifndef DML_OWN_DML_SOFTWARE_COMMON_API_HPP__
 #define DML_OWN_DML_SOFTWARE_COMMON_API_HPP__
 
+/**
+ * @brief Maximal number of bytes processed by a single core function call, longer jobs are processed by parts
+ *
+ * @note The size is a multiple of 8, so a fill pattern and 8-byte comparison blocks continue in the next part.
+ */
+#define OWN_SW_PART_SIZE 0x40000000u
+
 /**
  * @brief Reverses a specified 32-bit value
  *
@@ -58,6 +65,17 @@ OWN_API_INLINE(uint16_t, sw_reverse_bytes_16u, (uint16_t value))
  */
 OWN_API_INLINE(uint32_t, sw_reverse_bytes_32u, (uint32_t value))
 
+
+/**
+ * @brief Returns size of the job part that starts at the specified offset
+ *
+ * @param[in] length  total number of bytes to process
+ * @param[in] offset  offset of the part, a multiple of @ref OWN_SW_PART_SIZE
+ *
+ * @return number of bytes in the part
+ */
+OWN_API_INLINE(uint32_t, sw_get_part_size, (uint64_t length, uint64_t offset))
+
 #endif //DML_OWN_DML_SOFTWARE_COMMON_API_HPP__
 
 /** @} */
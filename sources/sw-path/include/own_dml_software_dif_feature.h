@@ -36,6 +36,8 @@
 
 #define OWN_DIF_CRC_POLYNOMIAL 0x8BB7u /**< CRC16 T10 polynomial */
 
+#define OWN_DIF_BLOCKS_GROUP_SIZE 32u  /**< Number of blocks which guard tags are calculated at once */
+
 /* ------ MACRO ------ */
 
 #if defined(__GNUC__)
@@ -85,6 +87,40 @@ OWN_BYTE_PACKED_STRUCTURE_END
 
 extern uint32_t own_dif_block_sizes[]; /**< Contain associative data block size for protection with DIF */
 
+/* ------ FUNCTIONS ------ */
+
+/**
+ * @brief Calculates guard tags CRC for a group of protected blocks starting from the given one
+ *
+ * @details Up to @ref OWN_DIF_BLOCKS_GROUP_SIZE blocks are hashed at once, which keeps the CPU busy
+ * with several independent CRC calculations instead of waiting for each of them in turn.
+ *
+ * @param[in]  block_ptr     first block of the group
+ * @param[in]  block_size    protected data size of a block, in bytes
+ * @param[in]  block_step    distance between starts of neighbouring blocks, in bytes
+ * @param[in]  blocks_left   number of blocks left to process, starting from the given one
+ * @param[in]  crc_seed      CRC seed
+ * @param[out] guard_tags    CRC values for the group, not byte-swapped yet
+ */
+OWN_FUN_INLINE(void, sw_dif_calculate_guard_tags, (const uint8_t *block_ptr,
+                                                   uint32_t      block_size,
+                                                   uint32_t      block_step,
+                                                   uint64_t      blocks_left,
+                                                   uint16_t      crc_seed,
+                                                   uint16_t      guard_tags[OWN_DIF_BLOCKS_GROUP_SIZE]))
+{
+    const uint32_t group_size = (blocks_left < OWN_DIF_BLOCKS_GROUP_SIZE)
+                                ? (uint32_t) blocks_left
+                                : OWN_DIF_BLOCKS_GROUP_SIZE;
+
+    for (uint32_t i = 0u; i < group_size; i++)
+    {
+        guard_tags[i] = crc_seed;
+    }
+
+    dmlc_calculate_crc_16u_blocks(block_ptr, block_size, block_step, group_size, guard_tags, OWN_DIF_CRC_POLYNOMIAL);
+}
+
 #endif //DML_OWN_DML_SOFTWARE_DIF_FEATURE_H__
 
 /** @} */
@@ -155,6 +155,9 @@ OWN_API_INLINE(dml_status_t, sw_compare_with_pattern, (dml_job_t *const dml_job_
  * what can be sored in the delta record (524,280 bytes)
  * @warning The Delta Record Size must be a multiple of 10
  *
+ * @note With @ref DML_FLAG_DELTA_WIDE_RECORD the record consists of 16-byte notes with 64-bit offsets,
+ *       the Source Size isn't limited and the Delta Record Size must be a multiple of 16
+ *
  * @return
  *      - @ref DML_STATUS_OK;
  *      - @ref DML_STATUS_NULL_POINTER_ERROR;
@@ -186,6 +189,9 @@ OWN_API_INLINE(dml_status_t, sw_create_delta, (dml_job_t *const dml_job_ptr))
  * @warning The Delta Record Size must be a multiple of 10
  * @warning Operation does not support an overlap between Destination Address and Delta Record
  *
+ * @note With @ref DML_FLAG_DELTA_WIDE_RECORD the record is read as 16-byte notes with 64-bit offsets,
+ *       the Destination Size isn't limited and the Delta Record Size must be a multiple of 16
+ *
  * @return
  *      - @ref DML_STATUS_OK;
  *      - @ref DML_STATUS_NULL_POINTER_ERROR;
@@ -0,0 +1,28 @@
+/*
+ * Copyright 2021 Intel Corporation.
+ *
+ * This software and the related documents are Intel copyrighted materials,
+ * and your use of them is governed by the express license under which they
+ * were provided to you ("License"). Unless the License provides otherwise,
+ * you may not use, modify, copy, publish, distribute, disclose or transmit
+ * this software or the related documents without Intel's prior written
+ * permission.
+ *
+ * This software and the related documents are provided as is, with no
+ * express or implied warranties, other than those that are expressly
+ * stated in the License.
+ *
+ */
+
+/**
+ * @brief Contains an implementation of splitting jobs into parts core functions can process
+ * @date 10/18/2026
+ *
+ */
+
+OWN_FUN_INLINE(uint32_t, sw_get_part_size, (uint64_t length, uint64_t offset))
+{
+    const uint64_t remaining_size = length - offset;
+
+    return (remaining_size < OWN_SW_PART_SIZE) ? (uint32_t) remaining_size : OWN_SW_PART_SIZE;
+}
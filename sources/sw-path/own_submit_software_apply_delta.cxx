@@ -28,12 +28,45 @@ OWN_FUN_INLINE(dml_status_t, sw_apply_delta, (dml_job_t *const dml_job_ptr))
     // Variables
     uint8_t *const vector_to_update_ptr  = dml_job_ptr->destination_first_ptr;
     uint8_t *const delta_record_ptr      = dml_job_ptr->source_first_ptr;
-    const uint32_t vector_to_update_size = dml_job_ptr->destination_length;
-    const uint32_t delta_record_size     = dml_job_ptr->source_length;
+    const uint64_t vector_to_update_size = dml_job_ptr->destination_length;
+    const uint64_t delta_record_size     = dml_job_ptr->source_length;
+
+    if (DML_FLAG_DELTA_WIDE_RECORD & dml_job_ptr->flags)
+    {
+        // Offsets of the notes are absolute, so the record is applied by parts of whole notes
+        const uint32_t max_part_size = OWN_SW_PART_SIZE / DML_WIDE_DELTA_NOTE_SIZE * DML_WIDE_DELTA_NOTE_SIZE;
+        dmlc_status_t  status        = DML_STATUS_OK;
+        uint64_t       offset        = 0u;
+
+        do
+        {
+            const uint64_t remaining_size = delta_record_size - offset;
+            const uint32_t part_size      = (remaining_size < max_part_size) ? (uint32_t) remaining_size : max_part_size;
+
+            status = dmlc_apply_wide_delta_record_8u(vector_to_update_ptr,
+                                                     delta_record_ptr + offset,
+                                                     vector_to_update_size,
+                                                     part_size);
+            offset += max_part_size;
+        } while ((DML_STATUS_OK == status) && (offset < delta_record_size));
+
+        return status;
+    }
+
+    // Standard record addresses 0.5 MB at most, the core checks the sizes then
+    if (UINT32_MAX < vector_to_update_size)
+    {
+        return DML_STATUS_DELTA_INPUT_SIZE_ERROR;
+    }
+
+    if (UINT32_MAX < delta_record_size)
+    {
+        return DML_STATUS_DELTA_RECORD_SIZE_ERROR;
+    }
 
     // Call to DML Core function
     return dmlc_apply_delta_record_8u(vector_to_update_ptr,
                                       delta_record_ptr,
-                                      vector_to_update_size,
-                                      delta_record_size);
+                                      (uint32_t) vector_to_update_size,
+                                      (uint32_t) delta_record_size);
 }
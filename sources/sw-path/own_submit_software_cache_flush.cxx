@@ -25,10 +25,18 @@ OWN_FUN_INLINE(dml_status_t, sw_cache_flush, (dml_job_t *const dml_job_ptr))
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr->destination_first_ptr);
 
     uint8_t *const memory_region_ptr  = dml_job_ptr->destination_first_ptr;
-    const uint32_t memory_region_size = dml_job_ptr->destination_length;
+    const uint64_t memory_region_size = dml_job_ptr->destination_length;
     dml_operation_flags_t flags       = dml_job_ptr->flags;
+    dmlc_status_t status              = DML_STATUS_OK;
 
-    return (flags & DML_FLAG_DONT_INVALIDATE_CACHE) ?
-                            dmlc_copy_cache_to_memory_8u(memory_region_ptr, memory_region_size) :
-                            dmlc_move_cache_to_memory_8u(memory_region_ptr, memory_region_size);
+    for (uint64_t offset = 0u; offset < memory_region_size && DML_STATUS_OK == status; offset += OWN_SW_PART_SIZE)
+    {
+        const uint32_t part_size = idml_sw_get_part_size(memory_region_size, offset);
+
+        status = (flags & DML_FLAG_DONT_INVALIDATE_CACHE) ?
+                            dmlc_copy_cache_to_memory_8u(memory_region_ptr + offset, part_size) :
+                            dmlc_move_cache_to_memory_8u(memory_region_ptr + offset, part_size);
+    }
+
+    return status;
 }
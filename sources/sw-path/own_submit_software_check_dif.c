@@ -51,7 +51,7 @@ OWN_FUN(dml_status_t, sw_check_dif, (dml_job_t *const dml_job_ptr))
     const uint32_t dif_flags   = dml_job_ptr->dif_config.flags;
     const uint32_t block_size  = own_dif_block_sizes[dml_job_ptr->dif_config.block_size];
     const uint32_t source_step = block_size + sizeof(own_dif_t);
-    const uint32_t block_count = dml_job_ptr->source_length / source_step;
+    const uint64_t block_count = dml_job_ptr->source_length / source_step;
 
     DML_BAD_ARGUMENT_RETURN((dml_job_ptr->source_length % source_step), DML_STATUS_JOB_LENGTH_ERROR)
 
@@ -76,11 +76,19 @@ OWN_FUN(dml_status_t, sw_check_dif, (dml_job_t *const dml_job_ptr))
     uint16_t application_tag   = dml_job_ptr->dif_config.source_application_tag_seed;
     uint32_t reference_tag     = dml_job_ptr->dif_config.source_reference_tag_seed;
     uint32_t check_accumulator = 0u;
+    uint16_t guard_tags[OWN_DIF_BLOCKS_GROUP_SIZE];
 
     // Process data
-    for (uint32_t block = 0; block < block_count; block++)
+    for (uint64_t block = 0u; block < block_count; block++)
     {
         const own_dif_t *const dif_ptr = (own_dif_t *)(source_ptr + block_size);
+        const uint32_t group_idx       = block % OWN_DIF_BLOCKS_GROUP_SIZE;
+
+        // Guard tags are calculated for a group of blocks at once
+        if (check_guard && (0u == group_idx))
+        {
+            idml_sw_dif_calculate_guard_tags(source_ptr, block_size, source_step, block_count - block, crc_seed, guard_tags);
+        }
 
         // F Detect Condition
         if ((DML_DIF_FLAG_SRC_F_DETECT_ALL & dif_flags)
@@ -99,11 +107,9 @@ OWN_FUN(dml_status_t, sw_check_dif, (dml_job_t *const dml_job_ptr))
             // Check guard
             if (check_guard)
             {
-                uint16_t crc = crc_seed;
-                dmlc_calculate_crc_16u(source_ptr, block_size, &crc, OWN_DIF_CRC_POLYNOMIAL);
-                crc = idml_sw_reverse_bytes_16u((invert_crc_result) ? ~crc : crc);
+                const uint16_t crc = guard_tags[group_idx];
 
-                if (crc != dif_ptr->guard_tag)
+                if (idml_sw_reverse_bytes_16u((invert_crc_result) ? ~crc : crc) != dif_ptr->guard_tag)
                 {
                     check_accumulator |= DML_DIF_CHECK_GUARD_MISMATCH;
                 }
@@ -31,13 +31,27 @@ OWN_FUN_INLINE(dml_status_t, sw_compare, (dml_job_t *const dml_job_ptr))
     // Variables
     uint8_t  *const first_vector_ptr  = dml_job_ptr->source_first_ptr;
     uint8_t  *const second_vector_ptr = dml_job_ptr->source_second_ptr;
-    uint32_t *const offset_ptr        = &dml_job_ptr->offset;
-    const uint32_t bytes_to_compare   = dml_job_ptr->source_length;
+    const uint64_t bytes_to_compare   = dml_job_ptr->source_length;
+    dmlc_status_t compare_result      = DML_STATUS_OK;
+    uint64_t offset                   = 0u;
 
-    dmlc_status_t compare_result = dmlc_compare_8u(first_vector_ptr,
-                                                   second_vector_ptr,
-                                                   bytes_to_compare,
-                                                   offset_ptr);
+    // The first mismatch stops the comparison, its offset is rebased from the part to the whole vectors
+    do
+    {
+        uint32_t mismatch_offset = 0u;
+
+        compare_result = dmlc_compare_8u(first_vector_ptr + offset,
+                                         second_vector_ptr + offset,
+                                         idml_sw_get_part_size(bytes_to_compare, offset),
+                                         &mismatch_offset);
+
+        if (DML_COMPARE_STATUS_NE == compare_result)
+        {
+            dml_job_ptr->offset = offset + mismatch_offset;
+        }
+
+        offset += OWN_SW_PART_SIZE;
+    } while (DML_STATUS_OK == compare_result && offset < bytes_to_compare);
 
     return idml_sw_check_result(dml_job_ptr, compare_result);
 }
@@ -28,13 +28,27 @@ OWN_FUN_INLINE(dml_status_t, sw_compare_with_pattern, (dml_job_t *const dml_job_
     // Variables
     uint8_t *const vector_ptr = dml_job_ptr->source_first_ptr;
     pattern_t pattern = *((pattern_t*) dml_job_ptr->pattern);
-    uint32_t *const offset_ptr = &dml_job_ptr->offset;
-    const uint32_t bytes_to_compare = dml_job_ptr->source_length;
+    const uint64_t bytes_to_compare = dml_job_ptr->source_length;
+    dmlc_status_t compare_result = DML_STATUS_OK;
+    uint64_t offset = 0u;
 
-    dmlc_status_t compare_result = dmlc_compare_with_pattern_8u(vector_ptr,
-                                                                pattern,
-                                                                bytes_to_compare,
-                                                                offset_ptr);
+    // Parts are multiples of the pattern size, the first mismatch offset is rebased to the whole vector
+    do
+    {
+        uint32_t mismatch_offset = 0u;
+
+        compare_result = dmlc_compare_with_pattern_8u(vector_ptr + offset,
+                                                      pattern,
+                                                      idml_sw_get_part_size(bytes_to_compare, offset),
+                                                      &mismatch_offset);
+
+        if (DML_COMPARE_STATUS_NE == compare_result)
+        {
+            dml_job_ptr->offset = offset + mismatch_offset;
+        }
+
+        offset += OWN_SW_PART_SIZE;
+    } while (DML_STATUS_OK == compare_result && offset < bytes_to_compare);
 
     return idml_sw_check_result(dml_job_ptr, compare_result);
 }
\ No newline at end of file
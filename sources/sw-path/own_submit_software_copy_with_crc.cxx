@@ -31,15 +31,30 @@ OWN_FUN_INLINE(dml_status_t, sw_copy_with_crc, (dml_job_t *const dml_job_ptr))
     // Variables
     dml_status_t status;
 
-    uint8_t *const source_ptr      = dml_job_ptr->source_first_ptr;
-    uint8_t *const destination_ptr = dml_job_ptr->destination_first_ptr;
-    const uint32_t byte_size       = dml_job_ptr->source_length;
+    uint8_t *const  source_ptr      = dml_job_ptr->source_first_ptr;
+    uint8_t *const  destination_ptr = dml_job_ptr->destination_first_ptr;
+    uint32_t *const crc_ptr         = dml_job_ptr->crc_checksum_ptr;
+    const uint64_t  byte_size       = dml_job_ptr->source_length;
 
-    // Copy
-    status = dmlc_copy_8u(source_ptr, destination_ptr, byte_size);
+    status = idml_sw_crc_init_seed(dml_job_ptr);
 
     DML_RETURN_IN_CASE_OF_ERROR(status)
 
-    // Crc calculation
-    return idml_sw_crc(dml_job_ptr);
+    // Copy and CRC are fused, the source is read once, the CRC of a part is the seed of the next one
+    for (uint64_t offset = 0u; offset < byte_size && DML_STATUS_OK == status; offset += OWN_SW_PART_SIZE)
+    {
+        const uint32_t part_size = idml_sw_get_part_size(byte_size, offset);
+
+        status = (!(dml_job_ptr->flags & DML_FLAG_CRC_BYPASS_DATA_REFLECTION)) ?
+            dmlc_copy_with_crc_reflected_32u(source_ptr + offset,
+                                             destination_ptr + offset,
+                                             part_size,
+                                             crc_ptr,
+                                             DML_CRC_POLYNOMIAL):
+            dmlc_copy_with_crc_32u(source_ptr + offset, destination_ptr + offset, part_size, crc_ptr, DML_CRC_POLYNOMIAL);
+    }
+
+    idml_sw_crc_finalize(dml_job_ptr);
+
+    return status;
 }
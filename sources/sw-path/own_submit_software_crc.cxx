@@ -25,16 +25,12 @@
 #define OWN_CRC_BAD_ALIGNMENT(ptr) DML_BAD_ARGUMENT_RETURN((0 != (((uint64_t)ptr) & 0x3u)), DML_STATUS_CRC_ALIGN_ERROR) /**< Checks that the pointer is 4-byte aligned */
 
 
-OWN_FUN_INLINE(dml_status_t, sw_crc, (dml_job_t *const dml_job_ptr))
+/**
+ * @brief Sets CRC seed up according to the job flags: reads or zeroes it, applies inversion and bit reversal
+ */
+OWN_FUN_INLINE(dml_status_t, sw_crc_init_seed, (dml_job_t *const dml_job_ptr))
 {
-    DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr->source_first_ptr)
-    DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr->crc_checksum_ptr)
-
-    // Variables
-    dmlc_status_t status;
-    uint8_t  *const source_ptr        = dml_job_ptr->source_first_ptr;
     uint32_t *const crc_ptr           = dml_job_ptr->crc_checksum_ptr;
-    const uint32_t  source_size       = dml_job_ptr->source_length;
     const dml_operation_flags_t flags = dml_job_ptr->flags;
 
     // Read the CRC seed from memory at the CRC Seed Address only in case if DML_FLAG_READ_SEED set
@@ -47,8 +43,6 @@ OWN_FUN_INLINE(dml_status_t, sw_crc, (dml_job_t *const dml_job_ptr))
         // Checks that pointer is 4-byte aligned
         OWN_CRC_BAD_ALIGNMENT(dml_job_ptr->crc_checksum_ptr)
     }
-    
-
 
     // Bypass inversion and use reverse bit order for CRC result
     if (!(flags & DML_FLAG_CRC_BYPASS_REFLECTION))
@@ -57,18 +51,54 @@ OWN_FUN_INLINE(dml_status_t, sw_crc, (dml_job_t *const dml_job_ptr))
         *crc_ptr = idml_sw_bit_reverse_32u(*crc_ptr);
     }
 
-    // Bypass Data Reflection in case if DML_FLAG_DATA_REFLECTION set
-    status = (!(flags & DML_FLAG_CRC_BYPASS_DATA_REFLECTION)) ?
-        dmlc_calculate_crc_reflected_32u(source_ptr, source_size, crc_ptr, DML_CRC_POLYNOMIAL):
-        dmlc_calculate_crc_32u(source_ptr, source_size, crc_ptr, DML_CRC_POLYNOMIAL);
+    return DML_STATUS_OK;
+}
+
 
+/**
+ * @brief Converts calculated CRC into the result according to the job flags
+ */
+OWN_FUN_INLINE(void, sw_crc_finalize, (dml_job_t *const dml_job_ptr))
+{
+    uint32_t *const crc_ptr = dml_job_ptr->crc_checksum_ptr;
 
     // Bypass inversion and use reverse bit order for CRC result
-    if (!(flags & DML_FLAG_CRC_BYPASS_REFLECTION))
+    if (!(dml_job_ptr->flags & DML_FLAG_CRC_BYPASS_REFLECTION))
     {
         *crc_ptr = idml_sw_bit_reverse_32u(*crc_ptr);
         *crc_ptr = ~ (*crc_ptr);
     }
+}
+
+
+OWN_FUN_INLINE(dml_status_t, sw_crc, (dml_job_t *const dml_job_ptr))
+{
+    DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr->source_first_ptr)
+    DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr->crc_checksum_ptr)
+
+    // Variables
+    dmlc_status_t status;
+    uint8_t  *const source_ptr        = dml_job_ptr->source_first_ptr;
+    uint32_t *const crc_ptr           = dml_job_ptr->crc_checksum_ptr;
+    const uint64_t  source_size       = dml_job_ptr->source_length;
+    const dml_operation_flags_t flags = dml_job_ptr->flags;
+
+    status = idml_sw_crc_init_seed(dml_job_ptr);
+
+    DML_RETURN_IN_CASE_OF_ERROR(status)
+
+    // The CRC of a part is the seed of the next one
+    for (uint64_t offset = 0u; offset < source_size && DML_STATUS_OK == status; offset += OWN_SW_PART_SIZE)
+    {
+        const uint32_t part_size = idml_sw_get_part_size(source_size, offset);
+
+        // Bypass Data Reflection in case if DML_FLAG_DATA_REFLECTION set
+        status = (!(flags & DML_FLAG_CRC_BYPASS_DATA_REFLECTION)) ?
+            dmlc_calculate_crc_reflected_32u(source_ptr + offset, part_size, crc_ptr, DML_CRC_POLYNOMIAL):
+            dmlc_calculate_crc_32u(source_ptr + offset, part_size, crc_ptr, DML_CRC_POLYNOMIAL);
+    }
+
+    idml_sw_crc_finalize(dml_job_ptr);
 
     return status;
-}
\ No newline at end of file
+}
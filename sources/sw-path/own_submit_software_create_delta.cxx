@@ -20,6 +20,58 @@
  *
  */
 
+/**
+ * @brief Creates a wide delta record by parts of the compared vectors
+ *
+ * Offsets of the notes are absolute, so the records of the parts are concatenated.
+ * A part is compared only, if the record is full already.
+ */
+OWN_FUN_INLINE(dml_status_t, sw_create_wide_delta, (const uint8_t *const reference_vector_ptr,
+                                                    const uint8_t *const source_vector_ptr,
+                                                    const uint64_t compared_bytes_count,
+                                                    uint8_t *const delta_record_ptr,
+                                                    const uint64_t delta_record_max_size,
+                                                    uint64_t *const delta_record_size_ptr))
+{
+    const uint64_t max_size = delta_record_max_size / DML_WIDE_DELTA_NOTE_SIZE * DML_WIDE_DELTA_NOTE_SIZE;
+    dml_status_t   status   = DML_STATUS_OK;
+    uint64_t       offset   = 0u;
+
+    (*delta_record_size_ptr) = 0u;
+
+    do
+    {
+        const uint32_t part_size     = idml_sw_get_part_size(compared_bytes_count, offset);
+        const uint64_t part_capacity = (uint64_t) part_size / 8u * DML_WIDE_DELTA_NOTE_SIZE;
+        const uint64_t capacity      = max_size - (*delta_record_size_ptr);
+        uint32_t       record_size   = 0u;
+
+        if ((0u == capacity) && (0u != max_size))
+        {
+            uint32_t mismatch_offset = 0u;
+
+            status = dmlc_compare_8u(reference_vector_ptr + offset, source_vector_ptr + offset, part_size, &mismatch_offset);
+            status = (DML_COMPARE_STATUS_NE == status) ? DML_STATUS_DELTA_RECORD_SIZE_ERROR : status;
+        }
+        else
+        {
+            status = dmlc_create_wide_delta_record_8u(reference_vector_ptr + offset,
+                                                      source_vector_ptr + offset,
+                                                      part_size,
+                                                      offset / 8u,
+                                                      (uint32_t) ((capacity < part_capacity) ? capacity : part_capacity),
+                                                      delta_record_ptr + (*delta_record_size_ptr),
+                                                      &record_size);
+        }
+
+        (*delta_record_size_ptr) += record_size;
+        offset                   += OWN_SW_PART_SIZE;
+    } while ((DML_STATUS_OK == status) && (offset < compared_bytes_count));
+
+    return status;
+}
+
+
 OWN_FUN_INLINE(dml_status_t, sw_create_delta, (dml_job_t *const dml_job_ptr))
 {
     DML_BAD_ARGUMENT_NULL_POINTER(dml_job_ptr->source_first_ptr)
@@ -30,19 +82,50 @@ OWN_FUN_INLINE(dml_status_t, sw_create_delta, (dml_job_t *const dml_job_ptr))
     uint8_t  *const source_vector_ptr     = dml_job_ptr->source_first_ptr;
     uint8_t  *const reference_vector_ptr  = dml_job_ptr->source_second_ptr;
     uint8_t  *const delta_record_ptr      = dml_job_ptr->destination_first_ptr;
-    uint32_t *const delta_record_size_ptr = &(dml_job_ptr->destination_length);
-    const uint32_t delta_record_max_size  = dml_job_ptr->destination_length;
-    const uint32_t compared_bytes_count   = dml_job_ptr->source_length;
+    uint64_t *const delta_record_size_ptr = &(dml_job_ptr->destination_length);
+    const uint64_t delta_record_max_size  = dml_job_ptr->destination_length;
+    const uint64_t compared_bytes_count   = dml_job_ptr->source_length;
     const uint64_t check_result_flag      = (DML_FLAG_CHECK_RESULT & dml_job_ptr->flags);
     const uint32_t check_result_type      = dml_job_ptr->expected_result;
 
-    dml_status_t status = dmlc_create_delta_record_8u(reference_vector_ptr,
-                                                      source_vector_ptr,
-                                                      compared_bytes_count,
-                                                      delta_record_max_size,
-                                                      delta_record_ptr,
-                                                      delta_record_size_ptr);
-    
+    const uint32_t is_wide_record         = (DML_FLAG_DELTA_WIDE_RECORD & dml_job_ptr->flags) ? 1u : 0u;
+
+    dml_status_t status = DML_STATUS_OK;
+
+    if (is_wide_record)
+    {
+        status = idml_sw_create_wide_delta(reference_vector_ptr,
+                                           source_vector_ptr,
+                                           compared_bytes_count,
+                                           delta_record_ptr,
+                                           delta_record_max_size,
+                                           delta_record_size_ptr);
+    }
+    else
+    {
+        // Standard record addresses 0.5 MB at most, the core checks the sizes then
+        if (UINT32_MAX < compared_bytes_count)
+        {
+            return DML_STATUS_DELTA_OFFSET_ERROR;
+        }
+
+        if (UINT32_MAX < delta_record_max_size)
+        {
+            return DML_STATUS_DELTA_INPUT_SIZE_ERROR;
+        }
+
+        uint32_t record_size = 0u;
+
+        status = dmlc_create_delta_record_8u(reference_vector_ptr,
+                                             source_vector_ptr,
+                                             (uint32_t) compared_bytes_count,
+                                             (uint32_t) delta_record_max_size,
+                                             delta_record_ptr,
+                                             &record_size);
+
+        (*delta_record_size_ptr) = record_size;
+    }
+
     // Check for error
     if ((DML_STATUS_NULL_POINTER_ERROR     == status) ||
         (DML_STATUS_DELTA_ALIGN_ERROR      == status) ||
@@ -54,7 +137,9 @@ OWN_FUN_INLINE(dml_status_t, sw_create_delta, (dml_job_t *const dml_job_ptr))
 
     if (0u < (*delta_record_size_ptr))
     {
-        dml_job_ptr->offset = (uint32_t)(*((uint16_t *)(&delta_record_ptr[0])));
+        dml_job_ptr->offset = (is_wide_record) ?
+                              (*((uint64_t *)(&delta_record_ptr[0]))) :
+                              (*((uint16_t *)(&delta_record_ptr[0])));
         dml_job_ptr->result = (DML_STATUS_OK == status) ? (1u) : (2u);
     }
     else
@@ -45,10 +45,16 @@ OWN_FUN_INLINE(dml_status_t, sw_dualcast_copy, (dml_job_t *const dml_job_ptr))
     uint8_t *const source_ptr             = dml_job_ptr->source_first_ptr;
     uint8_t *const destination_first_ptr  = dml_job_ptr->destination_first_ptr;
     uint8_t *const destination_second_ptr = dml_job_ptr->destination_second_ptr;
-    const uint32_t bytes_to_copy          = dml_job_ptr->source_length;
+    const uint64_t bytes_to_copy          = dml_job_ptr->source_length;
+    dmlc_status_t  status                 = DML_STATUS_OK;
 
-    return dmlc_dualcast_copy_8u(source_ptr,
-                                 destination_first_ptr,
-                                 destination_second_ptr,
-                                 bytes_to_copy);
+    for (uint64_t offset = 0u; offset < bytes_to_copy && DML_STATUS_OK == status; offset += OWN_SW_PART_SIZE)
+    {
+        status = dmlc_dualcast_copy_8u(source_ptr + offset,
+                                       destination_first_ptr + offset,
+                                       destination_second_ptr + offset,
+                                       idml_sw_get_part_size(bytes_to_copy, offset));
+    }
+
+    return status;
 }
\ No newline at end of file
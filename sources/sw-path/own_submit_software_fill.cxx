@@ -32,9 +32,13 @@ OWN_FUN_INLINE(dml_status_t, sw_fill, (dml_job_t *const dml_job_ptr))
     // Variables
     uint8_t *const destination_ptr = dml_job_ptr->destination_first_ptr;
     const uint64_t filler          = *((uint64_t *)dml_job_ptr->pattern);
-    const uint32_t bytes_to_fill   = dml_job_ptr->destination_length;
+    const uint64_t bytes_to_fill   = dml_job_ptr->destination_length;
 
-    dmlc_fill_with_pattern_8u(filler,destination_ptr, bytes_to_fill);
+    // Parts are multiples of the pattern size, so each part starts with the first pattern byte
+    for (uint64_t offset = 0u; offset < bytes_to_fill; offset += OWN_SW_PART_SIZE)
+    {
+        dmlc_fill_with_pattern_8u(filler, destination_ptr + offset, idml_sw_get_part_size(bytes_to_fill, offset));
+    }
 
     return DML_STATUS_OK;
 }
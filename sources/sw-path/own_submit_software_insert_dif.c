@@ -34,7 +34,7 @@ OWN_FUN(dml_status_t, sw_insert_dif, (dml_job_t *const dml_job_ptr))
 
     const uint32_t dif_flags   = dml_job_ptr->dif_config.flags;
     const uint32_t block_size  = own_dif_block_sizes[dml_job_ptr->dif_config.block_size];
-    const uint32_t block_count = dml_job_ptr->source_length / block_size;
+    const uint64_t block_count = dml_job_ptr->source_length / block_size;
 
     // Additional bad argument checks
     DML_BAD_ARGUMENT_RETURN((dml_job_ptr->source_length % block_size), DML_STATUS_JOB_LENGTH_ERROR)
@@ -59,19 +59,26 @@ OWN_FUN(dml_status_t, sw_insert_dif, (dml_job_t *const dml_job_ptr))
     uint16_t application_tag = dml_job_ptr->dif_config.destination_application_tag_seed;
     uint32_t  reference_tag   = dml_job_ptr->dif_config.destination_reference_tag_seed;
 
+    uint16_t guard_tags[OWN_DIF_BLOCKS_GROUP_SIZE];
+
     // Process data
-    for (uint32_t block = 0u; block < block_count; block++)
+    for (uint64_t block = 0u; block < block_count; block++)
     {
         // Variables
         own_dif_t *const dif_ptr = (own_dif_t *) (destination_ptr + block_size);
-        uint16_t crc = crc_seed;
+        const uint32_t group_idx = block % OWN_DIF_BLOCKS_GROUP_SIZE;
+
+        // Guard tags are calculated for a group of source blocks at once
+        if (0u == group_idx)
+        {
+            idml_sw_dif_calculate_guard_tags(source_ptr, block_size, block_size, block_count - block, crc_seed, guard_tags);
+        }
+
+        const uint16_t crc = guard_tags[group_idx];
 
         // Copy
         dmlc_copy_8u(source_ptr, destination_ptr, block_size);
 
-        // Calculate CRC
-        dmlc_calculate_crc_16u(destination_ptr, block_size, &crc, OWN_DIF_CRC_POLYNOMIAL);
-
         // Write data integrity field
         dif_ptr->application_tag = idml_sw_reverse_bytes_16u(application_tag & application_tag_mask);
         dif_ptr->reference_tag   = idml_sw_reverse_bytes_32u(reference_tag);
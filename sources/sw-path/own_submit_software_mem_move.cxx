@@ -28,22 +28,35 @@ OWN_FUN_INLINE(dml_status_t, sw_memory_move, (dml_job_t *const dml_job_ptr))
 
     uint8_t *const source_ptr      = dml_job_ptr->source_first_ptr;
     uint8_t *const destination_ptr = dml_job_ptr->destination_first_ptr;
-    const uint32_t byte_size       = dml_job_ptr->source_length;
+    const uint64_t byte_size       = dml_job_ptr->source_length;
+    const dml_bool_t is_backward   = (source_ptr < destination_ptr && source_ptr + byte_size > destination_ptr);
 
     if(dml_job_ptr->flags & DML_FLAG_COPY_ONLY)
     {
-        if (source_ptr < destination_ptr && source_ptr + byte_size > destination_ptr)
+        if (is_backward)
         {
             return DML_STATUS_OVERLAPPING_BUFFER_ERROR;
         }
 
-        dmlc_status_t status = dmlc_copy_8u(source_ptr, destination_ptr, byte_size);
+        for (uint64_t offset = 0u; offset < byte_size; offset += OWN_SW_PART_SIZE)
+        {
+            const uint32_t part_size = idml_sw_get_part_size(byte_size, offset);
+            dmlc_status_t  status    = dmlc_copy_8u(source_ptr + offset, destination_ptr + offset, part_size);
 
-        DML_RETURN_IN_CASE_OF_ERROR(status)
+            DML_RETURN_IN_CASE_OF_ERROR(status)
+        }
     }
     else
     {
-        dmlc_move_8u(source_ptr, destination_ptr, byte_size);
+        // Backward move goes from the last part, so a part never overwrites the source of the next one
+        const uint64_t parts_count = (byte_size + OWN_SW_PART_SIZE - 1u) / OWN_SW_PART_SIZE;
+
+        for (uint64_t part = 0u; part < parts_count; ++part)
+        {
+            const uint64_t offset = ((is_backward) ? (parts_count - 1u - part) : part) * OWN_SW_PART_SIZE;
+
+            dmlc_move_8u(source_ptr + offset, destination_ptr + offset, idml_sw_get_part_size(byte_size, offset));
+        }
     }
 
     return DML_STATUS_OK;
@@ -90,6 +90,7 @@ OWN_FUN(dml_status_t, sw_submit_job, (dml_job_t *const dml_job_ptr))
 
 // Include common functions
 #include "own_software_reverse_functions.cxx"
+#include "own_software_part_functions.cxx"
 
 // Include dml operations implementation
 #include "own_submit_software_mem_move.cxx"
@@ -35,7 +35,7 @@ OWN_FUN(dml_status_t, sw_strip_dif, (dml_job_t *const dml_job_ptr))
     // General constants
     const uint32_t block_size  = own_dif_block_sizes[dml_job_ptr->dif_config.block_size];
     const uint32_t source_step = block_size + sizeof(own_dif_t);
-    const uint32_t block_count = dml_job_ptr->source_length / source_step;
+    const uint64_t block_count = dml_job_ptr->source_length / source_step;
 
     DML_BAD_ARGUMENT_RETURN((dml_job_ptr->source_length % source_step), DML_STATUS_JOB_LENGTH_ERROR)
 
@@ -53,7 +53,7 @@ OWN_FUN(dml_status_t, sw_strip_dif, (dml_job_t *const dml_job_ptr))
     DML_RETURN_IN_CASE_OF_ERROR(status)
 
     // Process data
-    for (uint32_t block = 0; block < block_count; block++)
+    for (uint64_t block = 0u; block < block_count; block++)
     {
         dmlc_copy_8u(source_ptr, destination_ptr, block_size);
 
@@ -39,7 +39,7 @@ OWN_FUN(dml_status_t, sw_update_dif, (dml_job_t *const dml_job_ptr))
     const uint32_t dif_flags   = dml_job_ptr->dif_config.flags;
     const uint32_t block_size  = own_dif_block_sizes[dml_job_ptr->dif_config.block_size];
     const uint32_t step        = block_size + sizeof(own_dif_t);
-    const uint32_t block_count = dml_job_ptr->source_length / step;
+    const uint64_t block_count = dml_job_ptr->source_length / step;
 
     DML_BAD_ARGUMENT_RETURN((dml_job_ptr->source_length % step), DML_STATUS_JOB_LENGTH_ERROR)
 
@@ -72,18 +72,26 @@ OWN_FUN(dml_status_t, sw_update_dif, (dml_job_t *const dml_job_ptr))
     const dml_status_t status = idml_sw_check_dif(dml_job_ptr);
     DML_RETURN_IN_CASE_OF_ERROR(status)
 
+    uint16_t guard_tags[OWN_DIF_BLOCKS_GROUP_SIZE];
+
     // Process Data
-    for (uint32_t block = 0u; block < block_count; block++)
+    for (uint64_t block = 0u; block < block_count; block++)
     {
         own_dif_t *const destination_dif_ptr  = (own_dif_t *) (destination_ptr + block_size);
+        const uint32_t   group_idx            = block % OWN_DIF_BLOCKS_GROUP_SIZE;
+
+        // Guard tags are calculated for a group of source blocks at once, the data is copied as is
+        if (calculate_crc && (0u == group_idx))
+        {
+            idml_sw_dif_calculate_guard_tags(source_ptr, block_size, step, block_count - block, crc_seed, guard_tags);
+        }
 
         dmlc_copy_8u(source_ptr, destination_ptr, step);
 
         // Update DIF
         if (calculate_crc)
         {
-            uint16_t crc = crc_seed;
-            dmlc_calculate_crc_16u(destination_ptr,block_size, &crc, OWN_DIF_CRC_POLYNOMIAL);
+            const uint16_t crc = guard_tags[group_idx];
             destination_dif_ptr->guard_tag = idml_sw_reverse_bytes_16u((invert_crc_result) ? ~crc: crc);
         }
 